@@ -1,1412 +1,7747 @@
-#ifndef INCLUDEGUARD_READSNDFILE_HEADER
-#define INCLUDEGUARD_READSNDFILE_HEADER
-
-#include <stdint.h>			// uint32_tƂ̂
-#include <string>			// stringn̂
-#include <cstring>			// std::memcmp̂
-#include <string_view>		// std::string_vieŵ
-#include <stdexcept>		// runtime_error̂
-#include <fstream>			// t@Cǂݎ
-#include <filesystem>		// t@C
-#include <system_error>		// std::error_codê
-#include <vector>			// ϒz
-#include <unordered_map>	// nbVIȂ
-#include <type_traits>		// std::enable_if̂
-
-namespace SAELib {
-	namespace ReadSndFile_detail {
-		using ksize_t = uint32_t;
-		inline constexpr ksize_t KSIZE_MAX = static_cast<ksize_t>(~ksize_t{ 0 });
-
-		namespace ReadSndFileFormat {
-			inline constexpr double kVersion = 1.00;
-			inline constexpr std::string_view kSystemDirectoryName = "SAELib";
-			inline constexpr std::string_view kErrorLogFileName = "SAELib_SndErrorLog";
-
-			inline constexpr unsigned char kDummyBinaryArray[1] = { 0 };
-			inline constexpr const unsigned char* kDummyBinaryData = kDummyBinaryArray;
-			inline constexpr std::string_view kDummyStringView = "";
-		};
-
-		namespace SNDFormat {
-			inline constexpr std::string_view kExtension = ".snd";
-			inline constexpr std::string_view kSignature = "ElecbyteSnd";
-			inline constexpr uint32_t kSNDVersion = 0x01000100;
-			inline constexpr uint32_t kSNDVersion2 = 0x00010001;
-			inline constexpr ksize_t kSubHeaderStart = 512;
-			inline constexpr ksize_t kFileSizeLimit = 0xffffffff;
-		};
-
-		namespace DecodeEndian {
-			[[nodiscard]] inline constexpr uint16_t UInt16LE(const unsigned char* const buffer) noexcept {
-				return buffer[0] | (buffer[1] << 8);
-			}
-			[[nodiscard]] inline constexpr uint32_t UInt32LE(const unsigned char* const buffer) noexcept {
-				return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | (buffer[3] << 24);
-			}
-			[[nodiscard]] inline constexpr uint16_t UInt16BE(const unsigned char* const buffer) noexcept {
-				return buffer[1] | (buffer[0] << 8);
-			}
-			[[nodiscard]] inline constexpr uint32_t UInt32BE(const unsigned char* const buffer) noexcept { //igpj
-				return buffer[3] | (buffer[2] << 8) | (buffer[1] << 16) | (buffer[0] << 24);
-			}
-		};
-
-		template<typename T, typename = std::enable_if_t<std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>>>
-		struct T_Bit {
-		private:
-			const T kBitStart;
-			const T kBitRange;
-		public:
-			constexpr T_Bit(int32_t BitStart, T BitRange) : kBitStart(BitStart), kBitRange(BitRange) {}
-			[[nodiscard]] constexpr T BitStart() const noexcept { return kBitStart; }
-			[[nodiscard]] constexpr T BitRange() const noexcept { return kBitRange; }
-			[[nodiscard]] constexpr T BitMask() const noexcept { return kBitRange << kBitStart; }
-			[[nodiscard]] constexpr T BitSet(T Value) const noexcept { return (Value & kBitRange) << kBitStart; }
-			[[nodiscard]] constexpr T BitGet(T Value) const noexcept { return (Value >> kBitStart) & kBitRange; }
-		};
-
-		struct Convert {
-		private:
-			inline static constexpr T_Bit<int64_t> kSoundGroupNo = T_Bit<int64_t>(0, UINT32_MAX);
-			inline static constexpr T_Bit<int64_t> kSoundItemNo = T_Bit<int64_t>(32, UINT32_MAX);
-
-		public:
-			[[nodiscard]] inline static constexpr int64_t EncodeSoundNumber(int32_t GroupNo, int32_t ItemNo) noexcept {
-				return kSoundGroupNo.BitSet(GroupNo) | kSoundItemNo.BitSet(ItemNo);
-			}
-
-			[[nodiscard]] inline static constexpr int32_t DecodeSoundGroupNo(int64_t SoundNumber) noexcept { return static_cast<int32_t>(kSoundGroupNo.BitGet(SoundNumber)); }
-			[[nodiscard]] inline static constexpr int32_t DecodeSoundItemNo(int64_t SoundNumber) noexcept { return static_cast<int32_t>(kSoundItemNo.BitGet(SoundNumber)); }
-		};
-
-		struct T_Config {
-		private:
-			T_Config() = default;
-			~T_Config() = default;
-			T_Config(const T_Config&) = delete;
-			T_Config& operator=(const T_Config&) = delete;
-
-		private:
-			int32_t BitFlag_ = {};
-			// rbgtOݒ:
-			// bit 0 (0x01): ̃CuO𓊂邩
-			// bit 1 (0x02): G[Ot@C𐶐邩
-			// bit 2 (0x04): SAELibt@C쐬邩
-			// 
-			// SAELibt@C̐pXw
-			// SNDf[^JnfBNgpXw
-			// 
-
-			inline static constexpr int32_t kThrowError = 1 << 0;
-			inline static constexpr int32_t kCreateLogFile = 1 << 1;
-			inline static constexpr int32_t kCreateSAELibFile = 1 << 2;
-			inline static constexpr int32_t kDefaultConfig = 0;
-
-			// SAELibt@C̃pX
-			std::filesystem::path SAELibFilePath_ = {};
-
-			// SNDt@CJnpX
-			std::filesystem::path SNDSearchPath_ = {};
-
-		public:
-			[[nodiscard]] static T_Config& Instance() {
-				static T_Config instance;
-				return instance;
-			}
-
-		public:
-			[[nodiscard]] int32_t BitFlag() const noexcept { return BitFlag_; }
-			[[nodiscard]] bool ThrowError() const noexcept { return (BitFlag_ & kThrowError) != 0; }
-			[[nodiscard]] bool CreateLogFile() const noexcept { return (BitFlag_ & kCreateLogFile) != 0; }
-			[[nodiscard]] bool CreateSAELibFile() const noexcept { return (BitFlag_ & kCreateSAELibFile) != 0; }
-			[[nodiscard]] const std::filesystem::path& SAELibFilePath() const noexcept { return SAELibFilePath_; }
-			[[nodiscard]] const std::filesystem::path& SNDSearchPath() const noexcept { return SNDSearchPath_; }
-
-			void InitConfig() { BitFlag_ = kDefaultConfig; }
-			void ThrowError(bool flag) { BitFlag_ = (BitFlag_ & ~kThrowError) | (flag ? kThrowError : 0); }
-			void CreateLogFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateLogFile) | (flag ? kCreateLogFile : 0); }
-			void CreateSAELibFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateSAELibFile) | (flag ? kCreateSAELibFile : 0); }
-			void SAELibFilePath(const std::filesystem::path& Path) { SAELibFilePath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
-			void SNDSearchPath(const std::filesystem::path& Path) { SNDSearchPath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
-		};
-
-		// [U[QƂ͈͂Ȃ̂kvtBbNX͂Ȃ
-
-		/**
-		* @brief G[
-		*
-		* @̃CugpG[̖OԂł
-		*/
-		namespace ErrorMessage {
-
-			/**
-			* @brief G[\
-			*
-			* @̃Cuo͂G[̍\̂ł
-			*
-			* @param const int32_t ID
-			* @param const char* const Name
-			* @param const char* const Message
-			*/
-			struct T_ErrorInfo {
-			public:
-				const int32_t ID;
-				const char* const Name;
-				const char* const Message;
-			};
-
-			/**
-			* @brief G[ID
-			*
-			* @̃Cuo͂G[IDenumł
-			*
-			* @return enum ErrorID G[ID
-			*/
-			enum ErrorID : int32_t {
-				NotFound_SNDFile,
-				NotFound_SoundNumber,
-				NotFound_SoundIndex,
-
-				Invalid_SNDExtension,
-				Invalid_LoadSNDPath,
-				Invalid_SNDSearchPath,
-				Invalid_EmptySNDFilePath,
-				Invalid_SNDFileSize,
-				Invalid_SNDSignature,
-				Invalid_RIFFSignature,
-				Invalid_WAVEFormat,
-				Invalid_SAELibFolderPath,
-
-				Failed_OpenSNDFile,
-				Failed_CreateSAELibFolder,
-				Failed_CreateErrorLogFile,
-				Failed_WriteErrorLogFile,
-				Failed_CloseErrorLogFile,
-				Failed_CreateExportWAVFolder,
-				Failed_CreateWAVFile,
-				Failed_WriteWAVFile,
-				Failed_CloseWAVFile,
-
-				Corrupted_SNDFile,
-				Warning_DuplicateSoundNumber,
-			};
-
-			/**
-			* @brief G[z
-			*
-			* @̃Cuo͂G[̔zł
-			*
-			* @return T_ErrorInfo ErrorInfo G[
-			*/
-			inline constexpr T_ErrorInfo ErrorInfo[] = {
-				{ NotFound_SNDFile,				"NotFound_SNDFile",				"SNDt@C܂" },
-				{ NotFound_SoundNumber,			"NotFound_SoundNumber",			"w肵ԍTEhXg猩܂" },
-				{ NotFound_SoundIndex,			"NotFound_SoundIndex",			"w肵CfbNXTEhXg猩܂" },
-			
-				{ Invalid_SNDExtension,			"Invalid_SNDExtension",			"t@C̊gq.sndł͂܂" },
-				{ Invalid_LoadSNDPath,			"Invalid_LoadSNDPath",			"SNDt@Cǂݍ݊֐̃pX܂" },
-				{ Invalid_SNDSearchPath,		"Invalid_SNDSearchPath",		"SNDt@CtH_̃pX܂" },
-				{ Invalid_EmptySNDFilePath,		"Invalid_EmptySNDFilePath",		"SNDt@CpXw肳Ă܂" },
-				{ Invalid_SNDFileSize,			"Invalid_SNDFileSize",			"SNDt@CTCYel𒴂Ă܂" },
-				{ Invalid_SNDSignature,			"Invalid_SNDSignature",			"t@C̓`SNDt@Cł͂܂" },
-				{ Invalid_RIFFSignature,		"Invalid_RIFFSignature",		"SNDt@C̉f[^RIFF`ł͂܂" },
-				{ Invalid_WAVEFormat,			"Invalid_WAVEFormat",			"SNDt@C̉f[^̃tH[}bgWAVE`ł͂܂" },
-				{ Invalid_SAELibFolderPath,		"Invalid_SAELibFolderPath",		"SAELibtH_̃pX܂" },
-			
-				{ Failed_OpenSNDFile,			"Failed_OpenSNDFile",			"SNDt@CJ܂ł" },
-				{ Failed_CreateSAELibFolder,	"Failed_CreateSAELibFolder",	"SAELibtH_̍쐬Ɏs܂" },
-				{ Failed_CreateErrorLogFile,	"Failed_CreateErrorLogFile",	"G[Ot@C̍쐬Ɏs܂" },
-				{ Failed_WriteErrorLogFile,		"Failed_WriteErrorLogFile",		"G[Ot@Cւ݂̏Ɏs܂" },
-				{ Failed_CloseErrorLogFile,		"Failed_CloseErrorLogFile",		"G[Ot@Cւ݂̏ɏI܂ł" },
-				{ Failed_CreateExportWAVFolder,	"Failed_CreateExportWAVFolder",	"WAVt@Co̓tH_̍쐬Ɏs܂" },
-				{ Failed_CreateWAVFile,			"Failed_CreateWAVFile",			"WAVt@C̍쐬Ɏs܂" },
-				{ Failed_WriteWAVFile,			"Failed_WriteWAVFile",			"WAVt@C݂̏Ɏs܂" },
-				{ Failed_CloseWAVFile,			"Failed_CloseWAVFile",			"WAVt@C݂̏ɏI܂ł" },
-			
-				{ Corrupted_SNDFile,			"Corrupted_SNDFile",			"SNDt@CĂ\܂" },
-				{ Warning_DuplicateSoundNumber,	"Warning_DuplicateSoundNumber",	"TEhXg̔ԍdĂ܂" },
-			};
-
-			/**
-			* @brief G[̃TCY擾
-			*
-			* @G[̔zTCY擾܂
-			*
-			* @return size_t ErrorInfoSize G[zTCY
-			*/
-			inline constexpr size_t ErrorInfoSize = sizeof(ErrorInfo) / sizeof(ErrorInfo[0]);
-
-			/**
-			* @brief G[̎擾
-			*
-			* @G[IDɉG[擾܂
-			*
-			* @param int32_t ErrorID G[ID
-			* @return const char* ErrorName G[
-			*/
-			inline constexpr const char* ErrorName(int32_t ID) { return ErrorInfo[ID].Name; }
-
-			/**
-			* @brief G[bZ[W̎擾
-			*
-			* @G[IDɉG[bZ[W擾܂
-			*
-			* @param int32_t ErrorID G[ID
-			* @return const char* ErrorMessage G[bZ[W
-			*/
-			inline constexpr const char* ErrorMessage(int32_t ID) { return ErrorInfo[ID].Message; }
-		}
-
-		struct T_ErrorHandle {
-		private:
-			T_ErrorHandle() = default;
-			~T_ErrorHandle() = default;
-			T_ErrorHandle(const T_ErrorHandle&) = delete;
-			T_ErrorHandle& operator=(const T_ErrorHandle&) = delete;
-
-		private:
-			struct T_ErrorList {
-			private:
-				const int32_t kErrorID;
-				const int32_t kErrorValue = 0;
-				const int32_t kErrorValue2 = 0;
-
-			public:
-				[[nodiscard]] int32_t ErrorID() const noexcept { return kErrorID; }
-				[[nodiscard]] int32_t ErrorValue() const noexcept { return kErrorValue; }
-				[[nodiscard]] int32_t ErrorValue2() const noexcept { return kErrorValue2; }
-				[[nodiscard]] const char* const ErrorName() const noexcept { return ErrorMessage::ErrorInfo[kErrorID].Name; }
-				[[nodiscard]] const char* const ErrorMessage() const noexcept { return ErrorMessage::ErrorInfo[kErrorID].Message; }
-
-				T_ErrorList(int32_t ErrorID)
-					: kErrorID(ErrorID) {
-				}
-
-				T_ErrorList(int32_t ErrorID, int32_t ErrorValue)
-					: kErrorID(ErrorID), kErrorValue(ErrorValue) {
-				}
-
-				T_ErrorList(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo)
-					: kErrorID(ErrorID), kErrorValue(GroupNo), kErrorValue2(ItemNo) {
-				}
-			};
-			std::vector<T_ErrorList> ErrorList = {};
-
-			void InitErrorList() {
-				ErrorList.clear();
-			}
-
-		public:
-			[[nodiscard]] static T_ErrorHandle& Instance() {
-				static T_ErrorHandle instance;
-				return instance;
-			}
-
-		public:
-			void AddErrorList(int32_t ErrorID) {
-				ErrorList.emplace_back(T_ErrorList(ErrorID));
-			}
-
-			void AddErrorList(int32_t ErrorID, int32_t ErrorValue) {
-				ErrorList.emplace_back(T_ErrorList(ErrorID, ErrorValue));
-			}
-
-			void AddErrorList(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) {
-				ErrorList.emplace_back(T_ErrorList(ErrorID, GroupNo, ItemNo));
-			}
-
-			[[noreturn]] void ThrowError(int32_t ErrorID) const {
-				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
-			}
-
-			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t ErrorValue) const {
-				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
-			}
-
-			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) const {
-				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
-			}
-
-			void SetError(int32_t ErrorID) {
-				if (!T_Config::Instance().ThrowError()) {
-					AddErrorList(ErrorID);
-					return;
-				}
-				ThrowError(ErrorID);
-			}
-
-			void SetError(int32_t ErrorID, int32_t ErrorValue) {
-				if (!T_Config::Instance().ThrowError()) {
-					AddErrorList(ErrorID, ErrorValue);
-					return;
-				}
-				ThrowError(ErrorID, ErrorValue);
-			}
-
-			void SetError(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) {
-				if (!T_Config::Instance().ThrowError()) {
-					AddErrorList(ErrorID, GroupNo, ItemNo);
-					return;
-				}
-				ThrowError(ErrorID, GroupNo, ItemNo);
-			}
-
-			void WriteErrorLog(std::ofstream& File) {
-				File << "ReadSndFile ErrorLog" << "\n";
-				File << "G[: " << ErrorList.size() << "\n";
-
-				for (auto& Error : ErrorList) {
-					File << "\nG[: " << Error.ErrorName() << "\n";
-					File << "G[e: " << Error.ErrorMessage() << "\n";
-					if (Error.ErrorID() == ErrorMessage::Warning_DuplicateSoundNumber || Error.ErrorID() == ErrorMessage::NotFound_SoundNumber) {
-						File << "G[l: " << Error.ErrorValue() << "-" << Error.ErrorValue2() << "\n";
-					}
-					if (Error.ErrorID() == ErrorMessage::NotFound_SoundIndex) {
-						File << "G[l: " << Error.ErrorValue() << "\n";
-					}
-				}
-				File.flush();
-
-				if (File.fail() || File.bad()) {
-					if (T_Config::Instance().ThrowError()) {
-						ThrowError(ErrorMessage::Failed_WriteErrorLogFile);
-					}
-				}
-				File.close();
-				if (File.fail() || File.bad()) {
-					if (T_Config::Instance().ThrowError()) {
-						ThrowError(ErrorMessage::Failed_CloseErrorLogFile);
-					}
-				}
-			}
-		};
-
-		// pX̕⏕
-		struct T_FilePathSystem {
-		private:
-			std::filesystem::path Path_ = {};
-			std::error_code ErrorCode_ = {};
-
-		public:
-			const std::filesystem::path& Path() const noexcept { return Path_; }
-			const std::error_code& ErrorCode() const noexcept { return ErrorCode_; }
-
-			void SetPath(const std::filesystem::path& Path) {
-				ErrorCode_.clear();
-				Path_ = weakly_canonical(std::filesystem::absolute(Path), ErrorCode_);
-				if (ErrorCode_) { Path_.clear(); }
-			}
-
-			void CreateDirectory(const std::filesystem::path& Path) {
-				ErrorCode_.clear();
-				if (std::filesystem::exists(Path)) { return; }
-				std::filesystem::create_directories(Path, ErrorCode_);
-
-			}
-
-		public:
-			T_FilePathSystem() = default;
-
-			T_FilePathSystem(const std::filesystem::path& Path) {
-				SetPath(Path);
-			}
-
-			[[nodiscard]] bool empty() const noexcept { return Path_.empty(); }
-		};
-		
-		// TEhXg̃TEhԍ̏d`FbN݊mF
-		template<typename T, typename = std::enable_if_t<std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>>>
-		struct T_UnorderedMap {
-		private:
-			std::unordered_map<T, int32_t> UnorderedMap = {};
-
-		public:
-			void Register(T value) {
-				UnorderedMap[value] = static_cast<int32_t>(UnorderedMap.size());
-			}
-
-			void Register(int32_t value1, int32_t value2) {
-				UnorderedMap[Convert::EncodeSoundNumber(value1, value2)] = static_cast<int32_t>(UnorderedMap.size());
-			}
-
-		public:
-			T_UnorderedMap() = default;
-
-			[[nodiscard]] int32_t find(T input) {
-				auto it = UnorderedMap.find(input);
-				if (it != UnorderedMap.end()) { return it->second; }
-				return -1;
-			}
-			[[nodiscard]] int32_t find(int32_t value1, int32_t value2) {
-				return find(Convert::EncodeSoundNumber(value1, value2));
-			}
-
-			[[nodiscard]] bool exist(T value) {
-				return find(value) >= 0;
-			}
-			[[nodiscard]] bool exist(int32_t value1, int32_t value2) {
-				return find(value1, value2) >= 0;
-			}
-
-			void reserve(ksize_t value) {
-				UnorderedMap.reserve(value);
-			}
-
-			void clear() {
-				UnorderedMap.clear();
-			}
-
-			void shrink_to_fit() {
-				UnorderedMap.rehash(0);
-			}
-
-			[[nodiscard]] bool empty() const noexcept {
-				return UnorderedMap.empty();
-			}
-
-			[[nodiscard]] ksize_t size() const noexcept {
-				return static_cast<ksize_t>(UnorderedMap.size());
-			}
-		};
-
-		struct T_ReadWAVEBinary {
-		private:
-			const std::vector<unsigned char>& kWAVEVector;
-			const ksize_t kSoundStart;
-			const ksize_t kSoundSize;
-			int32_t fmtChunkOffset = 0;
-			int32_t factChunkOffset = 0;
-			int32_t dataChunkOffset = 0;
-			int32_t SAECChunkOffset = 0;
-
-			inline static constexpr int32_t kRIFFChunkOffset = 0;
-			inline static constexpr int32_t kRIFFChunkDataSize = 12;
-
-			[[nodiscard]] const unsigned char* WAVEBinary() const noexcept { return kWAVEVector.data() + kSoundStart; }
-
-			struct WAVEFormat {
-				inline static constexpr std::string_view kRIFFSignature = "RIFF";
-				inline static constexpr std::string_view kFormatSignature = "WAVE";
-				inline static constexpr std::string_view kfmtSignature = "fmt ";
-				inline static constexpr std::string_view kfactSignature = "fact";
-				inline static constexpr std::string_view kdataSignature = "data";
-				inline static constexpr std::string_view kSAECSignature = "SAEC";
-			};
-
-			struct T_WAVERIFFChunk {
-			private:
-				const unsigned char* const ChunkData;
-
-			public:
-				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kRIFFSignature.size()); }
-				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
-				[[nodiscard]] std::string_view FormatSignature() const noexcept { return std::string_view(reinterpret_cast<const char*>(&ChunkData[8]), WAVEFormat::kFormatSignature.size()); }
-
-				T_WAVERIFFChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
-			};
-
-			struct T_WAVEfmtChunk {
-			private:
-				const unsigned char* const ChunkData;
-
-			public:
-				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kfmtSignature.size()); }
-				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
-
-				[[nodiscard]] uint16_t FormatTag() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[8]); }
-				[[nodiscard]] uint16_t Channels() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[10]); }
-				[[nodiscard]] uint32_t SamplesPerSec() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[12]); }
-				[[nodiscard]] uint32_t AvgBytesPerSec() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[16]); }
-				[[nodiscard]] uint16_t BlockAlign() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[20]); }
-				[[nodiscard]] uint16_t BitsPerSample() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[22]); }
-				[[nodiscard]] uint16_t cbSize() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[24]); }
-
-				T_WAVEfmtChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
-			};
-
-			struct T_WAVEfactChunk {
-			private:
-				const unsigned char* const ChunkData;
-
-			public:
-				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kfactSignature.size()); }
-				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
-				[[nodiscard]] uint32_t SampleLength() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[8]); }
-
-				T_WAVEfactChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
-			};
-
-			struct T_WAVEdataChunk {
-			private:
-				const unsigned char* const ChunkData;
-
-			public:
-				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kdataSignature.size()); }
-				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
-
-				T_WAVEdataChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
-			};
-
-			struct T_WAVESAECChunk {
-			private:
-				const unsigned char* const ChunkData;
-
-			public:
-				[[nodiscard]] bool IsDummy() const noexcept { return ChunkData == ReadSndFileFormat::kDummyBinaryData; }
-				[[nodiscard]] std::string_view Signature() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyStringView : std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kdataSignature.size())); }
-				[[nodiscard]] uint32_t ChunkSize() const noexcept { return (IsDummy() ? 0 : DecodeEndian::UInt32LE(&ChunkData[4])); }
-				[[nodiscard]] const unsigned char* Comment() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyBinaryData : &ChunkData[8]); }
-
-				T_WAVESAECChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
-			};
-
-			[[nodiscard]] bool CheckWAVEFormat() const noexcept {
-				if (RIFFChunk().Signature() != WAVEFormat::kRIFFSignature) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_RIFFSignature);
-					return false;
-				}
-				if (RIFFChunk().FormatSignature() != WAVEFormat::kFormatSignature) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_WAVEFormat);
-					return false;
-				}
-				return true;
-			}
-
-		public:
-			[[nodiscard]] ksize_t SoundStart() const noexcept { return kSoundStart; }
-			[[nodiscard]] ksize_t SoundSize() const noexcept { return kSoundSize; }
-			[[nodiscard]] T_WAVERIFFChunk RIFFChunk() const noexcept { return T_WAVERIFFChunk(&WAVEBinary()[kRIFFChunkOffset]); }
-			[[nodiscard]] T_WAVEfmtChunk fmtChunk() const noexcept { return T_WAVEfmtChunk(&WAVEBinary()[fmtChunkOffset]); }
-			[[nodiscard]] T_WAVEfactChunk factChunk() const noexcept { return T_WAVEfactChunk(&WAVEBinary()[factChunkOffset]); }
-			[[nodiscard]] T_WAVEdataChunk dataChunk() const noexcept { return T_WAVEdataChunk(&WAVEBinary()[dataChunkOffset]); }
-			[[nodiscard]] T_WAVESAECChunk SAECChunk() const noexcept { return T_WAVESAECChunk(!SAECChunkOffset ? ReadSndFileFormat::kDummyBinaryData : &WAVEBinary()[SAECChunkOffset]); }
-
-			T_ReadWAVEBinary(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize) : kWAVEVector(WAVEVector), kSoundStart(static_cast<ksize_t>(WAVEVector.size() - SoundSize)), kSoundSize(SoundSize) {
-				ReadWAVEBinary();
-			}
-
-			void ReadWAVEBinary() {
-				if (!CheckWAVEFormat()) { return; }
-
-				int32_t BinaryOffset = kRIFFChunkDataSize;
-				auto TargetChunk = [this, &BinaryOffset]() -> const unsigned char* const { return &WAVEBinary()[BinaryOffset]; };
-				auto TargetSignature = [&TargetChunk]() -> std::string_view { return std::string_view(reinterpret_cast<const char*>(TargetChunk()), 4); };
-				auto TargetChunkSize = [&TargetChunk]() -> uint32_t { return DecodeEndian::UInt32LE(&TargetChunk()[4]); };
-				auto NextTargetChunk = [&TargetChunkSize]() -> uint32_t { return TargetChunkSize() + 8 + (TargetChunkSize() & 1); };
-
-				while (static_cast<ksize_t>(BinaryOffset) < kSoundSize && TargetChunkSize() >= 0) {
-					if (TargetSignature() == WAVEFormat::kfmtSignature) {
-
-						fmtChunkOffset = BinaryOffset;
-					}
-					else if (TargetSignature() == WAVEFormat::kfactSignature) {
-
-						factChunkOffset = BinaryOffset;
-					}
-					else if (TargetSignature() == WAVEFormat::kdataSignature) {
-
-						dataChunkOffset = BinaryOffset;
-					}
-					else if (TargetSignature() == WAVEFormat::kSAECSignature) {
-
-						SAECChunkOffset = BinaryOffset;
-					}
-					BinaryOffset += NextTargetChunk();
-				}
-			}
-		};
-
-		struct T_SNDBinaryData {
-		private:
-			struct T_SoundList {
-			private:
-				const T_ReadWAVEBinary kWAVEBinary;
-			public:
-				[[nodiscard]] ksize_t SoundStart() const noexcept { return kWAVEBinary.SoundStart(); }
-				[[nodiscard]] ksize_t SoundSize() const noexcept { return kWAVEBinary.SoundSize(); }
-				[[nodiscard]] const T_ReadWAVEBinary& WAVEBinary() const noexcept { return kWAVEBinary; }
-
-				T_SoundList(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize)
-					: kWAVEBinary(WAVEVector, SoundSize) {
-				}
-			};
-
-			struct T_DataList {
-			private:
-				const ksize_t kSoundListIndex;	// zIndex
-				const int64_t kSoundNumber;		// GroupNo(-2147483648`2147483647) ItemNo(-2147483648`2147483647)
-			public:
-				[[nodiscard]] ksize_t SoundListIndex() const noexcept { return kSoundListIndex; }
-				[[nodiscard]] int32_t GroupNo() const noexcept { return Convert::DecodeSoundGroupNo(kSoundNumber); }
-				[[nodiscard]] int32_t ItemNo() const noexcept { return Convert::DecodeSoundItemNo(kSoundNumber); }
-
-				T_DataList(ksize_t SoundListIndex, int32_t GroupNo, int32_t ItemNo) noexcept
-					: kSoundListIndex(SoundListIndex)
-					, kSoundNumber(Convert::EncodeSoundNumber(GroupNo, ItemNo)) {
-				}
-			};
-
-			std::vector<T_SoundList> SoundList_ = {};
-			std::vector<T_DataList> DataList_ = {};
-			std::vector<unsigned char> SoundBinary_ = {};
-
-		public:
-			[[nodiscard]] const std::vector<T_SoundList>& SoundList() const noexcept { return SoundList_; }
-			[[nodiscard]] const std::vector<T_DataList>& DataList() const noexcept { return DataList_; }
-			[[nodiscard]] const std::vector<unsigned char>& SoundBinary() const noexcept { return SoundBinary_; }
-			[[nodiscard]] const T_SoundList& SoundList(ksize_t index) const noexcept { return SoundList_[index]; }
-			[[nodiscard]] const T_DataList& DataList(ksize_t index) const noexcept { return DataList_[index]; }
-			[[nodiscard]] ksize_t NumSound() const noexcept { return static_cast<ksize_t>(SoundList_.size()); }
-			
-			[[nodiscard]] const unsigned char* const Sound(ksize_t index) const noexcept {
-				return SoundBinary_.data() + SoundList_[index].SoundStart();
-			}
-
-			[[nodiscard]] ksize_t SoundSize(ksize_t index) const noexcept {
-				return SoundList_[index].SoundSize();
-			}
-
-			void AddDataList(ksize_t SoundListIndex, int32_t GroupNo, int32_t ItemNo) {
-				DataList_.emplace_back(T_DataList(SoundListIndex, GroupNo, ItemNo));
-			}
-
-			void AddSound(const std::vector<unsigned char>& LoadSoundData) {
-				SoundBinary_.insert(SoundBinary_.end(), LoadSoundData.begin(), LoadSoundData.end());
-				SoundList_.emplace_back(T_SoundList(SoundBinary_, static_cast<ksize_t>(LoadSoundData.size())));
-			}
-
-		public:
-			T_SNDBinaryData() = default;
-
-			void reserve(ksize_t NumSound, ksize_t FileSize) {
-				SoundList_.reserve(NumSound);
-				DataList_.reserve(NumSound);
-				SoundBinary_.reserve(FileSize);
-			}
-
-			void clear() {
-				SoundList_.clear();
-				DataList_.clear();
-				SoundBinary_.clear();
-			}
-
-			void shrink_to_fit() {
-				SoundList_.shrink_to_fit();
-				DataList_.shrink_to_fit();
-			}
-
-			[[nodiscard]] bool empty() const noexcept {
-				return SoundList_.empty() && DataList_.empty() && SoundBinary_.empty();
-			}
-
-			[[nodiscard]] ksize_t size() const noexcept {
-				return static_cast<ksize_t>(SoundBinary_.size());
-			}
-		};
-
-		struct T_LoadSNDHeader {
-		private:
-			const std::string kFileName = {};
-			const std::string kFilePath = {};
-			const uintmax_t kFileSize = 0;
-			std::ifstream File = {};
-			unsigned char buffer[24] = {};
-			const bool kCheckError = false;
-			// 0`11 ʎq("ElecbyteSnd")
-			// 12` C
-			// 24` Rg
-
-			[[nodiscard]] const std::string EnsureSndExtension(const std::filesystem::path& FileName) const {
-				std::filesystem::path FixedFileName = FileName;
-				if (FixedFileName.extension() != SNDFormat::kExtension) {
-					if (!FixedFileName.extension().empty()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDExtension);
-					}
-					FixedFileName.replace_extension(SNDFormat::kExtension);
-				}
-				return FixedFileName.string();
-			}
-
-			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath) const {
-				T_FilePathSystem SNDFolder;
-				if (!FilePath.empty()) {
-					SNDFolder.SetPath(FilePath);
-					if (SNDFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_LoadSNDPath);
-					}
-				}
-				if (FilePath.empty() || SNDFolder.ErrorCode() && !T_Config::Instance().SNDSearchPath().empty()) {
-					SNDFolder.SetPath(T_Config::Instance().SNDSearchPath());
-					if (SNDFolder.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSearchPath);
-					}
-				}
-				const std::filesystem::path AbsolutePath = (std::filesystem::exists(SNDFolder.Path()) ? SNDFolder.Path() : std::filesystem::canonical(std::filesystem::current_path()));
-
-				for (const auto& entry : std::filesystem::recursive_directory_iterator(
-					AbsolutePath, std::filesystem::directory_options::skip_permission_denied)) {
-					if (!entry.is_regular_file()) { continue; }
-					if (entry.path().filename() == kFileName) {
-						return entry.path().string();
-					}
-				}
-
-				T_ErrorHandle::Instance().SetError(ErrorMessage::NotFound_SNDFile);
-				return {};
-			}
-
-			[[nodiscard]] bool CheckFileSize() const {
-				if (kFileSize <= UINT32_MAX) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDFileSize);
-				return true;
-			}
-			[[nodiscard]] bool CheckFilePath() const {
-				if (!FilePath().empty()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_EmptySNDFilePath);
-				return true;
-			}
-			[[nodiscard]] bool CheckFileOpen() {
-				File.open(FilePath(), std::ios::binary);
-				if (File.is_open()) { return false; }
-				T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_OpenSNDFile);
-				return true;
-			}
-
-			[[nodiscard]] bool CheckSNDFormat() {
-				// t@Cǂݎ肪ނ̂ňꂩɂ܂Ƃ߂
-				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
-
-				if (Signature() != SNDFormat::kSignature) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSignature);
-					return true;
-				}
-				
-				if (SubHeaderStart() != SNDFormat::kSubHeaderStart) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
-					return true;
-				}
-				return false;
-			}
-
-			[[nodiscard]] bool CheckFileError() { // CheckFileOpen  CheckSNDFormat ̏Ŏs
-				return CheckFileSize() || CheckFilePath() || CheckFileOpen() || CheckSNDFormat();
-			}
-
-		public:
-			[[nodiscard]] const std::string& FileName() const noexcept { return kFileName; }
-			[[nodiscard]] const std::string& FilePath() const noexcept { return kFilePath; }
-			[[nodiscard]] ksize_t FileSize() const noexcept { return static_cast<ksize_t>(kFileSize); }
-			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(buffer), SNDFormat::kSignature.size()); }
-			[[nodiscard]] uint32_t Version() const noexcept { return DecodeEndian::UInt32BE(&buffer[12]); }
-			[[nodiscard]] uint32_t NumSound() const noexcept { return DecodeEndian::UInt32LE(&buffer[16]); }
-			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeEndian::UInt32LE(&buffer[20]); }
-			[[nodiscard]] bool CheckError() const noexcept { return kCheckError; }
-
-		public:
-			T_LoadSNDHeader(const std::string& FileName, const std::string& FilePath)
-				: kFileName(EnsureSndExtension(FileName)), kFilePath(FindFilePathDown(FilePath))
-				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kCheckError(CheckFileError()) {
-			}
-
-			void seekg(std::streampos& _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
-				File.seekg(_Pos, _Way);
-			}
-			void seekg(uint32_t _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
-				File.seekg(_Pos, _Way);
-			}
-
-			void read(char* _Str, std::streamsize _Count) {
-				File.read(_Str, _Count);
-			}
-
-			[[nodiscard]] std::streampos tellg() {
-				return File.tellg();
-			}
-		};
-
-		// SNDǂݍݎ̃Tuwb_[i[
-		struct T_LoadSNDSubHeader {
-		private:
-			unsigned char buffer[16] = {}; // v̏̂݊i[
-			// 0`16 C
-			// 17`  WAVEf[^
-			T_LoadSNDHeader& File;
-			std::vector<unsigned char> WAVEBinary = {};
-
-			void InitLoadSNDSubHeader() {
-				File.seekg(File.SubHeaderStart());
-			}
-
-			[[nodiscard]] bool CheckReadError() { // f[^̖ɓBorAhXsȒl
-				return !NextAddress() || NextAddress() < File.tellg();
-			}
-
-			[[nodiscard]] bool ReadSubHeader() {
-				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
-				return CheckReadError();
-			}
-
-		public:
-			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeEndian::UInt32LE(&buffer[0]); }
-			[[nodiscard]] uint32_t DataSize() const noexcept { return DecodeEndian::UInt32LE(&buffer[4]); }
-			[[nodiscard]] uint32_t GroupNo() const noexcept { return DecodeEndian::UInt32LE(&buffer[8]); }
-			[[nodiscard]] uint32_t ItemNo() const noexcept { return DecodeEndian::UInt32LE(&buffer[12]); }
-			[[nodiscard]] bool CheckError() { return false; } // vȂ̂ŕۗ
-
-		public:
-			T_LoadSNDSubHeader(T_LoadSNDHeader& LoadSNDHeader) : File(LoadSNDHeader) {
-				InitLoadSNDSubHeader();
-			}
-
-			[[nodiscard]] bool ReadSoundBinary(T_UnorderedMap<int64_t>& SoundNumberUMap, T_UnorderedMap<int32_t>& SoundGroupNoUMap, T_SNDBinaryData& SNDBinaryData) {
-				if (ReadSubHeader()) { return true; }
-
-				// 擾TEhԍd
-				if (SoundNumberUMap.exist(GroupNo(), ItemNo())) {
-					T_ErrorHandle::Instance().SetError(ErrorMessage::Warning_DuplicateSoundNumber, GroupNo(), ItemNo());
-					File.seekg(NextAddress());
-					return false;
-				}
-
-				SoundNumberUMap.Register(GroupNo(), ItemNo());
-
-				// O[v̎擾p
-				if (!SoundGroupNoUMap.exist(GroupNo())) {
-					SoundGroupNoUMap.Register(GroupNo());
-				}
-
-				// TEhf[^ꎞۑ
-				WAVEBinary.resize(DataSize());
-				File.read(reinterpret_cast<char*>(WAVEBinary.data()), WAVEBinary.size());
-
-				ksize_t SoundListIndex = 0;
-				bool FoundSoundData = false;
-
-				// TEhf[^d`FbN
-				for (SoundListIndex = 0; SoundListIndex < SNDBinaryData.NumSound(); ++SoundListIndex) {
-					// ̃TEhf[^̏ꍇ̓CfbNXw
-					if (SNDBinaryData.SoundSize(SoundListIndex) == WAVEBinary.size() && !std::memcmp(SNDBinaryData.Sound(SoundListIndex), WAVEBinary.data(), WAVEBinary.size())) {
-						FoundSoundData = true;
-						break;
-					}
-
-				}
-				// VKTEh̏ꍇ̓TEhf[^i[
-				if (!FoundSoundData) {
-					SoundListIndex = static_cast<ksize_t>(SNDBinaryData.SoundList().size());
-					SNDBinaryData.AddSound(WAVEBinary);
-				}
-
-				SNDBinaryData.AddDataList(SoundListIndex, GroupNo(), ItemNo());
-
-				File.seekg(NextAddress());
-				
-				return false;
-			}
-		};
-
-		struct T_SNDData {
-			int32_t NumGroup_ = 0;
-			int32_t NumItem_ = 0;
-			std::string FileName_ = {};
-			T_UnorderedMap<int64_t> SoundNumberUMap = {};
-			T_UnorderedMap<int32_t> SoundGroupNoUMap = {};
-			T_SNDBinaryData SNDBinaryData = {};
-
-			void NumGroup(int32_t value) noexcept { NumGroup_ = value; }
-			void NumItem(int32_t value) noexcept { NumItem_ = value; }
-			void FileName(const std::string& value) noexcept { FileName_ = value; }
-
-			void ReserveData(T_LoadSNDHeader& LoadSNDHeader) {
-				const ksize_t kNumSound = LoadSNDHeader.NumSound();
-				const ksize_t kFileSize = LoadSNDHeader.FileSize();
-
-				SoundNumberUMap.reserve(kNumSound);
-				SoundGroupNoUMap.reserve(kNumSound);
-				SNDBinaryData.reserve(kNumSound, kFileSize);
-			}
-
-			void shrink_to_fit() {
-				SoundNumberUMap.shrink_to_fit();
-				SoundGroupNoUMap.shrink_to_fit();
-				SNDBinaryData.shrink_to_fit();
-			}
-
-			bool LoadSNDFile(const std::string& FileName_, const std::string& FilePath_) {
-				if (!empty()) { clear(); }
-				T_LoadSNDHeader LoadSNDHeader(FileName_, FilePath_);
-				if (LoadSNDHeader.CheckError()) { return false; }
-				T_LoadSNDSubHeader LoadSNDSubHeader(LoadSNDHeader);
-				if (LoadSNDSubHeader.CheckError()) { return false; }
-
-				NumItem(LoadSNDHeader.NumSound());
-				FileName(LoadSNDHeader.FileName());
-				ReserveData(LoadSNDHeader);
-				
-				for (int32_t LoadNo = 0; LoadNo < NumItem(); ++LoadNo) {
-					if (LoadSNDSubHeader.ReadSoundBinary(SoundNumberUMap, SoundGroupNoUMap, SNDBinaryData)) { break; };
-				}
-				NumGroup(static_cast<int32_t>(SoundGroupNoUMap.size()));
-			
-				// SẴ[hI]Ɋmۂ
-				shrink_to_fit();
-
-				// Oo
-				if (T_Config::Instance().CreateLogFile()) {
-					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSndFileFormat::kSystemDirectoryName : ""));
-					if (SAELibFile.ErrorCode()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SAELibFolderPath);
-						return false;
-					}
-					if (T_Config::Instance().CreateSAELibFile()) {
-						SAELibFile.CreateDirectory(SAELibFile.Path());
-						if (SAELibFile.ErrorCode()) {
-							T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateSAELibFolder);
-							return false;
-						}
-					}
-
-					const std::string ErrorLogFileName = std::string(ReadSndFileFormat::kErrorLogFileName) + "_" + FileName() + ".txt";
-					std::ofstream ErrorLogFile(SAELibFile.Path() / ErrorLogFileName);
-					if (!ErrorLogFile.is_open()) {
-						T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateErrorLogFile);
-					}
-					T_ErrorHandle::Instance().WriteErrorLog(ErrorLogFile);
-				}
-
-				return true;
-			}
-
-			// [U[T_DataListANZXi
-			struct T_AccessData {
-			private:
-				const T_SNDBinaryData* const kSNDBinaryDataPtr;
-				const ksize_t kDataListIndex; // zIndex(ől̂Ƃ_~[f[^tOƂĎgp)
-
-				const auto& DataListRef() const noexcept { return kSNDBinaryDataPtr->DataList(kDataListIndex); }
-				const auto& WAVEBinaryRef() const noexcept { return kSNDBinaryDataPtr->SoundList(DataListRef().SoundListIndex()).WAVEBinary(); }
-
-				// SAEŕ\t[b̎Zop萔
-				inline static constexpr double kFramesPerSecond = 60.0;
-
-			public:
-				/**
-				* @brief _~[f[^f
-				*
-				* @g_~[f[^ł邩mF܂
-				*
-				* @SNDConfig::SetThrowError̐ݒ肪OFF̏ꍇɃG[̂߂Ɏgp܂
-				*
-				* @return bool (false = gȃf[^Ftrue = g_~[f[^)
-				*/
-				bool IsDummy() const noexcept { return kDataListIndex == KSIZE_MAX; }
-
-				/**
-				* @brief O[vԍ̎擾
-				*
-				* @Ώۉ̃O[vԍԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t GroupNo O[vԍ
-				*/
-				int32_t GroupNo() const noexcept { return (IsDummy() ? 0 : DataListRef().GroupNo()); }
-
-				/**
-				* @brief ACeԍ̎擾
-				*
-				* @Ώۉ̃ACeԍԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t ImageNo ACeԍ
-				*/
-				int32_t ItemNo() const noexcept { return (IsDummy() ? 0 : DataListRef().ItemNo()); }
-
-				/**
-				* @brief oCgTCY̎擾
-				*
-				* @Ώۉ̃oCgTCYԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t ByteSize oCgTCY
-				*/
-				int32_t ByteSize() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(WAVEBinaryRef().dataChunk().ChunkSize())); }
-
-				/**
-				* @brief `l̎擾
-				*
-				* @Ώۉ̃`lԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t Channel `l
-				*/
-				int32_t Channel() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(WAVEBinaryRef().fmtChunk().Channels())); }
-
-				/**
-				* @brief wc̎擾
-				*
-				* @Ώۉ̃wcԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t Hz wc
-				*/
-				int32_t Hz() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(WAVEBinaryRef().fmtChunk().SamplesPerSec())); }
-
-				/**
-				* @brief rbg̎擾
-				*
-				* @Ώۉ̃rbgԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return int32_t Bit rbg
-				*/
-				int32_t Bit() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(WAVEBinaryRef().fmtChunk().BitsPerSample())); }
-
-				/**
-				* @brief Tvb̎擾
-				*
-				* @Ώۉ̃TvbԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return double SampleRate Tvb
-				*/
-				double SampleRate() const noexcept { return (IsDummy() ? 0 : double(ByteSize()) / double(WAVEBinaryRef().fmtChunk().AvgBytesPerSec())); }
-				
-				/**
-				* @brief t[b̎擾
-				*
-				* @Ώۉ̃t[bԂ܂
-				*
-				* @_~[f[^̏ꍇ 0 Ԃ܂
-				*
-				* @return double SampleFrame t[b
-				*/
-				double SampleFrame() const noexcept { return (IsDummy() ? 0 : SampleRate() * kFramesPerSecond); }
-
-				/**
-				* @brief Rg̎擾
-				*
-				* @SAEŐݒ肳ꂽΏۉ̃RgԂ܂
-				*
-				* @_~[f[^̏ꍇ DummyBinaryData Ԃ܂
-				* 
-				* @DummyBinaryData ͏ɒ1̔zœe {0} ł
-				*
-				* @return const unsigned char* const Comment Rgf[^z
-				* @retval const unsigned char* const DummyBinaryData _~[f[^z
-				*/
-				const unsigned char* Comment() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyBinaryData : WAVEBinaryRef().SAECChunk().Comment()); }
-
-				T_AccessData(const T_SNDBinaryData* const SNDBinaryDataPtr, const ksize_t DataListIndex) : kSNDBinaryDataPtr(SNDBinaryDataPtr), kDataListIndex(DataListIndex) {}
-			};
-
-		public:
-			/**
-			* @brief SNDf[^̃TEhO[v擾
-			*
-			* @ǂݍSNDf[^̃TEhO[vԂ܂
-			*
-			* @return int32_t NumGroup TEhO[v
-			*/
-			int32_t NumGroup() const noexcept { return NumGroup_; }
-
-			/**
-			* @brief SNDf[^̃TEhf[^擾
-			*
-			* @ǂݍSNDf[^̑STEhf[^iACejԂ܂
-			*
-			* @return int32_t NumItem TEhf[^
-			*/
-			int32_t NumItem() const noexcept { return NumItem_; }
-
-			/**
-			* @brief SNDf[^̃t@C擾
-			*
-			* @ǂݍSNDf[^̊gqt@CԂ܂
-			*
-			* @return const std::string& FileName t@C
-			*/
-			const std::string& FileName() const noexcept { return FileName_; }
-
-			/**
-			* @brief SNDf[^̏
-			*
-			* @ǂݍSNDf[^܂
-			*
-			* @note
-			*/
-			void clear() {
-				NumGroup(0);
-				NumItem(0);
-				FileName_.clear();
-				SoundNumberUMap.clear();
-				SoundGroupNoUMap.clear();
-				SNDBinaryData.clear();
-			}
-
-			/**
-			* @brief SNDf[^̑݊mF
-			*
-			* @ǂݍSNDf[^̋󂩂𔻒肵܂
-			*
-			* @return bool 茋 (false = f[^݁Ftrue = f[^)
-			*/
-			bool empty() const noexcept {
-				return FileName().empty() && SNDBinaryData.empty() && SoundNumberUMap.empty() && SoundGroupNoUMap.empty();
-			}
-
-			/**
-			* @brief SNDf[^̃f[^TCY擾
-			*
-			* @ǂݍSNDf[^̃f[^TCYԂ܂
-			*
-			* @return size_t SNDDataSize SNDf[^TCY
-			*/
-			size_t size() const noexcept {
-				return SNDBinaryData.size();
-			}
-
-		public:
-			using SoundData = T_AccessData;
-
-			T_SNDData() = default;
-
-			T_SNDData(const std::string& FileName, const std::string& FilePath = "")
-			{
-				LoadSNDFile(FileName, FilePath);
-			}
-
-			/**
-			* @brief w肳ꂽSNDt@Cǂݍ
-			*
-			* @st@CqKwփt@Cēǂݍ݂܂
-			*
-			* @w莞͎w肵Kwt@C܂(SNDConfigD悳܂)
-			*
-			* @sɊ̗vf͏A㏑܂
-			*
-			* @param const std::string& FileName t@C (gq .snd ͏ȗ)
-			* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
-			* @return bool ǂݍ݌ (false = sFtrue = )
-			*/
-			bool LoadSND(const std::string& FileName, const std::string& FilePath = "") {
-				return LoadSNDFile(FileName, FilePath);
-			}
-
-			/**
-			* @brief wԍ̑݊mF
-			*
-			* @ǂݍSNDf[^Awԍ݂邩mF܂
-			*
-			* @param int32_t GroupNo O[vԍ
-			* @param int32_t ItemNo ACeԍ
-			* @return bool  (false = ݂Ȃ : true = ݂)
-			*/
-			bool ExistSoundNumber(int32_t GroupNo, int32_t ItemNo) {
-				return SoundNumberUMap.exist(GroupNo, ItemNo);
-			}
-
-			/**
-			* @brief wԍ̃f[^փANZX
-			*
-			* @w肵O[vԍƃACeԍSNDf[^փANZX܂
-			*
-			* @Ώۂ݂ȂꍇSNDConfig::SetThrowError̐ݒɏ܂
-			*
-			* @param int32_t GroupNo O[vԍ
-			* @param int32_t ItemNo ACeԍ
-			* @retval Ώۂ݂ SoundData
-			* @retval Ώۂ݂Ȃ SNDConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
-			*/
-			SoundData GetSoundData(int32_t GroupNo, int32_t ItemNo) {
-				if (ExistSoundNumber(GroupNo, ItemNo)) {
-					return SoundData(&SNDBinaryData, SoundNumberUMap.find(GroupNo, ItemNo));
-				}
-				if (!T_Config::Instance().ThrowError()) {
-					return SoundData(&SNDBinaryData, KSIZE_MAX);
-				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundNumber, GroupNo, ItemNo);
-			}
-
-			/**
-			* @brief wCfbNXf[^̑݊mF
-			*
-			* @ǂݍSNDf[^AwCfbNX̃f[^݂邩mF܂
-			*
-			* @param int32_t index f[^zCfbNX
-			* @return bool  (false = ݂Ȃ : true = ݂)
-			*/
-			bool ExistSoundDataIndex(int32_t SoundDataIndex) const {
-				return static_cast<ksize_t>(SoundDataIndex) < SoundNumberUMap.size();
-			}
-
-			/**
-			* @brief wCfbNX̃f[^փANZX
-			*
-			* @SNDf[^֎w肵CfbNXŃANZX܂
-			*
-			* @Ώۂ݂ȂꍇSNDConfig::SetThrowError̐ݒɏ܂
-			*
-			* @param int32_t index f[^zCfbNX
-			* @retval Ώۂ݂ SoundData
-			* @retval Ώۂ݂Ȃ SNDConfig::SetThrowError (false = _~[f[^̎QƁFtrue = O𓊂)
-			*/
-			SoundData GetSoundDataIndex(int32_t index) const {
-				if (ExistSoundDataIndex(index)) {
-					return SoundData(&SNDBinaryData, index);
-				}
-				if (!T_Config::Instance().ThrowError()) {
-					return SoundData(&SNDBinaryData, KSIZE_MAX);
-				}
-				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundIndex, index);
-			}
-
-		}; // struct T_SNDData
-	} // ReadSndFile_detail
-
-	// gp[U[̖Oݒ
-
-	/**
-	* @brief SNDt@CNX
-	*
-	* @- RXgN^̈w肵ꍇAw肵LoadSND֐s܂
-	*
-	* @- w肵ȂꍇAt@Cǂݍ݂͍s܂
-	*
-	* @param const std::string& FileName t@C (gq .snd ͏ȗ)
-	* @param const std::string& FilePath Ώۂ̃pX (ȗ͎st@C̎qKwT)
-	*/
-	using SND = ReadSndFile_detail::T_SNDData;
-
-	/**
-	* @brief ReadSndFilẽG[
-	*/
-	namespace SNDError = ReadSndFile_detail::ErrorMessage;
-
-	/**
-	* @brief ReadSndFilẽRtBOݒ
-	*/
-	namespace SNDConfig {
-
-		///////////////////////////////////////////////////////////////////////////////////////////////////
-		// Setter /////////////////////////////////////////////////////////////////////////////////////////
-		///////////////////////////////////////////////////////////////////////////////////////////////////
-		/**
-		* @brief G[o͂̐؂ւݒ
-		*
-		* @̃Cu֐ŔG[OƂē邩OƂċL^邩wł܂
-		*
-		* @param bool flag (false = OƂċL^Ftrue = O𓊂)
-		*/
-		inline void SetThrowError(bool flag) { ReadSndFile_detail::T_Config::Instance().ThrowError(flag); }
-
-		/**
-		* @brief G[Ot@C쐬ݒ
-		*
-		* @̃Cu֐ŔG[̃Ot@Co͂邩ǂwł܂
-		*
-		* @param bool flag (false = Ot@Co͂ȂFtrue = Ot@Co͂)
-		*/
-		inline void SetCreateLogFile(bool flag) { ReadSndFile_detail::T_Config::Instance().CreateLogFile(flag); }
-
-		/**
-		* @brief SAELibtH_쐬ݒ
-		*
-		* @t@C̏o͐ƂSAELibt@Cgp邩wł܂
-		*
-		* @param bool flag (false = SAELibt@CgpȂFtrue = SAELibt@Cgp)
-		* @param const std::string& Path SAELibtH_쐬 (ȗ̓pX̐ݒȂ)
-		*/
-		inline void SetCreateSAELibFile(bool flag, const std::string& Path = "") {
-			ReadSndFile_detail::T_Config::Instance().CreateSAELibFile(flag);
-			if (!Path.empty()) {
-				ReadSndFile_detail::T_Config::Instance().SAELibFilePath(Path);
-			}
-		}
-
-		/**
-		* @brief SAELibtH_̃pXݒ
-		*
-		* @SAELibt@C̍쐬pXwł܂
-		*
-		* @param const std::string& Path SAELibtH_쐬
-		*/
-		inline void SetSAELibFilePath(const std::string& Path = "") { ReadSndFile_detail::T_Config::Instance().SAELibFilePath(Path); }
-
-		/**
-		* @brief SNDt@ČpXݒ
-		*
-		* @SNDt@Č̃pXwł܂
-		*
-		* @SNDRXgN^LoadSND֐Ō̃pXw肵ȂꍇA̐ݒ̃pXŌ܂
-		*
-		* @param const std::string& Path SNDt@Č̃pX
-		*/
-		inline void SetSNDSearchPath(const std::string& Path = "") { ReadSndFile_detail::T_Config::Instance().SNDSearchPath(Path); }
-
-		///////////////////////////////////////////////////////////////////////////////////////////////////
-		// Getter /////////////////////////////////////////////////////////////////////////////////////////
-		///////////////////////////////////////////////////////////////////////////////////////////////////
-		/**
-		* @brief G[o͐؂ւݒ擾
-		*
-		* @Configݒ̃G[o͐؂ւݒ擾܂
-		*
-		* @return bool G[ݒo͐؂ւݒ(false = OFFFtrue = ON)
-		*/
-		inline bool GetThrowError() { return ReadSndFile_detail::T_Config::Instance().ThrowError(); }
-
-		/**
-		* @brief G[Ot@C쐬ݒ擾
-		*
-		* @Configݒ̃G[Ot@C쐬ݒ擾܂
-		*
-		* @return bool G[Ot@C쐬ݒ(false = OFFFtrue = ON)
-		*/
-		inline bool GetCreateLogFile() { return ReadSndFile_detail::T_Config::Instance().CreateLogFile(); }
-
-		/**
-		* @brief SAELibtH_쐬ݒ擾
-		*
-		* @ConfigݒSAELibtH_쐬ݒ擾܂
-		*
-		* @return bool SAELibtH_쐬ݒ(false = OFFFtrue = ON)
-		*/
-		inline bool GetCreateSAELibFile() { return ReadSndFile_detail::T_Config::Instance().CreateSAELibFile(); }
-
-		/**
-		* @brief Configݒ擾
-		*
-		* @Configݒ̃tO܂Ƃ߂Ď擾܂
-		*
-		* @return int32_t Configݒ
-		*/
-		inline int32_t GetConfigFlag() { return ReadSndFile_detail::T_Config::Instance().BitFlag(); }
-
-		/**
-		* @brief SAELibtH_쐬pX擾
-		*
-		* @ConfigݒSAELibtH_쐬pX擾܂
-		*
-		* @return const std::filesystem::path& SAELibtH_쐬pX
-		*/
-		inline const std::filesystem::path& GetSAELibFilePath() { return ReadSndFile_detail::T_Config::Instance().SAELibFilePath(); }
-
-		/**
-		* @brief SNDt@ČpX擾
-		*
-		* @ConfigݒSNDt@ČpX擾܂
-		*
-		* @return const std::filesystem::path& SNDt@ČpX
-		*/
-		inline const std::filesystem::path& GetSNDSearchPath() { return ReadSndFile_detail::T_Config::Instance().SNDSearchPath(); }
-	}
-} // namespace SAELib
+#ifndef INCLUDEGUARD_READSNDFILE_HEADER
+#define INCLUDEGUARD_READSNDFILE_HEADER
+
+#include <stdint.h>			// uint32_tとかのやつ
+#include <string>			// string系のやつ
+#include <cstring>			// std::memcmpのやつ
+#include <string_view>		// std::string_viewのやつ
+#include <stdexcept>		// runtime_errorのやつ
+#include <fstream>			// ファイル読み取り
+#include <filesystem>		// ファイル検索
+#include <system_error>		// std::error_codeのやつ
+#include <vector>			// 可変長配列
+#include <unordered_map>	// ハッシュ的なやつ
+#include <type_traits>		// std::enable_ifのやつ
+#include <algorithm>		// std::stable_sortのやつ
+#include <memory>			// std::shared_ptrのやつ
+#include <mutex>			// std::mutexのやつ
+#include <thread>			// 並列処理
+#include <atomic>			// std::atomicのやつ
+#include <cmath>			// std::sqrtとかのやつ
+#include <limits>			// std::numeric_limitsのやつ
+#include <optional>			// std::optionalのやつ
+#include <functional>		// std::functionのやつ
+#include <future>			// 非同期読み込み
+#include <list>				// LRUのやつ
+#include <array>			// 変換表のやつ
+#include <utility>			// std::exchangeのやつ
+// OSのヘッダはページ固定(T_PageLock)、文字コード変換(TextEncoding)、スナップショットの共有メモリでのみ使用する
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define SAELIB_SND_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#define SAELIB_SND_UNDEF_NOMINMAX
+#endif
+#include <windows.h>		// VirtualLock、GetSystemInfo、MultiByteToWideChar、CreateFileMappingのやつ
+#ifdef SAELIB_SND_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef SAELIB_SND_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#ifdef SAELIB_SND_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef SAELIB_SND_UNDEF_NOMINMAX
+#endif
+#else
+#include <sys/mman.h>		// mlock(T_PageLock)、mmap(共有メモリ)のやつ
+#include <unistd.h>			// sysconf(T_PageLock)、ftruncate(共有メモリ)のやつ
+#include <sys/stat.h>		// fstat(共有メモリ)のやつ
+#include <fcntl.h>			// shm_open(共有メモリ)のやつ
+#include <iconv.h>			// iconv(TextEncoding)のやつ
+#include <cerrno>			// errno(TextEncoding)のやつ
+#endif
+
+namespace SAELib {
+	namespace ReadSndFile_detail {
+		using ksize_t = uint32_t;
+		inline constexpr ksize_t KSIZE_MAX = static_cast<ksize_t>(~ksize_t{ 0 });
+
+		namespace ReadSndFileFormat {
+			inline constexpr double kVersion = 1.00;
+			inline constexpr std::string_view kSystemDirectoryName = "SAELib";
+			inline constexpr std::string_view kErrorLogFileName = "SAELib_SndErrorLog";
+			inline constexpr std::string_view kWaveformFileName = "SAELib_SndWaveform";
+
+			inline constexpr unsigned char kDummyBinaryArray[1] = { 0 };
+			inline constexpr const unsigned char* kDummyBinaryData = kDummyBinaryArray;
+			inline constexpr std::string_view kDummyStringView = "";
+		};
+
+		namespace SNDFormat {
+			inline constexpr std::string_view kExtension = ".snd";
+			inline constexpr std::string_view kSignature = "ElecbyteSnd";
+			inline constexpr uint32_t kSNDVersion = 0x01000100;
+			inline constexpr uint32_t kSNDVersion2 = 0x00010001;
+			inline constexpr ksize_t kSubHeaderStart = 512;
+			inline constexpr ksize_t kFileSizeLimit = 0xffffffff;
+
+			// 圧縮SNDファイル(サウンドごとにLZ4ブロック形式で圧縮)
+			// 0～11 識別子("SAELibSndLZ4")
+			// 12～  バージョン、サウンド数、圧縮データ数
+			// 24～  サウンド索引(GroupNo, ItemNo, 圧縮データ番号)
+			// 以降  圧縮データ索引(開始位置, 圧縮サイズ, 展開サイズ)、圧縮データ
+			inline constexpr std::string_view kCompressedSignature = "SAELibSndLZ4";
+			inline constexpr uint32_t kCompressedVersion = 1;
+			inline constexpr ksize_t kCompressedHeaderSize = 24;
+			inline constexpr ksize_t kCompressedIndexSize = 12;
+		};
+
+		namespace WAVEFormatTag {
+			inline constexpr uint16_t kPCM = 0x0001;
+			inline constexpr uint16_t kMSADPCM = 0x0002;
+			inline constexpr uint16_t kIEEEFloat = 0x0003;
+			inline constexpr uint16_t kALaw = 0x0006;
+			inline constexpr uint16_t kMuLaw = 0x0007;
+			inline constexpr uint16_t kIMAADPCM = 0x0011;
+			inline constexpr uint16_t kExtensible = 0xfffe;
+		};
+
+		namespace DecodeEndian {
+			[[nodiscard]] inline constexpr uint16_t UInt16LE(const unsigned char* const buffer) noexcept {
+				return buffer[0] | (buffer[1] << 8);
+			}
+			[[nodiscard]] inline constexpr uint32_t UInt32LE(const unsigned char* const buffer) noexcept {
+				return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | (buffer[3] << 24);
+			}
+			[[nodiscard]] inline constexpr uint16_t UInt16BE(const unsigned char* const buffer) noexcept {
+				return buffer[1] | (buffer[0] << 8);
+			}
+			[[nodiscard]] inline constexpr uint64_t UInt64LE(const unsigned char* const buffer) noexcept {
+				return uint64_t{ UInt32LE(buffer) } | (uint64_t{ UInt32LE(&buffer[4]) } << 32);
+			}
+			[[nodiscard]] inline constexpr uint32_t UInt32BE(const unsigned char* const buffer) noexcept { //（未使用）
+				return buffer[3] | (buffer[2] << 8) | (buffer[1] << 16) | (buffer[0] << 24);
+			}
+		};
+
+		namespace EncodeEndian {
+			inline constexpr void UInt16LE(unsigned char* const buffer, uint16_t value) noexcept {
+				buffer[0] = static_cast<unsigned char>(value);
+				buffer[1] = static_cast<unsigned char>(value >> 8);
+			}
+			inline constexpr void UInt32LE(unsigned char* const buffer, uint32_t value) noexcept {
+				buffer[0] = static_cast<unsigned char>(value);
+				buffer[1] = static_cast<unsigned char>(value >> 8);
+				buffer[2] = static_cast<unsigned char>(value >> 16);
+				buffer[3] = static_cast<unsigned char>(value >> 24);
+			}
+			inline constexpr void UInt64LE(unsigned char* const buffer, uint64_t value) noexcept {
+				UInt32LE(buffer, static_cast<uint32_t>(value));
+				UInt32LE(&buffer[4], static_cast<uint32_t>(value >> 32));
+			}
+			inline constexpr void UInt32BE(unsigned char* const buffer, uint32_t value) noexcept {
+				buffer[0] = static_cast<unsigned char>(value >> 24);
+				buffer[1] = static_cast<unsigned char>(value >> 16);
+				buffer[2] = static_cast<unsigned char>(value >> 8);
+				buffer[3] = static_cast<unsigned char>(value);
+			}
+		};
+
+		namespace ContentHash {
+			inline constexpr uint64_t kFNVOffsetBasis = 0xcbf29ce484222325ULL;
+			inline constexpr uint64_t kFNVPrime = 0x00000100000001b3ULL;
+
+			// サウンドデータの内容比較用ハッシュ(FNV-1a 64bit)
+			// Hash に前回の結果を渡すと続きから計算する
+			[[nodiscard]] inline uint64_t FNV1a64(const unsigned char* const buffer, size_t size, uint64_t Hash = kFNVOffsetBasis) noexcept {
+				for (size_t i = 0; i < size; ++i) {
+					Hash = (Hash ^ buffer[i]) * kFNVPrime;
+				}
+				return Hash;
+			}
+
+			[[nodiscard]] inline constexpr std::array<uint32_t, 256> MakeCRC32Table() noexcept {
+				std::array<uint32_t, 256> Table = {};
+				for (uint32_t index = 0; index < 256; ++index) {
+					uint32_t value = index;
+					for (int32_t bit = 0; bit < 8; ++bit) { value = (value & 1 ? 0xedb88320u ^ (value >> 1) : value >> 1); }
+					Table[index] = value;
+				}
+				return Table;
+			}
+
+			inline constexpr std::array<uint32_t, 256> kCRC32Table = MakeCRC32Table();
+
+			// 外部ツールでの照合用のチェックサム(CRC-32、zlib や PNG と同じ多項式)
+			// CRC に前回の結果を渡すと続きから計算する
+			[[nodiscard]] inline uint32_t CRC32(const unsigned char* const buffer, size_t size, uint32_t CRC = 0) noexcept {
+				CRC = ~CRC;
+				for (size_t i = 0; i < size; ++i) {
+					CRC = kCRC32Table[(CRC ^ buffer[i]) & 0xff] ^ (CRC >> 8);
+				}
+				return ~CRC;
+			}
+		};
+
+		namespace Parallel {
+			// 0～Count-1 の処理を複数スレッドに分配する(Funcは例外を投げないこと)
+			template<typename Func>
+			inline void For(size_t Count, Func&& Function) {
+				const size_t NumThread = std::min<size_t>(Count, std::max(1u, std::thread::hardware_concurrency()));
+				if (NumThread <= 1) {
+					for (size_t index = 0; index < Count; ++index) { Function(index); }
+					return;
+				}
+
+				std::atomic<size_t> NextIndex = 0;
+				auto Worker = [&NextIndex, &Function, Count]() {
+					for (size_t index = NextIndex++; index < Count; index = NextIndex++) { Function(index); }
+				};
+				std::vector<std::thread> Threads;
+				Threads.reserve(NumThread - 1);
+				for (size_t ThreadNo = 1; ThreadNo < NumThread; ++ThreadNo) { Threads.emplace_back(Worker); }
+				Worker();
+				for (auto& Thread : Threads) { Thread.join(); }
+			}
+		};
+
+		namespace TextEncoding {
+			inline constexpr std::string_view kReplacementCharacter = "\xEF\xBF\xBD"; // U+FFFD
+
+			[[nodiscard]] inline bool IsASCII(std::string_view Text) noexcept {
+				return std::all_of(Text.begin(), Text.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+			}
+
+			// SAEのコメント(Shift_JIS / CP932)をUTF-8へ変換(変換できない文字は U+FFFD に置き換える)
+			[[nodiscard]] inline std::string CP932ToUTF8(std::string_view Text) {
+				if (IsASCII(Text)) { return std::string(Text); }
+#if defined(_WIN32)
+				const int WideSize = MultiByteToWideChar(932, 0, Text.data(), static_cast<int>(Text.size()), nullptr, 0);
+				if (WideSize <= 0) { return std::string(kReplacementCharacter); }
+				std::wstring Wide(static_cast<size_t>(WideSize), L'\0');
+				MultiByteToWideChar(932, 0, Text.data(), static_cast<int>(Text.size()), Wide.data(), WideSize);
+				const int UTF8Size = WideCharToMultiByte(CP_UTF8, 0, Wide.data(), WideSize, nullptr, 0, nullptr, nullptr);
+				std::string UTF8(static_cast<size_t>(std::max(UTF8Size, 0)), '\0');
+				WideCharToMultiByte(CP_UTF8, 0, Wide.data(), WideSize, UTF8.data(), UTF8Size, nullptr, nullptr);
+				return UTF8;
+#else
+				// 変換器の生成は重いためスレッドごとに使い回す
+				struct T_Converter {
+					iconv_t Handle = iconv_open("UTF-8", "CP932");
+					~T_Converter() { if (Handle != reinterpret_cast<iconv_t>(-1)) { iconv_close(Handle); } }
+				};
+				thread_local T_Converter Converter;
+				if (Converter.Handle == reinterpret_cast<iconv_t>(-1)) {
+					std::string UTF8;
+					for (char c : Text) { UTF8 += (static_cast<unsigned char>(c) < 0x80 ? std::string(1, c) : std::string(kReplacementCharacter)); }
+					return UTF8;
+				}
+				iconv(Converter.Handle, nullptr, nullptr, nullptr, nullptr);
+
+				std::string UTF8(Text.size() * 3 + 4, '\0');
+				char* Src = const_cast<char*>(Text.data());
+				size_t SrcLeft = Text.size();
+				char* Dst = UTF8.data();
+				size_t DstLeft = UTF8.size();
+				while (SrcLeft) {
+					if (iconv(Converter.Handle, &Src, &SrcLeft, &Dst, &DstLeft) != static_cast<size_t>(-1)) { break; }
+					if (errno != EILSEQ && errno != EINVAL) { break; }
+					// 不正なバイトは1バイトずつ読み飛ばす
+					if (DstLeft < kReplacementCharacter.size()) { break; }
+					std::memcpy(Dst, kReplacementCharacter.data(), kReplacementCharacter.size());
+					Dst += kReplacementCharacter.size();
+					DstLeft -= kReplacementCharacter.size();
+					++Src;
+					--SrcLeft;
+				}
+				UTF8.resize(UTF8.size() - DstLeft);
+				return UTF8;
+#endif
+			}
+		};
+
+		namespace LZ4Block {
+			inline constexpr size_t kMinMatch = 4;
+			inline constexpr size_t kLastLiterals = 5;
+			inline constexpr size_t kMFLimit = 12;
+			inline constexpr size_t kMaxOffset = 0xffff;
+			inline constexpr uint32_t kHashLog = 16;
+			inline constexpr size_t kRunMask = 15;
+
+			[[nodiscard]] inline uint32_t Read32(const unsigned char* const buffer) noexcept {
+				uint32_t value = 0;
+				std::memcpy(&value, buffer, sizeof(value));
+				return value;
+			}
+
+			[[nodiscard]] inline uint32_t Hash(uint32_t value) noexcept {
+				return (value * 2654435761u) >> (32 - kHashLog);
+			}
+
+			// 圧縮サイズから展開できる最大サイズ(圧縮データ1バイトあたり最大255バイトに展開される)
+			[[nodiscard]] inline constexpr uint64_t MaxDecompressedSize(uint64_t CompressedSize) noexcept {
+				return CompressedSize * 255 + 16;
+			}
+
+			inline void WriteLength(std::vector<unsigned char>& Dst, size_t Length) {
+				for (; Length >= 255; Length -= 255) { Dst.push_back(255); }
+				Dst.push_back(static_cast<unsigned char>(Length));
+			}
+
+			inline void WriteSequence(std::vector<unsigned char>& Dst, const unsigned char* const Literal, size_t LiteralLength, size_t MatchLength, size_t Offset) {
+				const bool IsLastSequence = !MatchLength;
+				const size_t MatchCode = (IsLastSequence ? 0 : MatchLength - kMinMatch);
+				Dst.push_back(static_cast<unsigned char>((std::min(LiteralLength, kRunMask) << 4) | std::min(MatchCode, kRunMask)));
+				if (LiteralLength >= kRunMask) { WriteLength(Dst, LiteralLength - kRunMask); }
+				Dst.insert(Dst.end(), Literal, Literal + LiteralLength);
+				if (IsLastSequence) { return; }
+
+				Dst.push_back(static_cast<unsigned char>(Offset));
+				Dst.push_back(static_cast<unsigned char>(Offset >> 8));
+				if (MatchCode >= kRunMask) { WriteLength(Dst, MatchCode - kRunMask); }
+			}
+
+			// LZ4ブロック形式で圧縮
+			[[nodiscard]] inline std::vector<unsigned char> Compress(const unsigned char* const Src, size_t SrcSize) {
+				std::vector<unsigned char> Dst;
+				Dst.reserve(SrcSize + SrcSize / 255 + 16);
+				std::vector<uint32_t> HashTable(size_t{ 1 } << kHashLog, 0);
+
+				size_t Anchor = 0;
+				if (SrcSize > kMFLimit) {
+					const size_t MatchLimit = SrcSize - kLastLiterals;
+					for (size_t Pos = 0; Pos + kMFLimit <= SrcSize;) {
+						const uint32_t Sequence = Read32(&Src[Pos]);
+						const uint32_t HashValue = Hash(Sequence);
+						const size_t Ref = HashTable[HashValue];
+						HashTable[HashValue] = static_cast<uint32_t>(Pos);
+
+						if (Ref >= Pos || Pos - Ref > kMaxOffset || Read32(&Src[Ref]) != Sequence) {
+							++Pos;
+							continue;
+						}
+						size_t MatchLength = kMinMatch;
+						while (Pos + MatchLength < MatchLimit && Src[Ref + MatchLength] == Src[Pos + MatchLength]) { ++MatchLength; }
+
+						WriteSequence(Dst, &Src[Anchor], Pos - Anchor, MatchLength, Pos - Ref);
+						Pos += MatchLength;
+						Anchor = Pos;
+					}
+				}
+				WriteSequence(Dst, &Src[Anchor], SrcSize - Anchor, 0, 0);
+				return Dst;
+			}
+
+			// LZ4ブロック形式を展開(不正なデータの場合は false)
+			[[nodiscard]] inline bool Decompress(const unsigned char* const Src, size_t SrcSize, unsigned char* const Dst, size_t DstSize) noexcept {
+				size_t SrcPos = 0;
+				size_t DstPos = 0;
+				auto ReadLength = [Src, SrcSize, &SrcPos](size_t& Length) -> bool {
+					unsigned char value = 255;
+					while (value == 255) {
+						if (SrcPos >= SrcSize) { return false; }
+						value = Src[SrcPos++];
+						Length += value;
+					}
+					return true;
+				};
+
+				while (SrcPos < SrcSize) {
+					const unsigned char Token = Src[SrcPos++];
+					size_t LiteralLength = Token >> 4;
+					if (LiteralLength == kRunMask && !ReadLength(LiteralLength)) { return false; }
+					if (LiteralLength > SrcSize - SrcPos || LiteralLength > DstSize - DstPos) { return false; }
+					std::memcpy(&Dst[DstPos], &Src[SrcPos], LiteralLength);
+					SrcPos += LiteralLength;
+					DstPos += LiteralLength;
+					if (SrcPos == SrcSize) { break; }
+
+					if (SrcSize - SrcPos < 2) { return false; }
+					const size_t Offset = DecodeEndian::UInt16LE(&Src[SrcPos]);
+					SrcPos += 2;
+					if (!Offset || Offset > DstPos) { return false; }
+
+					size_t MatchLength = Token & kRunMask;
+					if (MatchLength == kRunMask && !ReadLength(MatchLength)) { return false; }
+					MatchLength += kMinMatch;
+					if (MatchLength > DstSize - DstPos) { return false; }
+
+					// 一致範囲が重なる場合があるので1バイトずつ複製
+					for (size_t index = 0; index < MatchLength; ++index, ++DstPos) { Dst[DstPos] = Dst[DstPos - Offset]; }
+				}
+				return DstPos == DstSize;
+			}
+		};
+
+		template<typename T, typename = std::enable_if_t<std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>>>
+		struct T_Bit {
+		private:
+			const T kBitStart;
+			const T kBitRange;
+		public:
+			constexpr T_Bit(int32_t BitStart, T BitRange) : kBitStart(BitStart), kBitRange(BitRange) {}
+			[[nodiscard]] constexpr T BitStart() const noexcept { return kBitStart; }
+			[[nodiscard]] constexpr T BitRange() const noexcept { return kBitRange; }
+			[[nodiscard]] constexpr T BitMask() const noexcept { return kBitRange << kBitStart; }
+			[[nodiscard]] constexpr T BitSet(T Value) const noexcept { return (Value & kBitRange) << kBitStart; }
+			[[nodiscard]] constexpr T BitGet(T Value) const noexcept { return (Value >> kBitStart) & kBitRange; }
+		};
+
+		struct Convert {
+		private:
+			inline static constexpr T_Bit<int64_t> kSoundGroupNo = T_Bit<int64_t>(0, UINT32_MAX);
+			inline static constexpr T_Bit<int64_t> kSoundItemNo = T_Bit<int64_t>(32, UINT32_MAX);
+
+		public:
+			[[nodiscard]] inline static constexpr int64_t EncodeSoundNumber(int32_t GroupNo, int32_t ItemNo) noexcept {
+				return kSoundGroupNo.BitSet(GroupNo) | kSoundItemNo.BitSet(ItemNo);
+			}
+
+			[[nodiscard]] inline static constexpr int32_t DecodeSoundGroupNo(int64_t SoundNumber) noexcept { return static_cast<int32_t>(kSoundGroupNo.BitGet(SoundNumber)); }
+			[[nodiscard]] inline static constexpr int32_t DecodeSoundItemNo(int64_t SoundNumber) noexcept { return static_cast<int32_t>(kSoundItemNo.BitGet(SoundNumber)); }
+		};
+
+		struct T_Config {
+		private:
+			T_Config() = default;
+			~T_Config() = default;
+			T_Config(const T_Config&) = delete;
+			T_Config& operator=(const T_Config&) = delete;
+
+		private:
+			int32_t BitFlag_ = kDefaultConfig;
+			// ビットフラグ設定:
+			// bit 0 (0x01): このライブラリが例外を投げるか
+			// bit 1 (0x02): エラーログファイルを生成するか
+			// bit 2 (0x04): SAELibファイルを作成するか
+			// bit 3 (0x08): サウンドデータを複数のSNDで共有するか
+			// bit 4 (0x10): 読み込み時にコメントをUTF-8へ変換して保持するか
+			// bit 5 (0x20): 読み込み時にADPCMをPCMへ展開して保持するか
+			// bit 6 (0x40): 波形概要をSAELibフォルダへキャッシュするか
+			// bit 7 (0x80): 壊れたSNDファイルを読み取れる範囲で読み込むか
+			// bit 8 (0x100): 読み込み時にサウンドデータのCRC-32を求めて保持するか
+			// 
+			// SAELibファイルの生成パス指定
+			// SNDデータ検索開始ディレクトリパス指定
+			// 
+
+			inline static constexpr int32_t kThrowError = 1 << 0;
+			inline static constexpr int32_t kCreateLogFile = 1 << 1;
+			inline static constexpr int32_t kCreateSAELibFile = 1 << 2;
+			inline static constexpr int32_t kShareSoundPool = 1 << 3;
+			inline static constexpr int32_t kCommentUTF8 = 1 << 4;
+			inline static constexpr int32_t kDecodeOnLoad = 1 << 5;
+			inline static constexpr int32_t kWaveformCache = 1 << 6;
+			inline static constexpr int32_t kRecoverSND = 1 << 7;
+			inline static constexpr int32_t kPayloadCRC = 1 << 8;
+			inline static constexpr int32_t kDefaultConfig = kDecodeOnLoad;
+
+			// SAELibファイルのパス
+			std::filesystem::path SAELibFilePath_ = {};
+
+			// SNDファイル検索開始パス
+			std::filesystem::path SNDSearchPath_ = {};
+
+			// 整数のフレーム数で長さを求める際の1秒あたりのフレーム数
+			inline static constexpr uint32_t kDefaultTicksPerSecond = 60;
+			std::atomic<uint32_t> TicksPerSecond_ = kDefaultTicksPerSecond;
+
+		public:
+			[[nodiscard]] static T_Config& Instance() {
+				static T_Config instance;
+				return instance;
+			}
+
+		public:
+			[[nodiscard]] int32_t BitFlag() const noexcept { return BitFlag_; }
+			[[nodiscard]] bool ThrowError() const noexcept { return (BitFlag_ & kThrowError) != 0; }
+			[[nodiscard]] bool CreateLogFile() const noexcept { return (BitFlag_ & kCreateLogFile) != 0; }
+			[[nodiscard]] bool CreateSAELibFile() const noexcept { return (BitFlag_ & kCreateSAELibFile) != 0; }
+			[[nodiscard]] bool ShareSoundPool() const noexcept { return (BitFlag_ & kShareSoundPool) != 0; }
+			[[nodiscard]] bool CommentUTF8() const noexcept { return (BitFlag_ & kCommentUTF8) != 0; }
+			[[nodiscard]] bool DecodeOnLoad() const noexcept { return (BitFlag_ & kDecodeOnLoad) != 0; }
+			[[nodiscard]] bool WaveformCache() const noexcept { return (BitFlag_ & kWaveformCache) != 0; }
+			[[nodiscard]] bool RecoverSND() const noexcept { return (BitFlag_ & kRecoverSND) != 0; }
+			[[nodiscard]] bool PayloadCRC() const noexcept { return (BitFlag_ & kPayloadCRC) != 0; }
+			[[nodiscard]] const std::filesystem::path& SAELibFilePath() const noexcept { return SAELibFilePath_; }
+			[[nodiscard]] const std::filesystem::path& SNDSearchPath() const noexcept { return SNDSearchPath_; }
+			[[nodiscard]] uint32_t TicksPerSecond() const noexcept { return TicksPerSecond_.load(std::memory_order_relaxed); }
+
+			void InitConfig() { BitFlag_ = kDefaultConfig; }
+			void ThrowError(bool flag) { BitFlag_ = (BitFlag_ & ~kThrowError) | (flag ? kThrowError : 0); }
+			void CreateLogFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateLogFile) | (flag ? kCreateLogFile : 0); }
+			void CreateSAELibFile(bool flag) { BitFlag_ = (BitFlag_ & ~kCreateSAELibFile) | (flag ? kCreateSAELibFile : 0); }
+			void ShareSoundPool(bool flag) { BitFlag_ = (BitFlag_ & ~kShareSoundPool) | (flag ? kShareSoundPool : 0); }
+			void CommentUTF8(bool flag) { BitFlag_ = (BitFlag_ & ~kCommentUTF8) | (flag ? kCommentUTF8 : 0); }
+			void DecodeOnLoad(bool flag) { BitFlag_ = (BitFlag_ & ~kDecodeOnLoad) | (flag ? kDecodeOnLoad : 0); }
+			void WaveformCache(bool flag) { BitFlag_ = (BitFlag_ & ~kWaveformCache) | (flag ? kWaveformCache : 0); }
+			void RecoverSND(bool flag) { BitFlag_ = (BitFlag_ & ~kRecoverSND) | (flag ? kRecoverSND : 0); }
+			void PayloadCRC(bool flag) { BitFlag_ = (BitFlag_ & ~kPayloadCRC) | (flag ? kPayloadCRC : 0); }
+			void SAELibFilePath(const std::filesystem::path& Path) { SAELibFilePath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
+			void SNDSearchPath(const std::filesystem::path& Path) { SNDSearchPath_ = (Path.empty() ? std::filesystem::current_path() : Path); }
+			void TicksPerSecond(uint32_t value) noexcept { TicksPerSecond_.store(value ? value : kDefaultTicksPerSecond, std::memory_order_relaxed); }
+		};
+
+		// ユーザーが参照する範囲なのでkプレフィックスはなしで
+
+		/**
+		* @brief エラー情報
+		*
+		* 　このライブラリが使用するエラー情報の名前空間です
+		*/
+		namespace ErrorMessage {
+
+			/**
+			* @brief エラー情報構造体
+			*
+			* 　このライブラリが出力するエラー情報の構造体です
+			*
+			* @param const int32_t ID
+			* @param const char* const Name
+			* @param const char* const Message
+			*/
+			struct T_ErrorInfo {
+			public:
+				const int32_t ID;
+				const char* const Name;
+				const char* const Message;
+			};
+
+			/**
+			* @brief エラーID情報
+			*
+			* 　このライブラリが出力するエラーIDのenumです
+			*
+			* @return enum ErrorID エラーID
+			*/
+			enum ErrorID : int32_t {
+				NotFound_SNDFile,
+				NotFound_SoundNumber,
+				NotFound_SoundIndex,
+
+				Invalid_SNDExtension,
+				Invalid_LoadSNDPath,
+				Invalid_SNDSearchPath,
+				Invalid_EmptySNDFilePath,
+				Invalid_SNDFileSize,
+				Invalid_SNDSignature,
+				Invalid_RIFFSignature,
+				Invalid_WAVEFormat,
+				Invalid_SAELibFolderPath,
+
+				Failed_OpenSNDFile,
+				Failed_CreateSAELibFolder,
+				Failed_CreateErrorLogFile,
+				Failed_WriteErrorLogFile,
+				Failed_CloseErrorLogFile,
+				Failed_CreateExportWAVFolder,
+				Failed_CreateWAVFile,
+				Failed_WriteWAVFile,
+				Failed_CloseWAVFile,
+
+				Corrupted_SNDFile,
+				Warning_DuplicateSoundNumber,
+
+				// 以降は追加したエラー(既存のエラーIDを変えないため末尾に追加する)
+				Failed_CreateExportSNDFolder,
+				Failed_CreateSNDFile,
+				Failed_WriteSNDFile,
+				Failed_CloseSNDFile,
+				Invalid_CatalogFile,
+				Failed_CreateCatalogFile,
+				Failed_WriteCatalogFile,
+				Failed_CloseCatalogFile,
+				Invalid_SNDSnapshot,
+				Failed_CreateSharedMemory,
+				Failed_OpenSharedMemory,
+				Failed_WriteWaveformCache,
+				Warning_RecoveredSNDFile,
+			};
+
+			/**
+			* @brief エラー情報配列
+			*
+			* 　このライブラリが出力するエラー情報の配列です
+			*
+			* @return T_ErrorInfo ErrorInfo エラー情報
+			*/
+			inline constexpr T_ErrorInfo ErrorInfo[] = {
+				{ NotFound_SNDFile,				"NotFound_SNDFile",				"SNDファイルが見つかりません" },
+				{ NotFound_SoundNumber,			"NotFound_SoundNumber",			"指定した番号がサウンドリストから見つかりません" },
+				{ NotFound_SoundIndex,			"NotFound_SoundIndex",			"指定したインデックスがサウンドリストから見つかりません" },
+			
+				{ Invalid_SNDExtension,			"Invalid_SNDExtension",			"ファイルの拡張子が.sndではありません" },
+				{ Invalid_LoadSNDPath,			"Invalid_LoadSNDPath",			"SNDファイル読み込み関数のパスが正しくありません" },
+				{ Invalid_SNDSearchPath,		"Invalid_SNDSearchPath",		"SNDファイル検索フォルダのパスが正しくありません" },
+				{ Invalid_EmptySNDFilePath,		"Invalid_EmptySNDFilePath",		"SNDファイルパスが指定されていません" },
+				{ Invalid_SNDFileSize,			"Invalid_SNDFileSize",			"SNDファイルサイズが許容値を超えています" },
+				{ Invalid_SNDSignature,			"Invalid_SNDSignature",			"ファイルの内部形式がSNDファイルではありません" },
+				{ Invalid_RIFFSignature,		"Invalid_RIFFSignature",		"SNDファイル内の音声データがRIFF形式ではありません" },
+				{ Invalid_WAVEFormat,			"Invalid_WAVEFormat",			"SNDファイル内の音声データのフォーマットがWAVE形式ではありません" },
+				{ Invalid_SAELibFolderPath,		"Invalid_SAELibFolderPath",		"SAELibフォルダのパスが正しくありません" },
+			
+				{ Failed_OpenSNDFile,			"Failed_OpenSNDFile",			"SNDファイルが開けませんでした" },
+				{ Failed_CreateSAELibFolder,	"Failed_CreateSAELibFolder",	"SAELibフォルダの作成に失敗しました" },
+				{ Failed_CreateErrorLogFile,	"Failed_CreateErrorLogFile",	"エラーログファイルの作成に失敗しました" },
+				{ Failed_WriteErrorLogFile,		"Failed_WriteErrorLogFile",		"エラーログファイルへの書き込みに失敗しました" },
+				{ Failed_CloseErrorLogFile,		"Failed_CloseErrorLogFile",		"エラーログファイルへの書き込みが正常に終了しませんでした" },
+				{ Failed_CreateExportWAVFolder,	"Failed_CreateExportWAVFolder",	"WAVファイル出力フォルダの作成に失敗しました" },
+				{ Failed_CreateWAVFile,			"Failed_CreateWAVFile",			"WAVファイルの作成に失敗しました" },
+				{ Failed_WriteWAVFile,			"Failed_WriteWAVFile",			"WAVファイルの書き込みに失敗しました" },
+				{ Failed_CloseWAVFile,			"Failed_CloseWAVFile",			"WAVファイルの書き込みが正常に終了しませんでした" },
+			
+				{ Corrupted_SNDFile,			"Corrupted_SNDFile",			"SNDファイルが壊れている可能性があります" },
+				{ Warning_DuplicateSoundNumber,	"Warning_DuplicateSoundNumber",	"サウンドリストの番号が重複しています" },
+
+				{ Failed_CreateExportSNDFolder,	"Failed_CreateExportSNDFolder",	"SNDファイル出力フォルダの作成に失敗しました" },
+				{ Failed_CreateSNDFile,			"Failed_CreateSNDFile",			"SNDファイルの作成に失敗しました" },
+				{ Failed_WriteSNDFile,			"Failed_WriteSNDFile",			"SNDファイルの書き込みに失敗しました" },
+				{ Failed_CloseSNDFile,			"Failed_CloseSNDFile",			"SNDファイルの書き込みが正常に終了しませんでした" },
+				{ Invalid_CatalogFile,			"Invalid_CatalogFile",			"カタログファイルが読み込めないか形式が正しくありません" },
+				{ Failed_CreateCatalogFile,		"Failed_CreateCatalogFile",		"カタログファイルの作成に失敗しました" },
+				{ Failed_WriteCatalogFile,		"Failed_WriteCatalogFile",		"カタログファイルの書き込みに失敗しました" },
+				{ Failed_CloseCatalogFile,		"Failed_CloseCatalogFile",		"カタログファイルの書き込みが正常に終了しませんでした" },
+				{ Invalid_SNDSnapshot,			"Invalid_SNDSnapshot",			"スナップショットの形式が正しくありません" },
+				{ Failed_CreateSharedMemory,	"Failed_CreateSharedMemory",	"共有メモリの作成に失敗しました" },
+				{ Failed_OpenSharedMemory,		"Failed_OpenSharedMemory",		"共有メモリが開けませんでした" },
+				{ Failed_WriteWaveformCache,	"Failed_WriteWaveformCache",	"波形概要のキャッシュファイルの書き込みに失敗しました" },
+				{ Warning_RecoveredSNDFile,		"Warning_RecoveredSNDFile",		"SNDファイルの壊れた範囲を読み飛ばして読み込みました" },
+			};
+
+			/**
+			* @brief エラー情報のサイズ取得
+			*
+			* 　エラー情報の配列サイズを取得します
+			*
+			* @return size_t ErrorInfoSize エラー情報配列サイズ
+			*/
+			inline constexpr size_t ErrorInfoSize = sizeof(ErrorInfo) / sizeof(ErrorInfo[0]);
+
+			/**
+			* @brief エラー名の取得
+			*
+			* 　エラーIDに応じたエラー名を取得します
+			*
+			* @param int32_t ErrorID エラーID
+			* @return const char* ErrorName エラー名
+			*/
+			inline constexpr const char* ErrorName(int32_t ID) { return ErrorInfo[ID].Name; }
+
+			/**
+			* @brief エラーメッセージの取得
+			*
+			* 　エラーIDに応じたエラーメッセージを取得します
+			*
+			* @param int32_t ErrorID エラーID
+			* @return const char* ErrorMessage エラーメッセージ
+			*/
+			inline constexpr const char* ErrorMessage(int32_t ID) { return ErrorInfo[ID].Message; }
+		}
+
+		struct T_ErrorHandle {
+		private:
+			T_ErrorHandle() = default;
+			~T_ErrorHandle() = default;
+			T_ErrorHandle(const T_ErrorHandle&) = delete;
+			T_ErrorHandle& operator=(const T_ErrorHandle&) = delete;
+
+		private:
+			struct T_ErrorList {
+			private:
+				const int32_t kErrorID;
+				const int32_t kErrorValue = 0;
+				const int32_t kErrorValue2 = 0;
+
+			public:
+				[[nodiscard]] int32_t ErrorID() const noexcept { return kErrorID; }
+				[[nodiscard]] int32_t ErrorValue() const noexcept { return kErrorValue; }
+				[[nodiscard]] int32_t ErrorValue2() const noexcept { return kErrorValue2; }
+				[[nodiscard]] const char* const ErrorName() const noexcept { return ErrorMessage::ErrorInfo[kErrorID].Name; }
+				[[nodiscard]] const char* const ErrorMessage() const noexcept { return ErrorMessage::ErrorInfo[kErrorID].Message; }
+
+				T_ErrorList(int32_t ErrorID)
+					: kErrorID(ErrorID) {
+				}
+
+				T_ErrorList(int32_t ErrorID, int32_t ErrorValue)
+					: kErrorID(ErrorID), kErrorValue(ErrorValue) {
+				}
+
+				T_ErrorList(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo)
+					: kErrorID(ErrorID), kErrorValue(GroupNo), kErrorValue2(ItemNo) {
+				}
+			};
+			std::vector<T_ErrorList> ErrorList = {};
+			std::mutex ErrorMutex_; // 非同期読み込み中も追加できるように保護する
+
+			void InitErrorList() {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				ErrorList.clear();
+			}
+
+		public:
+			[[nodiscard]] static T_ErrorHandle& Instance() {
+				static T_ErrorHandle instance;
+				return instance;
+			}
+
+		public:
+			void AddErrorList(int32_t ErrorID) {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				ErrorList.emplace_back(T_ErrorList(ErrorID));
+			}
+
+			void AddErrorList(int32_t ErrorID, int32_t ErrorValue) {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				ErrorList.emplace_back(T_ErrorList(ErrorID, ErrorValue));
+			}
+
+			void AddErrorList(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				ErrorList.emplace_back(T_ErrorList(ErrorID, GroupNo, ItemNo));
+			}
+
+			[[nodiscard]] size_t NumError() {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				return ErrorList.size();
+			}
+
+			// 範囲外の場合は ErrorID に -1 を返す
+			void GetError(size_t index, int32_t& ErrorID, int32_t& ErrorValue, int32_t& ErrorValue2) {
+				std::lock_guard<std::mutex> Lock(ErrorMutex_);
+				ErrorID = -1;
+				ErrorValue = 0;
+				ErrorValue2 = 0;
+				if (index >= ErrorList.size()) { return; }
+				ErrorID = ErrorList[index].ErrorID();
+				ErrorValue = ErrorList[index].ErrorValue();
+				ErrorValue2 = ErrorList[index].ErrorValue2();
+			}
+
+			void ClearError() { InitErrorList(); }
+
+			[[noreturn]] void ThrowError(int32_t ErrorID) const {
+				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
+			}
+
+			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t ErrorValue) const {
+				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
+			}
+
+			[[noreturn]] void ThrowError(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) const {
+				throw std::runtime_error(ErrorMessage::ErrorInfo[ErrorID].Name);
+			}
+
+			void SetError(int32_t ErrorID) {
+				if (!T_Config::Instance().ThrowError()) {
+					AddErrorList(ErrorID);
+					return;
+				}
+				ThrowError(ErrorID);
+			}
+
+			void SetError(int32_t ErrorID, int32_t ErrorValue) {
+				if (!T_Config::Instance().ThrowError()) {
+					AddErrorList(ErrorID, ErrorValue);
+					return;
+				}
+				ThrowError(ErrorID, ErrorValue);
+			}
+
+			void SetError(int32_t ErrorID, int32_t GroupNo, int32_t ItemNo) {
+				if (!T_Config::Instance().ThrowError()) {
+					AddErrorList(ErrorID, GroupNo, ItemNo);
+					return;
+				}
+				ThrowError(ErrorID, GroupNo, ItemNo);
+			}
+
+			void WriteErrorLog(std::ofstream& File) {
+				std::unique_lock<std::mutex> Lock(ErrorMutex_);
+				File << "ReadSndFile ErrorLog" << "\n";
+				File << "エラー数: " << ErrorList.size() << "\n";
+
+				for (auto& Error : ErrorList) {
+					File << "\nエラー名: " << Error.ErrorName() << "\n";
+					File << "エラー内容: " << Error.ErrorMessage() << "\n";
+					if (Error.ErrorID() == ErrorMessage::Warning_DuplicateSoundNumber || Error.ErrorID() == ErrorMessage::NotFound_SoundNumber) {
+						File << "エラー値: " << Error.ErrorValue() << "-" << Error.ErrorValue2() << "\n";
+					}
+					if (Error.ErrorID() == ErrorMessage::NotFound_SoundIndex || Error.ErrorID() == ErrorMessage::Warning_RecoveredSNDFile) {
+						File << "エラー値: " << Error.ErrorValue() << "\n";
+					}
+				}
+				File.flush();
+				Lock.unlock();
+
+				if (File.fail() || File.bad()) {
+					if (T_Config::Instance().ThrowError()) {
+						ThrowError(ErrorMessage::Failed_WriteErrorLogFile);
+					}
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					if (T_Config::Instance().ThrowError()) {
+						ThrowError(ErrorMessage::Failed_CloseErrorLogFile);
+					}
+				}
+			}
+		};
+
+		// 記録されたエラーの参照(SNDError から使用する)
+		namespace ErrorMessage {
+
+			/**
+			* @brief 記録されたエラー数の取得
+			*
+			* 　SetThrowError(false) の時に記録されたエラーの数を取得します
+			*
+			* @return size_t NumError エラー数
+			*/
+			[[nodiscard]] inline size_t NumError() { return T_ErrorHandle::Instance().NumError(); }
+
+			/**
+			* @brief 記録されたエラーIDの取得
+			*
+			* @param size_t index 記録順のインデックス
+			* @return int32_t ErrorID エラーID (範囲外の場合は -1)
+			*/
+			[[nodiscard]] inline int32_t GetErrorID(size_t index) {
+				int32_t ID = -1, Value = 0, Value2 = 0;
+				T_ErrorHandle::Instance().GetError(index, ID, Value, Value2);
+				return ID;
+			}
+
+			/**
+			* @brief 記録されたエラー値の取得
+			*
+			* 　サウンド番号に関するエラーはグループ番号、インデックスに関するエラーはインデックス、SNDファイルの修復は読み取れなかった範囲の数を取得します
+			*
+			* @param size_t index 記録順のインデックス
+			* @return int32_t ErrorValue エラー値
+			*/
+			[[nodiscard]] inline int32_t GetErrorValue(size_t index) {
+				int32_t ID = -1, Value = 0, Value2 = 0;
+				T_ErrorHandle::Instance().GetError(index, ID, Value, Value2);
+				return Value;
+			}
+
+			/**
+			* @brief 記録されたエラー値2の取得
+			*
+			* 　サウンド番号に関するエラーはアイテム番号を取得します
+			*
+			* @param size_t index 記録順のインデックス
+			* @return int32_t ErrorValue2 エラー値2
+			*/
+			[[nodiscard]] inline int32_t GetErrorValue2(size_t index) {
+				int32_t ID = -1, Value = 0, Value2 = 0;
+				T_ErrorHandle::Instance().GetError(index, ID, Value, Value2);
+				return Value2;
+			}
+
+			/**
+			* @brief 記録されたエラーの消去
+			*/
+			inline void ClearError() { T_ErrorHandle::Instance().ClearError(); }
+		}
+
+		// パスを扱う時の補助
+		struct T_FilePathSystem {
+		private:
+			std::filesystem::path Path_ = {};
+			std::error_code ErrorCode_ = {};
+
+		public:
+			const std::filesystem::path& Path() const noexcept { return Path_; }
+			const std::error_code& ErrorCode() const noexcept { return ErrorCode_; }
+
+			void SetPath(const std::filesystem::path& Path) {
+				ErrorCode_.clear();
+				Path_ = weakly_canonical(std::filesystem::absolute(Path), ErrorCode_);
+				if (ErrorCode_) { Path_.clear(); }
+			}
+
+			void CreateDirectory(const std::filesystem::path& Path) {
+				ErrorCode_.clear();
+				if (std::filesystem::exists(Path)) { return; }
+				std::filesystem::create_directories(Path, ErrorCode_);
+
+			}
+
+		public:
+			T_FilePathSystem() = default;
+
+			T_FilePathSystem(const std::filesystem::path& Path) {
+				SetPath(Path);
+			}
+
+			[[nodiscard]] bool empty() const noexcept { return Path_.empty(); }
+		};
+
+		/**
+		* @brief SNDファイルの検索先
+		*
+		* 　検索するフォルダを優先順に保持します(先に登録したフォルダで見つかったファイルを使用)
+		*
+		* 　各フォルダ内は浅い階層から順に、同じ階層内はフォルダ名順に検索するため、同名のファイルが複数あっても結果は一定です
+		*
+		* 　ファイル名にフォルダを含む場合は各フォルダからの相対パスとして扱い、子階層の走査は行いません
+		*/
+		struct T_SearchPath {
+		public:
+			inline static constexpr int32_t kUnlimitedDepth = -1;
+
+			struct T_Root {
+				std::filesystem::path Path = {};
+				int32_t MaxDepth = kUnlimitedDepth; // 0 = フォルダ直下のみ
+			};
+
+		private:
+			std::vector<T_Root> RootList_ = {};
+
+			[[nodiscard]] static bool IsRegularFile(const std::filesystem::path& Path) {
+				std::error_code ErrorCode;
+				return std::filesystem::is_regular_file(Path, ErrorCode);
+			}
+
+			// シンボリックリンクのフォルダは循環を避けるため辿らない
+			[[nodiscard]] static std::vector<std::filesystem::path> ChildFolder(const std::filesystem::path& Folder) {
+				std::vector<std::filesystem::path> FolderList;
+				std::error_code ErrorCode;
+				for (std::filesystem::directory_iterator it(Folder, std::filesystem::directory_options::skip_permission_denied, ErrorCode), end; !ErrorCode && it != end; it.increment(ErrorCode)) {
+					std::error_code EntryErrorCode;
+					if (it->is_directory(EntryErrorCode) && !it->is_symlink(EntryErrorCode)) {
+						FolderList.push_back(it->path());
+					}
+				}
+				std::sort(FolderList.begin(), FolderList.end());
+				return FolderList;
+			}
+
+			[[nodiscard]] static std::filesystem::path FindInRoot(const T_Root& Root, const std::filesystem::path& FileName) {
+				T_FilePathSystem RootFolder(Root.Path);
+				std::error_code ErrorCode;
+				if (RootFolder.ErrorCode() || !std::filesystem::is_directory(RootFolder.Path(), ErrorCode)) { return {}; }
+
+				// 相対パス指定は直接確認
+				if (FileName.has_parent_path() || FileName.is_absolute()) {
+					const std::filesystem::path FilePath = RootFolder.Path() / FileName;
+					return IsRegularFile(FilePath) ? FilePath : std::filesystem::path();
+				}
+
+				// 各フォルダのファイル一覧は読まずに、フォルダごとに対象ファイルの有無だけを確認する
+				std::vector<std::filesystem::path> Level = { RootFolder.Path() };
+				for (int32_t Depth = 0; !Level.empty(); ++Depth) {
+					for (const auto& Folder : Level) {
+						if (IsRegularFile(Folder / FileName)) { return Folder / FileName; }
+					}
+					if (Root.MaxDepth != kUnlimitedDepth && Depth >= Root.MaxDepth) { break; }
+
+					std::vector<std::filesystem::path> NextLevel;
+					for (const auto& Folder : Level) {
+						auto FolderList = ChildFolder(Folder);
+						NextLevel.insert(NextLevel.end(), std::make_move_iterator(FolderList.begin()), std::make_move_iterator(FolderList.end()));
+					}
+					Level.swap(NextLevel);
+				}
+				return {};
+			}
+
+		public:
+			T_SearchPath() = default;
+
+			/**
+			* @brief 検索先の追加
+			*
+			* 　検索するフォルダを末尾(最も低い優先度)に追加します
+			*
+			* 　存在しないフォルダは検索時に無視されます
+			*
+			* @param const std::filesystem::path& Path 検索するフォルダ
+			* @param int32_t MaxDepth 検索する子階層の深さ (省略時は制限なし：0 = フォルダ直下のみ)
+			* @return SearchPath& 自身
+			*/
+			T_SearchPath& AddRoot(const std::filesystem::path& Path, int32_t MaxDepth = kUnlimitedDepth) {
+				RootList_.push_back({ Path, (MaxDepth < 0 ? kUnlimitedDepth : MaxDepth) });
+				return *this;
+			}
+
+			[[nodiscard]] const std::vector<T_Root>& RootList() const noexcept { return RootList_; }
+			[[nodiscard]] bool empty() const noexcept { return RootList_.empty(); }
+			[[nodiscard]] size_t size() const noexcept { return RootList_.size(); }
+			void clear() noexcept { RootList_.clear(); }
+
+			/**
+			* @brief ファイルの検索
+			*
+			* 　登録順に各フォルダを検索し、最初に見つかったファイルのパスを返します
+			*
+			* @param const std::filesystem::path& FileName ファイル名、または検索先からの相対パス
+			* @return std::filesystem::path ファイルのパス (見つからない場合は空)
+			*/
+			[[nodiscard]] std::filesystem::path Find(const std::filesystem::path& FileName) const {
+				for (const auto& Root : RootList_) {
+					std::filesystem::path FilePath = FindInRoot(Root, FileName);
+					if (!FilePath.empty()) { return FilePath; }
+				}
+				return {};
+			}
+		};
+		
+		// サウンド番号の索引の実装(登録順の番号を値として保持し、未登録の場合は -1 を返す)
+		// T_UnorderedMap の既定は SAELIB_SND_INDEX_BACKEND で選択する
+		namespace IndexBackend {
+			// std::unordered_map
+			template<typename T>
+			struct T_StdIndex {
+			private:
+				std::unordered_map<T, int32_t> Map_ = {};
+
+			public:
+				void insert(T Key, int32_t Value) { Map_[Key] = Value; }
+
+				[[nodiscard]] int32_t find(T Key) const {
+					auto it = Map_.find(Key);
+					return (it != Map_.end() ? it->second : -1);
+				}
+
+				void reserve(ksize_t Size) { Map_.reserve(Size); }
+				void clear() noexcept { Map_.clear(); }
+				void shrink_to_fit() { Map_.rehash(0); }
+				[[nodiscard]] ksize_t size() const noexcept { return static_cast<ksize_t>(Map_.size()); }
+			};
+
+			// オープンアドレス法(Robin Hood hashing)
+			// 探索距離の短い要素を後ろへずらして挿入するため、未登録の番号も短い探索で判定できる
+			template<typename T>
+			struct T_RobinHoodIndex {
+			private:
+				struct T_Slot {
+					T Key = 0;
+					int32_t Value = -1;		// -1 の場合は空き
+					uint32_t Distance = 0;	// 本来の位置からの距離
+				};
+
+				inline static constexpr size_t kMinCapacity = 16;
+
+				std::vector<T_Slot> Slot_ = {};
+				ksize_t Size_ = 0;
+
+				[[nodiscard]] static size_t Hash(T Key) noexcept {
+					uint64_t value = static_cast<uint64_t>(Key);
+					value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+					value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+					return static_cast<size_t>(value ^ (value >> 31));
+				}
+
+				// 負荷率が 7/8 以下になる2の累乗の容量
+				[[nodiscard]] static size_t Capacity(size_t Size) noexcept {
+					size_t Capacity = kMinCapacity;
+					while (Capacity * 7 / 8 < Size) { Capacity *= 2; }
+					return Capacity;
+				}
+
+				void Place(T_Slot Slot) noexcept {
+					const size_t Mask = Slot_.size() - 1;
+					for (size_t index = Hash(Slot.Key) & Mask;; index = (index + 1) & Mask, ++Slot.Distance) {
+						if (Slot_[index].Value < 0) {
+							Slot_[index] = Slot;
+							return;
+						}
+						if (Slot_[index].Distance < Slot.Distance) { std::swap(Slot_[index], Slot); }
+					}
+				}
+
+				void Rehash(size_t NewCapacity) {
+					std::vector<T_Slot> OldSlot(NewCapacity);
+					OldSlot.swap(Slot_);
+					for (auto Slot : OldSlot) {
+						if (Slot.Value < 0) { continue; }
+						Slot.Distance = 0;
+						Place(Slot);
+					}
+				}
+
+				[[nodiscard]] T_Slot* Find(T Key) noexcept {
+					return const_cast<T_Slot*>(static_cast<const T_RobinHoodIndex&>(*this).Find(Key));
+				}
+
+				[[nodiscard]] const T_Slot* Find(T Key) const noexcept {
+					if (Slot_.empty()) { return nullptr; }
+					const size_t Mask = Slot_.size() - 1;
+					uint32_t Distance = 0;
+					for (size_t index = Hash(Key) & Mask;; index = (index + 1) & Mask, ++Distance) {
+						const T_Slot& Slot = Slot_[index];
+						if (Slot.Value < 0 || Slot.Distance < Distance) { return nullptr; }
+						if (Slot.Key == Key) { return &Slot; }
+					}
+				}
+
+			public:
+				void insert(T Key, int32_t Value) {
+					if (T_Slot* Slot = Find(Key)) {
+						Slot->Value = Value;
+						return;
+					}
+					if (Slot_.size() < Capacity(size_t{ Size_ } + 1)) { Rehash(Capacity(std::max<size_t>(size_t{ Size_ } + 1, Slot_.size()))); }
+					Place(T_Slot{ Key, Value, 0 });
+					++Size_;
+				}
+
+				[[nodiscard]] int32_t find(T Key) const noexcept {
+					const T_Slot* Slot = Find(Key);
+					return (Slot ? Slot->Value : -1);
+				}
+
+				void reserve(ksize_t Size) {
+					if (Slot_.size() < Capacity(Size)) { Rehash(Capacity(Size)); }
+				}
+
+				void clear() noexcept {
+					Slot_.clear();
+					Size_ = 0;
+				}
+
+				void shrink_to_fit() {
+					if (!Size_) {
+						std::vector<T_Slot>().swap(Slot_);
+					}
+					else if (Capacity(Size_) < Slot_.size()) {
+						Rehash(Capacity(Size_));
+					}
+				}
+
+				[[nodiscard]] ksize_t size() const noexcept { return Size_; }
+			};
+
+			// 整列済み配列の二分探索(登録は遅いが、メモリが少なく読み込み後の検索が中心の場合向け)
+			template<typename T>
+			struct T_SortedIndex {
+			private:
+				std::vector<std::pair<T, int32_t>> List_ = {};
+
+				[[nodiscard]] auto LowerBound(T Key) const noexcept {
+					return std::lower_bound(List_.begin(), List_.end(), Key, [](const std::pair<T, int32_t>& Left, T Right) { return Left.first < Right; });
+				}
+
+			public:
+				void insert(T Key, int32_t Value) {
+					auto it = List_.begin() + (LowerBound(Key) - List_.cbegin());
+					if (it != List_.end() && it->first == Key) {
+						it->second = Value;
+						return;
+					}
+					List_.insert(it, { Key, Value });
+				}
+
+				[[nodiscard]] int32_t find(T Key) const noexcept {
+					auto it = LowerBound(Key);
+					return (it != List_.end() && it->first == Key ? it->second : -1);
+				}
+
+				void reserve(ksize_t Size) { List_.reserve(Size); }
+				void clear() noexcept { List_.clear(); }
+				void shrink_to_fit() { List_.shrink_to_fit(); }
+				[[nodiscard]] ksize_t size() const noexcept { return static_cast<ksize_t>(List_.size()); }
+			};
+
+			// グループ番号→アイテム番号の2段の直接参照表(番号が 0 から密に並ぶ場合向け)
+			// 表の範囲外の番号は std::unordered_map で扱う
+			template<typename T>
+			struct T_TwoLevelIndex {
+			private:
+				inline static constexpr int32_t kMaxDirectGroup = 4096;
+				inline static constexpr int32_t kMaxDirectItem = 4096;
+
+				std::vector<std::vector<int32_t>> Table_ = {};	// [GroupNo][ItemNo](int32_t の場合は [0][GroupNo])
+				T_StdIndex<T> Overflow_ = {};
+				ksize_t Size_ = 0;
+
+				// 表に収まる場合は行と列を返す
+				[[nodiscard]] static std::optional<std::pair<int32_t, int32_t>> Position(T Key) noexcept {
+					const int32_t Row = (std::is_same_v<T, int64_t> ? Convert::DecodeSoundGroupNo(Key) : 0);
+					const int32_t Column = (std::is_same_v<T, int64_t> ? Convert::DecodeSoundItemNo(Key) : static_cast<int32_t>(Key));
+					if (Row < 0 || Row >= kMaxDirectGroup || Column < 0 || Column >= kMaxDirectItem) { return std::nullopt; }
+					return std::make_pair(Row, Column);
+				}
+
+			public:
+				void insert(T Key, int32_t Value) {
+					const auto Cell = Position(Key);
+					if (!Cell) {
+						const ksize_t OldSize = Overflow_.size();
+						Overflow_.insert(Key, Value);
+						Size_ += Overflow_.size() - OldSize;
+						return;
+					}
+					if (Table_.size() <= static_cast<size_t>(Cell->first)) { Table_.resize(static_cast<size_t>(Cell->first) + 1); }
+					auto& Row = Table_[Cell->first];
+					if (Row.size() <= static_cast<size_t>(Cell->second)) { Row.resize(static_cast<size_t>(Cell->second) + 1, -1); }
+					if (Row[Cell->second] < 0) { ++Size_; }
+					Row[Cell->second] = Value;
+				}
+
+				[[nodiscard]] int32_t find(T Key) const {
+					const auto Cell = Position(Key);
+					if (!Cell) { return Overflow_.find(Key); }
+					if (Table_.size() <= static_cast<size_t>(Cell->first)) { return -1; }
+					const auto& Row = Table_[Cell->first];
+					return (Row.size() <= static_cast<size_t>(Cell->second) ? -1 : Row[Cell->second]);
+				}
+
+				void reserve(ksize_t) {}
+
+				void clear() noexcept {
+					Table_.clear();
+					Overflow_.clear();
+					Size_ = 0;
+				}
+
+				void shrink_to_fit() {
+					for (auto& Row : Table_) { Row.shrink_to_fit(); }
+					Table_.shrink_to_fit();
+					Overflow_.shrink_to_fit();
+				}
+
+				[[nodiscard]] ksize_t size() const noexcept { return Size_; }
+			};
+		};
+
+#if !defined(SAELIB_SND_INDEX_BACKEND)
+#define SAELIB_SND_INDEX_BACKEND T_StdIndex
+#endif
+
+		// サウンドリストのサウンド番号の重複チェック＆存在確認
+		template<typename T, template<typename> typename Backend = IndexBackend::SAELIB_SND_INDEX_BACKEND, typename = std::enable_if_t<std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t>>>
+		struct T_UnorderedMap {
+		private:
+			Backend<T> UnorderedMap = {};
+
+		public:
+			void Register(T value) {
+				UnorderedMap.insert(value, static_cast<int32_t>(UnorderedMap.size()));
+			}
+
+			void Register(int32_t value1, int32_t value2) {
+				Register(Convert::EncodeSoundNumber(value1, value2));
+			}
+
+		public:
+			T_UnorderedMap() = default;
+
+			[[nodiscard]] int32_t find(T input) const {
+				return UnorderedMap.find(input);
+			}
+			[[nodiscard]] int32_t find(int32_t value1, int32_t value2) const {
+				return find(Convert::EncodeSoundNumber(value1, value2));
+			}
+
+			[[nodiscard]] bool exist(T value) const {
+				return find(value) >= 0;
+			}
+			[[nodiscard]] bool exist(int32_t value1, int32_t value2) const {
+				return find(value1, value2) >= 0;
+			}
+
+			void reserve(ksize_t value) {
+				UnorderedMap.reserve(value);
+			}
+
+			void clear() {
+				UnorderedMap.clear();
+			}
+
+			void shrink_to_fit() {
+				UnorderedMap.shrink_to_fit();
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return UnorderedMap.size() == 0;
+			}
+
+			[[nodiscard]] ksize_t size() const noexcept {
+				return UnorderedMap.size();
+			}
+		};
+
+		// 複数のSNDで共有するサウンドデータの格納先(内容が同一のサウンドは1つだけ保持する)
+		struct T_SoundPool {
+		private:
+			T_SoundPool() = default;
+			~T_SoundPool() = default;
+			T_SoundPool(const T_SoundPool&) = delete;
+			T_SoundPool& operator=(const T_SoundPool&) = delete;
+
+		public:
+			using SharedBinary = std::shared_ptr<const std::vector<unsigned char>>;
+
+		private:
+			// 参照しているSNDが無くなったサウンドは期限切れになり次回の整理で取り除かれる
+			std::unordered_multimap<uint64_t, std::weak_ptr<const std::vector<unsigned char>>> SoundPool_ = {};
+			size_t PruneSize_ = 0; // 次に整理する登録数(登録数が前回の整理後の2倍を超えた時に整理する)
+			mutable std::mutex Mutex_ = {};
+
+			void EraseExpired() {
+				for (auto it = SoundPool_.begin(); it != SoundPool_.end();) {
+					it = (it->second.expired() ? SoundPool_.erase(it) : std::next(it));
+				}
+				PruneSize_ = std::max<size_t>(SoundPool_.size() * 2, 64);
+			}
+
+		public:
+			[[nodiscard]] static T_SoundPool& Instance() {
+				static T_SoundPool instance;
+				return instance;
+			}
+
+		public:
+			[[nodiscard]] SharedBinary Register(const std::vector<unsigned char>& SoundData, uint64_t SoundHash) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+
+				// 同一内容のサウンドが登録済みであれば共有する
+				auto Range = SoundPool_.equal_range(SoundHash);
+				for (auto it = Range.first; it != Range.second; ++it) {
+					SharedBinary Binary = it->second.lock();
+					if (Binary && Binary->size() == SoundData.size() && !std::memcmp(Binary->data(), SoundData.data(), SoundData.size())) {
+						return Binary;
+					}
+				}
+
+				if (SoundPool_.size() >= PruneSize_) { EraseExpired(); }
+				SharedBinary Binary = std::make_shared<const std::vector<unsigned char>>(SoundData);
+				SoundPool_.emplace(SoundHash, Binary);
+				return Binary;
+			}
+
+			[[nodiscard]] size_t NumSound() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				size_t Count = 0;
+				for (const auto& Sound : SoundPool_) {
+					if (!Sound.second.expired()) { ++Count; }
+				}
+				return Count;
+			}
+
+			[[nodiscard]] size_t size() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				size_t Size = 0;
+				for (const auto& Sound : SoundPool_) {
+					if (SharedBinary Binary = Sound.second.lock()) { Size += Binary->size(); }
+				}
+				return Size;
+			}
+
+			void shrink_to_fit() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				EraseExpired();
+				SoundPool_.rehash(0);
+			}
+		};
+
+		// サウンドデータのページを物理メモリへ固定する(複数のSNDから固定されたページは参照数で管理する)
+		struct T_PageLock {
+		private:
+			T_PageLock() = default;
+			~T_PageLock() = default;
+			T_PageLock(const T_PageLock&) = delete;
+			T_PageLock& operator=(const T_PageLock&) = delete;
+
+		private:
+			std::unordered_map<uintptr_t, uint32_t> PageCount_ = {}; // ページ先頭アドレスごとの固定数
+			mutable std::mutex Mutex_ = {};
+
+			[[nodiscard]] static size_t PageSize() noexcept {
+#if defined(_WIN32)
+				SYSTEM_INFO SystemInfo = {};
+				GetSystemInfo(&SystemInfo);
+				static const size_t kPageSize = SystemInfo.dwPageSize;
+#else
+				static const size_t kPageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+				return kPageSize;
+			}
+
+			[[nodiscard]] static bool LockPage(uintptr_t Page, size_t Size) noexcept {
+#if defined(_WIN32)
+				return VirtualLock(reinterpret_cast<void*>(Page), Size) != 0;
+#else
+				return mlock(reinterpret_cast<void*>(Page), Size) == 0;
+#endif
+			}
+
+			static void UnlockPage(uintptr_t Page, size_t Size) noexcept {
+#if defined(_WIN32)
+				VirtualUnlock(reinterpret_cast<void*>(Page), Size);
+#else
+				munlock(reinterpret_cast<void*>(Page), Size);
+#endif
+			}
+
+			// 固定できなかった場合も各ページを読み取って物理メモリへ載せる
+			static void TouchPage(const unsigned char* const Data, size_t Size) noexcept {
+				volatile unsigned char Sink = 0;
+				for (size_t Offset = 0; Offset < Size; Offset += PageSize()) { Sink = Sink + Data[Offset]; }
+				if (Size) { Sink = Sink + Data[Size - 1]; }
+			}
+
+		public:
+			[[nodiscard]] static T_PageLock& Instance() {
+				static T_PageLock instance;
+				return instance;
+			}
+
+		public:
+			// 新たに固定が必要なページだけを固定する
+			bool Lock(const unsigned char* const Data, size_t Size) {
+				if (!Size) { return true; }
+				TouchPage(Data, Size);
+
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				const uintptr_t First = reinterpret_cast<uintptr_t>(Data) & ~(PageSize() - 1);
+				const uintptr_t Last = (reinterpret_cast<uintptr_t>(Data) + Size - 1) & ~(PageSize() - 1);
+				bool Result = true;
+				for (uintptr_t Page = First; Page <= Last; Page += PageSize()) {
+					uint32_t& Count = PageCount_[Page];
+					if (!Count && !LockPage(Page, PageSize())) {
+						PageCount_.erase(Page);
+						Result = false;
+						continue;
+					}
+					++Count;
+				}
+				return Result;
+			}
+
+			// 固定数が 0 になったページだけを解除する
+			void Unlock(const unsigned char* const Data, size_t Size) {
+				if (!Size) { return; }
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				const uintptr_t First = reinterpret_cast<uintptr_t>(Data) & ~(PageSize() - 1);
+				const uintptr_t Last = (reinterpret_cast<uintptr_t>(Data) + Size - 1) & ~(PageSize() - 1);
+				for (uintptr_t Page = First; Page <= Last; Page += PageSize()) {
+					auto it = PageCount_.find(Page);
+					if (it == PageCount_.end()) { continue; }
+					if (--it->second == 0) {
+						UnlockPage(Page, PageSize());
+						PageCount_.erase(it);
+					}
+				}
+			}
+
+			[[nodiscard]] size_t size() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				return PageCount_.size() * PageSize();
+			}
+		};
+
+		struct T_ReadWAVEBinary {
+		private:
+			const std::vector<unsigned char>& kWAVEVector; // 読み込み中に再確保されても参照できるように配列自体を参照する(T_SNDBinaryData は移動しない)
+			const ksize_t kSoundStart;
+			const ksize_t kSoundSize;
+			int32_t fmtChunkOffset = 0;
+			int32_t factChunkOffset = 0;
+			int32_t dataChunkOffset = 0;
+			int32_t SAECChunkOffset = 0;
+			int32_t smplChunkOffset = 0;
+			int32_t cueChunkOffset = 0;
+			int32_t adtlChunkOffset = 0;	// 形式が adtl の LISTチャンク
+
+			inline static constexpr int32_t kRIFFChunkOffset = 0;
+			inline static constexpr int32_t kRIFFChunkDataSize = 12;
+
+			[[nodiscard]] const unsigned char* WAVEBinary() const noexcept { return kWAVEVector.data() + kSoundStart; }
+
+			struct WAVEFormat {
+				inline static constexpr std::string_view kRIFFSignature = "RIFF";
+				inline static constexpr std::string_view kFormatSignature = "WAVE";
+				inline static constexpr std::string_view kfmtSignature = "fmt ";
+				inline static constexpr std::string_view kfactSignature = "fact";
+				inline static constexpr std::string_view kdataSignature = "data";
+				inline static constexpr std::string_view kSAECSignature = "SAEC";
+				inline static constexpr std::string_view ksmplSignature = "smpl";
+				inline static constexpr std::string_view kcueSignature = "cue ";
+				inline static constexpr std::string_view kLISTSignature = "LIST";
+				inline static constexpr std::string_view kadtlSignature = "adtl";
+			};
+
+			struct T_WAVERIFFChunk {
+			private:
+				const unsigned char* const ChunkData;
+
+			public:
+				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kRIFFSignature.size()); }
+				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
+				[[nodiscard]] std::string_view FormatSignature() const noexcept { return std::string_view(reinterpret_cast<const char*>(&ChunkData[8]), WAVEFormat::kFormatSignature.size()); }
+
+				T_WAVERIFFChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
+			};
+
+			struct T_WAVEfmtChunk {
+			private:
+				const unsigned char* const ChunkData;
+
+			public:
+				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kfmtSignature.size()); }
+				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
+
+				[[nodiscard]] uint16_t FormatTag() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[8]); }
+				[[nodiscard]] uint16_t Channels() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[10]); }
+				[[nodiscard]] uint32_t SamplesPerSec() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[12]); }
+				[[nodiscard]] uint32_t AvgBytesPerSec() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[16]); }
+				[[nodiscard]] uint16_t BlockAlign() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[20]); }
+				[[nodiscard]] uint16_t BitsPerSample() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[22]); }
+				[[nodiscard]] uint16_t cbSize() const noexcept { return DecodeEndian::UInt16LE(&ChunkData[24]); }
+				[[nodiscard]] const unsigned char* Extension() const noexcept { return &ChunkData[26]; }
+
+				// WAVE_FORMAT_EXTENSIBLEの場合はSubFormatの先頭2バイトが実際のフォーマット
+				[[nodiscard]] uint16_t SubFormatTag() const noexcept { return (FormatTag() == WAVEFormatTag::kExtensible && ChunkSize() >= 40 ? DecodeEndian::UInt16LE(&ChunkData[32]) : FormatTag()); }
+
+				T_WAVEfmtChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
+			};
+
+			struct T_WAVEfactChunk {
+			private:
+				const unsigned char* const ChunkData;
+
+			public:
+				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kfactSignature.size()); }
+				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
+				[[nodiscard]] uint32_t SampleLength() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[8]); }
+
+				T_WAVEfactChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
+			};
+
+			struct T_WAVEdataChunk {
+			private:
+				const unsigned char* const ChunkData;
+
+			public:
+				[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kdataSignature.size()); }
+				[[nodiscard]] uint32_t ChunkSize() const noexcept { return DecodeEndian::UInt32LE(&ChunkData[4]); }
+				[[nodiscard]] const unsigned char* Data() const noexcept { return &ChunkData[8]; }
+
+				T_WAVEdataChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
+			};
+
+			struct T_WAVESAECChunk {
+			private:
+				const unsigned char* const ChunkData;
+
+			public:
+				[[nodiscard]] bool IsDummy() const noexcept { return ChunkData == ReadSndFileFormat::kDummyBinaryData; }
+				[[nodiscard]] std::string_view Signature() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyStringView : std::string_view(reinterpret_cast<const char*>(ChunkData), WAVEFormat::kdataSignature.size())); }
+				[[nodiscard]] uint32_t ChunkSize() const noexcept { return (IsDummy() ? 0 : DecodeEndian::UInt32LE(&ChunkData[4])); }
+				[[nodiscard]] const unsigned char* Comment() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyBinaryData : &ChunkData[8]); }
+
+				T_WAVESAECChunk(const unsigned char* const ChunkData) : ChunkData(ChunkData) {}
+			};
+
+			[[nodiscard]] bool CheckWAVEFormat() const noexcept {
+				if (RIFFChunk().Signature() != WAVEFormat::kRIFFSignature) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_RIFFSignature);
+					return false;
+				}
+				if (RIFFChunk().FormatSignature() != WAVEFormat::kFormatSignature) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_WAVEFormat);
+					return false;
+				}
+				return true;
+			}
+
+		public:
+			struct T_ChunkView {
+				const unsigned char* Data = nullptr;
+				ksize_t Size = 0;
+			};
+
+			// サウンドの先頭からのチャンク位置(同じ内容のサウンドであれば別の配列でもそのまま使用できる)
+			struct T_ChunkOffset {
+				int32_t fmt = 0;
+				int32_t fact = 0;
+				int32_t data = 0;
+				int32_t SAEC = 0;
+				int32_t smpl = 0;
+				int32_t cue = 0;
+				int32_t adtl = 0;
+			};
+
+		private:
+			// サウンドデータの範囲に収まるチャンクの内容(Header はチャンクサイズの後ろの読み飛ばす長さ)
+			[[nodiscard]] T_ChunkView ChunkView(int32_t ChunkOffset, ksize_t Header = 0) const noexcept {
+				if (!ChunkOffset || static_cast<ksize_t>(ChunkOffset) + 8 + Header > kSoundSize) { return {}; }
+				const uint32_t ChunkSize = DecodeEndian::UInt32LE(&WAVEBinary()[ChunkOffset + 4]);
+				if (ChunkSize < Header) { return {}; }
+				return { &WAVEBinary()[ChunkOffset + 8 + Header], std::min<ksize_t>(ChunkSize - Header, kSoundSize - ChunkOffset - 8 - Header) };
+			}
+
+		public:
+			[[nodiscard]] ksize_t SoundStart() const noexcept { return kSoundStart; }
+			[[nodiscard]] ksize_t SoundSize() const noexcept { return kSoundSize; }
+			[[nodiscard]] const unsigned char* SoundBinary() const noexcept { return WAVEBinary(); }
+			[[nodiscard]] T_WAVERIFFChunk RIFFChunk() const noexcept { return T_WAVERIFFChunk(&WAVEBinary()[kRIFFChunkOffset]); }
+			[[nodiscard]] T_WAVEfmtChunk fmtChunk() const noexcept { return T_WAVEfmtChunk(&WAVEBinary()[fmtChunkOffset]); }
+			[[nodiscard]] T_WAVEfactChunk factChunk() const noexcept { return T_WAVEfactChunk(&WAVEBinary()[factChunkOffset]); }
+			[[nodiscard]] T_WAVEdataChunk dataChunk() const noexcept { return T_WAVEdataChunk(&WAVEBinary()[dataChunkOffset]); }
+			[[nodiscard]] T_WAVESAECChunk SAECChunk() const noexcept { return T_WAVESAECChunk(!SAECChunkOffset ? ReadSndFileFormat::kDummyBinaryData : &WAVEBinary()[SAECChunkOffset]); }
+			[[nodiscard]] bool ExistfmtChunk() const noexcept { return fmtChunkOffset != 0; }
+			[[nodiscard]] bool ExistdataChunk() const noexcept { return dataChunkOffset != 0; }
+			[[nodiscard]] bool ExistfactChunk() const noexcept { return factChunkOffset != 0 && static_cast<ksize_t>(factChunkOffset) + 12 <= kSoundSize; }
+
+			// サウンドデータの範囲に収まるコメント(終端文字は含まない)
+			[[nodiscard]] std::string_view CommentView() const noexcept {
+				if (!SAECChunkOffset || static_cast<ksize_t>(SAECChunkOffset) + 8 > kSoundSize) { return ReadSndFileFormat::kDummyStringView; }
+				const ksize_t Size = std::min<ksize_t>(SAECChunk().ChunkSize(), kSoundSize - SAECChunkOffset - 8);
+				const std::string_view Comment(reinterpret_cast<const char*>(SAECChunk().Comment()), Size);
+				return Comment.substr(0, Comment.find('\0'));
+			}
+
+			// サウンドデータの範囲に収まる smpl/cue /LIST adtl チャンクの内容(adtl は形式の4バイトを除く、無い場合は空)
+			[[nodiscard]] T_ChunkView smplChunkView() const noexcept { return ChunkView(smplChunkOffset); }
+			[[nodiscard]] T_ChunkView cueChunkView() const noexcept { return ChunkView(cueChunkOffset); }
+			[[nodiscard]] T_ChunkView adtlChunkView() const noexcept { return ChunkView(adtlChunkOffset, 4); }
+
+			// サウンドデータの範囲に収まるfmtチャンクの拡張部分(cbSize以降)のサイズ
+			[[nodiscard]] ksize_t fmtExtensionSize() const noexcept {
+				if (!ExistfmtChunk() || fmtChunk().ChunkSize() < 18 || static_cast<ksize_t>(fmtChunkOffset) + 26 > kSoundSize) { return 0; }
+				return std::min<ksize_t>({ fmtChunk().cbSize(), fmtChunk().ChunkSize() - 18, kSoundSize - fmtChunkOffset - 26 });
+			}
+
+			// サウンドデータの範囲に収まるdataチャンクのサイズ
+			[[nodiscard]] ksize_t dataSize() const noexcept {
+				if (!ExistdataChunk() || static_cast<ksize_t>(dataChunkOffset) + 8 > kSoundSize) { return 0; }
+				return std::min<ksize_t>(dataChunk().ChunkSize(), kSoundSize - dataChunkOffset - 8);
+			}
+
+			[[nodiscard]] T_ChunkOffset ChunkOffset() const noexcept {
+				return { fmtChunkOffset, factChunkOffset, dataChunkOffset, SAECChunkOffset, smplChunkOffset, cueChunkOffset, adtlChunkOffset };
+			}
+
+			T_ReadWAVEBinary(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize) : kWAVEVector(WAVEVector), kSoundStart(static_cast<ksize_t>(WAVEVector.size() - SoundSize)), kSoundSize(SoundSize) {
+				ReadWAVEBinary();
+			}
+
+			// 読み取り済みのチャンク位置を使用する(解析とエラーの記録は行わない)
+			T_ReadWAVEBinary(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize, const T_ChunkOffset& Offset) noexcept
+				: kWAVEVector(WAVEVector), kSoundStart(static_cast<ksize_t>(WAVEVector.size() - SoundSize)), kSoundSize(SoundSize)
+				, fmtChunkOffset(Offset.fmt), factChunkOffset(Offset.fact), dataChunkOffset(Offset.data), SAECChunkOffset(Offset.SAEC)
+				, smplChunkOffset(Offset.smpl), cueChunkOffset(Offset.cue), adtlChunkOffset(Offset.adtl) {
+			}
+
+			void ReadWAVEBinary() {
+				if (!CheckWAVEFormat()) { return; }
+
+				int32_t BinaryOffset = kRIFFChunkDataSize;
+				auto TargetChunk = [this, &BinaryOffset]() -> const unsigned char* const { return &WAVEBinary()[BinaryOffset]; };
+				auto TargetSignature = [&TargetChunk]() -> std::string_view { return std::string_view(reinterpret_cast<const char*>(TargetChunk()), 4); };
+				auto TargetChunkSize = [&TargetChunk]() -> uint32_t { return DecodeEndian::UInt32LE(&TargetChunk()[4]); };
+				auto NextTargetChunk = [&TargetChunkSize]() -> uint64_t { return uint64_t{ TargetChunkSize() } + 8 + (TargetChunkSize() & 1); };
+
+				// チャンクのヘッダー(識別子とサイズ)がサウンドデータの範囲に収まる間だけ辿る
+				while (static_cast<ksize_t>(BinaryOffset) + uint64_t{ 8 } <= kSoundSize) {
+					if (TargetSignature() == WAVEFormat::kfmtSignature) {
+
+						fmtChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::kfactSignature) {
+
+						factChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::kdataSignature) {
+
+						dataChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::kSAECSignature) {
+
+						SAECChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::ksmplSignature) {
+
+						smplChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::kcueSignature) {
+
+						cueChunkOffset = BinaryOffset;
+					}
+					else if (TargetSignature() == WAVEFormat::kLISTSignature && static_cast<ksize_t>(BinaryOffset) + 12 <= kSoundSize
+						&& std::string_view(reinterpret_cast<const char*>(&TargetChunk()[8]), 4) == WAVEFormat::kadtlSignature) {
+
+						adtlChunkOffset = BinaryOffset;
+					}
+
+					// チャンクサイズが大きすぎる場合は次の位置が戻る(32bitで折り返す)ことがあるため、範囲外へ進む時点で終了する
+					const uint64_t NextOffset = static_cast<ksize_t>(BinaryOffset) + NextTargetChunk();
+					if (NextOffset <= static_cast<ksize_t>(BinaryOffset) || NextOffset > kSoundSize || NextOffset > INT32_MAX) { break; }
+					BinaryOffset = static_cast<int32_t>(NextOffset);
+				}
+			}
+		};
+
+		// smpl/cue /LIST adtl チャンクから読み取ったループ区間とマーカー
+		struct T_CueData {
+			// smplチャンクのループ区間
+			struct T_LoopPoint {
+				uint32_t CuePointID = 0;
+				uint32_t Type = 0;		// 0 = 順方向、1 = 往復、2 = 逆方向
+				uint32_t Start = 0;		// 開始サンプルフレーム
+				uint32_t End = 0;		// 終了サンプルフレーム(このフレームを含む)
+				uint32_t Fraction = 0;
+				uint32_t PlayCount = 0;	// 0 = 無限
+			};
+
+			// cue チャンクのマーカー(ラベル等は LIST adtl チャンクの同じIDのもの)
+			struct T_CuePoint {
+				uint32_t ID = 0;
+				uint32_t Position = 0;		// サンプルフレーム位置
+				uint32_t Length = 0;		// ltxt の区間のサンプルフレーム数(区間の無いマーカーは 0)
+				std::string Label = {};		// labl (文字コードは変換しない)
+				std::string Note = {};		// note (文字コードは変換しない)
+			};
+
+			std::vector<T_LoopPoint> LoopList = {};
+			std::vector<T_CuePoint> CuePointList = {};
+
+		private:
+			inline static constexpr ksize_t ksmplHeaderSize = 36;
+			inline static constexpr ksize_t kLoopSize = 24;
+			inline static constexpr ksize_t kCuePointSize = 24;
+
+			[[nodiscard]] static std::string ReadText(const unsigned char* const Data, ksize_t Size) {
+				const std::string_view Text(reinterpret_cast<const char*>(Data), Size);
+				return std::string(Text.substr(0, Text.find('\0')));
+			}
+
+			void ReadsmplChunk(const T_ReadWAVEBinary::T_ChunkView& Chunk) {
+				if (Chunk.Size < ksmplHeaderSize) { return; }
+				const uint32_t NumLoop = DecodeEndian::UInt32LE(&Chunk.Data[28]);
+				const ksize_t NumRead = std::min<ksize_t>(NumLoop, (Chunk.Size - ksmplHeaderSize) / kLoopSize);
+				LoopList.resize(NumRead);
+				for (ksize_t index = 0; index < NumRead; ++index) {
+					const unsigned char* const Loop = &Chunk.Data[ksmplHeaderSize + index * kLoopSize];
+					LoopList[index] = { DecodeEndian::UInt32LE(&Loop[0]), DecodeEndian::UInt32LE(&Loop[4]), DecodeEndian::UInt32LE(&Loop[8])
+						, DecodeEndian::UInt32LE(&Loop[12]), DecodeEndian::UInt32LE(&Loop[16]), DecodeEndian::UInt32LE(&Loop[20]) };
+				}
+			}
+
+			void ReadcueChunk(const T_ReadWAVEBinary::T_ChunkView& Chunk) {
+				if (Chunk.Size < 4) { return; }
+				const uint32_t NumCuePoint = DecodeEndian::UInt32LE(&Chunk.Data[0]);
+				const ksize_t NumRead = std::min<ksize_t>(NumCuePoint, (Chunk.Size - 4) / kCuePointSize);
+				CuePointList.resize(NumRead);
+				for (ksize_t index = 0; index < NumRead; ++index) {
+					const unsigned char* const CuePoint = &Chunk.Data[4 + index * kCuePointSize];
+					CuePointList[index].ID = DecodeEndian::UInt32LE(&CuePoint[0]);
+					CuePointList[index].Position = DecodeEndian::UInt32LE(&CuePoint[20]); // dwSampleOffset
+				}
+			}
+
+			// labl/note/ltxt を同じIDのマーカーへ設定する
+			void ReadadtlChunk(const T_ReadWAVEBinary::T_ChunkView& Chunk) {
+				ksize_t Offset = 0;
+				while (Chunk.Size - Offset >= 12) {
+					const std::string_view Signature(reinterpret_cast<const char*>(&Chunk.Data[Offset]), 4);
+					const uint32_t ChunkSize = DecodeEndian::UInt32LE(&Chunk.Data[Offset + 4]);
+					const ksize_t Size = std::min<ksize_t>(ChunkSize, Chunk.Size - Offset - 8);
+					const unsigned char* const Data = &Chunk.Data[Offset + 8];
+					const auto CuePoint = std::find_if(CuePointList.begin(), CuePointList.end(), [ID = DecodeEndian::UInt32LE(Data)](const T_CuePoint& CuePoint) { return CuePoint.ID == ID; });
+					if (CuePoint != CuePointList.end() && Size >= 4) {
+						if (Signature == "labl") { CuePoint->Label = ReadText(&Data[4], Size - 4); }
+						else if (Signature == "note") { CuePoint->Note = ReadText(&Data[4], Size - 4); }
+						else if (Signature == "ltxt" && Size >= 8) { CuePoint->Length = DecodeEndian::UInt32LE(&Data[4]); }
+					}
+					if (uint64_t{ Offset } + 8 + ChunkSize + (ChunkSize & 1) > Chunk.Size) { break; }
+					Offset += 8 + ChunkSize + (ChunkSize & 1);
+				}
+			}
+
+		public:
+			// ループ区間、マーカーが無い場合は nullptr
+			[[nodiscard]] static std::shared_ptr<const T_CueData> Read(const T_ReadWAVEBinary& WAVEBinary) {
+				auto CueData = std::make_shared<T_CueData>();
+				CueData->ReadsmplChunk(WAVEBinary.smplChunkView());
+				CueData->ReadcueChunk(WAVEBinary.cueChunkView());
+				CueData->ReadadtlChunk(WAVEBinary.adtlChunkView());
+				if (CueData->LoopList.empty() && CueData->CuePointList.empty()) { return nullptr; }
+				return CueData;
+			}
+
+			[[nodiscard]] static const T_CueData& Empty() noexcept {
+				static const T_CueData Empty;
+				return Empty;
+			}
+		};
+
+		// フォーマット、ビット数、チャンネル数ごとに特殊化したサンプル変換処理
+		namespace SampleKernel {
+			using DecodeFunc = void(*)(const unsigned char* const, uint32_t, uint16_t, float* const) noexcept;
+			using MixFunc = void(*)(const unsigned char* const, uint32_t, uint16_t, float, float, float* const) noexcept;
+
+			// G.711 の1バイトを16bitの値へ展開する変換表を作成する
+			[[nodiscard]] inline constexpr std::array<float, 256> MakeMuLawTable() noexcept {
+				std::array<float, 256> Table = {};
+				for (int32_t index = 0; index < 256; ++index) {
+					const int32_t value = ~index & 0xff;
+					const int32_t Magnitude = ((((value & 0x0f) << 3) + 0x84) << ((value >> 4) & 0x07)) - 0x84;
+					Table[index] = ((value & 0x80) ? -Magnitude : Magnitude) * (1.0f / 32768.0f);
+				}
+				return Table;
+			}
+
+			[[nodiscard]] inline constexpr std::array<float, 256> MakeALawTable() noexcept {
+				std::array<float, 256> Table = {};
+				for (int32_t index = 0; index < 256; ++index) {
+					const int32_t value = index ^ 0x55;
+					const int32_t Exponent = (value >> 4) & 0x07;
+					const int32_t Mantissa = (value & 0x0f) << 4;
+					const int32_t Magnitude = (Exponent ? (Mantissa + 0x108) << (Exponent - 1) : Mantissa + 8);
+					Table[index] = ((value & 0x80) ? Magnitude : -Magnitude) * (1.0f / 32768.0f);
+				}
+				return Table;
+			}
+
+			inline constexpr std::array<float, 256> kMuLawTable = MakeMuLawTable();
+			inline constexpr std::array<float, 256> kALawTable = MakeALawTable();
+
+			// 1サンプルを -1.0～1.0 のfloatへ変換
+			template<uint16_t Bits, uint16_t FormatTag>
+			[[nodiscard]] inline float DecodeSample(const unsigned char* const Src) noexcept {
+				constexpr bool IsFloat = (FormatTag == WAVEFormatTag::kIEEEFloat);
+				if constexpr (FormatTag == WAVEFormatTag::kMuLaw) {
+					return kMuLawTable[Src[0]];
+				}
+				else if constexpr (FormatTag == WAVEFormatTag::kALaw) {
+					return kALawTable[Src[0]];
+				}
+				else if constexpr (IsFloat && Bits == 32) {
+					const uint32_t value = DecodeEndian::UInt32LE(Src);
+					float sample = 0.0f;
+					std::memcpy(&sample, &value, sizeof(sample));
+					return sample;
+				}
+				else if constexpr (IsFloat && Bits == 64) {
+					const uint64_t value = DecodeEndian::UInt32LE(Src) | (uint64_t{ DecodeEndian::UInt32LE(&Src[4]) } << 32);
+					double sample = 0.0;
+					std::memcpy(&sample, &value, sizeof(sample));
+					return static_cast<float>(sample);
+				}
+				else if constexpr (Bits == 8) {
+					return (static_cast<int32_t>(Src[0]) - 128) * (1.0f / 128.0f);
+				}
+				else if constexpr (Bits == 16) {
+					return static_cast<int16_t>(DecodeEndian::UInt16LE(Src)) * (1.0f / 32768.0f);
+				}
+				else if constexpr (Bits == 24) {
+					return (static_cast<int32_t>((Src[0] << 8) | (Src[1] << 16) | (static_cast<uint32_t>(Src[2]) << 24)) >> 8) * (1.0f / 8388608.0f);
+				}
+				else {
+					return static_cast<float>(static_cast<int32_t>(DecodeEndian::UInt32LE(Src)) * (1.0 / 2147483648.0));
+				}
+			}
+
+			// インターリーブされたサンプルをfloatへ変換(Channels が 0 の場合は実行時のチャンネル数を使用)
+			template<uint16_t Bits, uint16_t Channels, uint16_t FormatTag>
+			inline void Decode(const unsigned char* const Src, uint32_t NumFrame, uint16_t NumChannel, float* const Dst) noexcept {
+				constexpr size_t kBytesPerSample = Bits / 8;
+				const size_t NumSample = size_t{ NumFrame } * (Channels ? Channels : NumChannel);
+				for (size_t index = 0; index < NumSample; ++index) {
+					Dst[index] = DecodeSample<Bits, FormatTag>(&Src[index * kBytesPerSample]);
+				}
+			}
+
+			// ステレオのfloatバッファへ音量を掛けて加算(3チャンネル以上は平均してから定位する)
+			template<uint16_t Bits, uint16_t Channels, uint16_t FormatTag>
+			inline void Mix(const unsigned char* const Src, uint32_t NumFrame, uint16_t NumChannel, float GainL, float GainR, float* const Dst) noexcept {
+				constexpr size_t kBytesPerSample = Bits / 8;
+				if constexpr (Channels == 1) {
+					for (size_t Frame = 0; Frame < NumFrame; ++Frame) {
+						const float sample = DecodeSample<Bits, FormatTag>(&Src[Frame * kBytesPerSample]);
+						Dst[Frame * 2] += sample * GainL;
+						Dst[Frame * 2 + 1] += sample * GainR;
+					}
+				}
+				else if constexpr (Channels == 2) {
+					for (size_t Frame = 0; Frame < NumFrame; ++Frame) {
+						Dst[Frame * 2] += DecodeSample<Bits, FormatTag>(&Src[Frame * 2 * kBytesPerSample]) * GainL;
+						Dst[Frame * 2 + 1] += DecodeSample<Bits, FormatTag>(&Src[(Frame * 2 + 1) * kBytesPerSample]) * GainR;
+					}
+				}
+				else {
+					const float Scale = 1.0f / NumChannel;
+					for (size_t Frame = 0; Frame < NumFrame; ++Frame) {
+						float sample = 0.0f;
+						for (size_t Channel = 0; Channel < NumChannel; ++Channel) {
+							sample += DecodeSample<Bits, FormatTag>(&Src[(Frame * NumChannel + Channel) * kBytesPerSample]);
+						}
+						Dst[Frame * 2] += sample * Scale * GainL;
+						Dst[Frame * 2 + 1] += sample * Scale * GainR;
+					}
+				}
+			}
+
+			struct T_Kernel {
+				DecodeFunc Decode = nullptr;
+				MixFunc Mix = nullptr;
+			};
+
+			template<uint16_t Bits, uint16_t FormatTag>
+			[[nodiscard]] inline constexpr T_Kernel SelectChannels(uint16_t Channels) noexcept {
+				switch (Channels) {
+				case 1: return { &Decode<Bits, 1, FormatTag>, &Mix<Bits, 1, FormatTag> };
+				case 2: return { &Decode<Bits, 2, FormatTag>, &Mix<Bits, 2, FormatTag> };
+				default: return { &Decode<Bits, 0, FormatTag>, &Mix<Bits, 0, FormatTag> };
+				}
+			}
+
+			// 対応しないフォーマットの場合は空の処理を返す
+			[[nodiscard]] inline constexpr T_Kernel Select(uint16_t FormatTag, uint16_t BitsPerSample, uint16_t Channels) noexcept {
+				if (!Channels) { return {}; }
+				if (FormatTag == WAVEFormatTag::kPCM) {
+					switch (BitsPerSample) {
+					case 8: return SelectChannels<8, WAVEFormatTag::kPCM>(Channels);
+					case 16: return SelectChannels<16, WAVEFormatTag::kPCM>(Channels);
+					case 24: return SelectChannels<24, WAVEFormatTag::kPCM>(Channels);
+					case 32: return SelectChannels<32, WAVEFormatTag::kPCM>(Channels);
+					}
+				}
+				if (FormatTag == WAVEFormatTag::kIEEEFloat) {
+					switch (BitsPerSample) {
+					case 32: return SelectChannels<32, WAVEFormatTag::kIEEEFloat>(Channels);
+					case 64: return SelectChannels<64, WAVEFormatTag::kIEEEFloat>(Channels);
+					}
+				}
+				if (FormatTag == WAVEFormatTag::kMuLaw && BitsPerSample == 8) { return SelectChannels<8, WAVEFormatTag::kMuLaw>(Channels); }
+				if (FormatTag == WAVEFormatTag::kALaw && BitsPerSample == 8) { return SelectChannels<8, WAVEFormatTag::kALaw>(Channels); }
+				return {};
+			}
+		};
+
+		// ADPCM(IMA / Microsoft)のブロック単位の展開処理
+		// ブロックごとに先頭で予測値を初期化するため、ブロック単位で並列に展開できる
+		namespace ADPCM {
+			inline constexpr std::array<int32_t, 89> kIMAStepTable = {
+				7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+				50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+				337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+				2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+				15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+			};
+			inline constexpr std::array<int32_t, 16> kIMAIndexTable = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+			inline constexpr std::array<int32_t, 16> kMSAdaptationTable = { 230, 230, 230, 230, 307, 409, 512, 614, 768, 614, 512, 409, 307, 230, 230, 230 };
+			inline constexpr std::array<std::array<int32_t, 2>, 7> kMSDefaultCoef = { { { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 } } };
+
+			inline constexpr uint32_t kIMAHeaderSize = 4;	// 1チャンネルあたり
+			inline constexpr uint32_t kMSHeaderSize = 7;	// 1チャンネルあたり
+			inline constexpr uint32_t kMSMaxChannel = 2;
+			inline constexpr uint32_t kParallelBlock = 64;	// これ未満のブロック数は並列化しない
+
+			[[nodiscard]] inline constexpr bool IsADPCM(uint16_t FormatTag) noexcept {
+				return FormatTag == WAVEFormatTag::kIMAADPCM || FormatTag == WAVEFormatTag::kMSADPCM;
+			}
+
+			[[nodiscard]] inline constexpr int32_t Clamp16(int32_t value) noexcept {
+				return std::clamp<int32_t>(value, INT16_MIN, INT16_MAX);
+			}
+
+			inline void Store(unsigned char* const Dst, size_t index, int32_t value) noexcept {
+				EncodeEndian::UInt16LE(&Dst[index * 2], static_cast<uint16_t>(value));
+			}
+
+			// 指定バイト数のブロックに含まれるフレーム数(ヘッダーに満たない場合は 0)
+			[[nodiscard]] inline constexpr uint32_t FramePerBlock(uint16_t FormatTag, uint16_t Channels, uint32_t BlockSize) noexcept {
+				if (!Channels) { return 0; }
+				if (FormatTag == WAVEFormatTag::kIMAADPCM) {
+					const uint32_t HeaderSize = kIMAHeaderSize * Channels;
+					return (BlockSize < HeaderSize ? 0 : (BlockSize - HeaderSize) / (4 * Channels) * 8 + 1);
+				}
+				if (FormatTag == WAVEFormatTag::kMSADPCM && Channels <= kMSMaxChannel) {
+					const uint32_t HeaderSize = kMSHeaderSize * Channels;
+					return (BlockSize < HeaderSize ? 0 : (BlockSize - HeaderSize) * 2 / Channels + 2);
+				}
+				return 0;
+			}
+
+			// dataチャンク全体のフレーム数(末尾の不完全なブロックも含む)
+			[[nodiscard]] inline constexpr uint32_t NumFrame(uint16_t FormatTag, uint16_t Channels, uint16_t BlockAlign, uint32_t DataSize) noexcept {
+				if (!BlockAlign || !FramePerBlock(FormatTag, Channels, BlockAlign)) { return 0; }
+				const uint64_t Frame = uint64_t{ DataSize / BlockAlign } * FramePerBlock(FormatTag, Channels, BlockAlign) + FramePerBlock(FormatTag, Channels, DataSize % BlockAlign);
+				return static_cast<uint32_t>(std::min<uint64_t>(Frame, UINT32_MAX));
+			}
+
+			// IMA ADPCM: チャンネルごとのヘッダーの後、4バイト(8サンプル)単位でチャンネルが交互に並ぶ
+			inline void DecodeIMABlock(const unsigned char* const Block, uint16_t Channels, uint32_t NumFrame, unsigned char* const Dst) noexcept {
+				for (uint32_t Channel = 0; Channel < Channels; ++Channel) {
+					const unsigned char* const Header = &Block[Channel * kIMAHeaderSize];
+					int32_t Predictor = static_cast<int16_t>(DecodeEndian::UInt16LE(Header));
+					int32_t StepIndex = std::min<int32_t>(Header[2], static_cast<int32_t>(kIMAStepTable.size() - 1));
+					Store(Dst, Channel, Predictor);
+
+					const unsigned char* const Data = &Block[kIMAHeaderSize * Channels];
+					for (uint32_t Frame = 1; Frame < NumFrame; ++Frame) {
+						const uint32_t Sample = Frame - 1;
+						const unsigned char Byte = Data[(Sample / 8 * Channels + Channel) * 4 + (Sample % 8) / 2];
+						const int32_t Nibble = ((Sample & 1) ? Byte >> 4 : Byte & 0x0f);
+						const int32_t Step = kIMAStepTable[StepIndex];
+						int32_t Diff = Step >> 3;
+						if (Nibble & 4) { Diff += Step; }
+						if (Nibble & 2) { Diff += Step >> 1; }
+						if (Nibble & 1) { Diff += Step >> 2; }
+						Predictor = Clamp16((Nibble & 8) ? Predictor - Diff : Predictor + Diff);
+						StepIndex = std::clamp<int32_t>(StepIndex + kIMAIndexTable[Nibble], 0, static_cast<int32_t>(kIMAStepTable.size() - 1));
+						Store(Dst, size_t{ Frame } * Channels + Channel, Predictor);
+					}
+				}
+			}
+
+			// Microsoft ADPCM: 予測係数番号、量子化幅、直前の2サンプルのヘッダーの後、上位4bitから順にチャンネルが交互に並ぶ
+			inline void DecodeMSBlock(const unsigned char* const Block, uint16_t Channels, uint32_t NumFrame, const std::vector<std::array<int32_t, 2>>& Coef, unsigned char* const Dst) noexcept {
+				std::array<int32_t, kMSMaxChannel> Coef1 = {}, Coef2 = {}, Delta = {}, Sample1 = {}, Sample2 = {};
+				for (uint32_t Channel = 0; Channel < Channels; ++Channel) {
+					const size_t CoefIndex = std::min<size_t>(Block[Channel], Coef.size() - 1);
+					Coef1[Channel] = Coef[CoefIndex][0];
+					Coef2[Channel] = Coef[CoefIndex][1];
+					Delta[Channel] = static_cast<int16_t>(DecodeEndian::UInt16LE(&Block[Channels + Channel * 2]));
+					Sample1[Channel] = static_cast<int16_t>(DecodeEndian::UInt16LE(&Block[Channels * 3 + Channel * 2]));
+					Sample2[Channel] = static_cast<int16_t>(DecodeEndian::UInt16LE(&Block[Channels * 5 + Channel * 2]));
+					Store(Dst, Channel, Sample2[Channel]);
+					if (NumFrame > 1) { Store(Dst, size_t{ Channels } + Channel, Sample1[Channel]); }
+				}
+
+				const unsigned char* const Data = &Block[kMSHeaderSize * Channels];
+				const size_t NumNibble = size_t{ NumFrame > 2 ? NumFrame - 2 : 0 } * Channels;
+				for (size_t index = 0; index < NumNibble; ++index) {
+					const uint32_t Channel = static_cast<uint32_t>(index % Channels);
+					const int32_t Nibble = ((index & 1) ? Data[index / 2] & 0x0f : Data[index / 2] >> 4);
+					const int32_t Signed = (Nibble & 8 ? Nibble - 16 : Nibble);
+					const int32_t Predictor = Clamp16(((Sample1[Channel] * Coef1[Channel] + Sample2[Channel] * Coef2[Channel]) >> 8) + Signed * Delta[Channel]);
+					Sample2[Channel] = Sample1[Channel];
+					Sample1[Channel] = Predictor;
+					Delta[Channel] = std::max<int32_t>(16, (kMSAdaptationTable[Nibble] * Delta[Channel]) >> 8);
+					Store(Dst, size_t{ Channels } * 2 + index, Predictor);
+				}
+			}
+
+			// fmtチャンクの拡張部分に予測係数が無い場合は標準の7組を使用する
+			[[nodiscard]] inline std::vector<std::array<int32_t, 2>> MSCoef(const unsigned char* const Extension, size_t ExtensionSize) {
+				std::vector<std::array<int32_t, 2>> Coef(kMSDefaultCoef.begin(), kMSDefaultCoef.end());
+				if (ExtensionSize < 4) { return Coef; }
+				const size_t NumCoef = std::min<size_t>(DecodeEndian::UInt16LE(&Extension[2]), (ExtensionSize - 4) / 4);
+				if (!NumCoef) { return Coef; }
+				Coef.resize(NumCoef);
+				for (size_t index = 0; index < NumCoef; ++index) {
+					Coef[index] = { static_cast<int16_t>(DecodeEndian::UInt16LE(&Extension[4 + index * 4])), static_cast<int16_t>(DecodeEndian::UInt16LE(&Extension[6 + index * 4])) };
+				}
+				return Coef;
+			}
+
+			// 16bit PCM(リトルエンディアン)へ展開する(Dst は NumFrame * Channels * 2 バイト)
+			inline void Decode(uint16_t FormatTag, uint16_t Channels, uint16_t BlockAlign, const unsigned char* const Data, uint32_t DataSize, uint32_t NumFrame
+				, const std::vector<std::array<int32_t, 2>>& Coef, unsigned char* const Dst) {
+				const uint32_t BlockFrame = FramePerBlock(FormatTag, Channels, BlockAlign);
+				if (!BlockFrame || !NumFrame) { return; }
+				const uint32_t NumBlock = (NumFrame + BlockFrame - 1) / BlockFrame;
+				auto DecodeBlock = [&](size_t BlockNo) {
+					const uint32_t BlockStart = static_cast<uint32_t>(BlockNo) * BlockFrame;
+					const uint32_t BlockSize = std::min<uint32_t>(BlockAlign, DataSize - static_cast<uint32_t>(BlockNo) * BlockAlign);
+					const uint32_t NumBlockFrame = std::min({ BlockFrame, FramePerBlock(FormatTag, Channels, BlockSize), NumFrame - BlockStart });
+					unsigned char* const BlockDst = &Dst[size_t{ BlockStart } * Channels * 2];
+					if (FormatTag == WAVEFormatTag::kIMAADPCM) {
+						DecodeIMABlock(&Data[size_t{ BlockNo } * BlockAlign], Channels, NumBlockFrame, BlockDst);
+					}
+					else {
+						DecodeMSBlock(&Data[size_t{ BlockNo } * BlockAlign], Channels, NumBlockFrame, Coef, BlockDst);
+					}
+				};
+				if (NumBlock < kParallelBlock) {
+					for (size_t BlockNo = 0; BlockNo < NumBlock; ++BlockNo) { DecodeBlock(BlockNo); }
+				}
+				else {
+					Parallel::For(NumBlock, DecodeBlock);
+				}
+			}
+		};
+
+		// 読み込み時に確定するサウンドのフォーマット情報(変換処理も読み込み時に選択する)
+		struct T_SampleFormat {
+		private:
+			uint16_t FormatTag_ = 0;
+			uint16_t Channels_ = 0;
+			uint16_t BitsPerSample_ = 0;
+			uint32_t SamplesPerSec_ = 0;
+			uint32_t NumFrame_ = 0;
+			uint16_t FrameBits_ = 0; // 変換処理が読み取る1サンプルのビット数(ADPCMは展開後の16bit)
+			uint32_t SampleLength_ = 0;
+			double SAESecond_ = 0.0;
+			SampleKernel::T_Kernel Kernel_ = {};
+
+		public:
+			[[nodiscard]] uint16_t FormatTag() const noexcept { return FormatTag_; }
+			[[nodiscard]] uint16_t Channels() const noexcept { return Channels_; }
+			[[nodiscard]] uint16_t BitsPerSample() const noexcept { return BitsPerSample_; }
+			[[nodiscard]] uint32_t SamplesPerSec() const noexcept { return SamplesPerSec_; }
+			[[nodiscard]] uint32_t BytesPerFrame() const noexcept { return uint32_t{ Channels_ } * (FrameBits_ / 8); }
+			[[nodiscard]] bool IsADPCM() const noexcept { return ADPCM::IsADPCM(FormatTag_); }
+			[[nodiscard]] uint32_t NumFrame() const noexcept { return NumFrame_; }
+			[[nodiscard]] uint32_t SampleLength() const noexcept { return SampleLength_; }
+			[[nodiscard]] double SAESecond() const noexcept { return SAESecond_; }
+			[[nodiscard]] const SampleKernel::T_Kernel& Kernel() const noexcept { return Kernel_; }
+			[[nodiscard]] bool IsSupported() const noexcept { return Kernel_.Decode != nullptr; }
+
+			// ADPCMは展開後の16bit PCMを読み取る(DecodeADPCM が false の場合は対応しないフォーマットとして扱う)
+			T_SampleFormat(const T_ReadWAVEBinary& WAVEBinary, bool DecodeADPCM) noexcept {
+				if (!WAVEBinary.ExistfmtChunk()) { return; }
+				const auto fmtChunk = WAVEBinary.fmtChunk();
+				FormatTag_ = fmtChunk.SubFormatTag();
+				Channels_ = fmtChunk.Channels();
+				BitsPerSample_ = fmtChunk.BitsPerSample();
+				SamplesPerSec_ = fmtChunk.SamplesPerSec();
+				FrameBits_ = (IsADPCM() ? 16 : BitsPerSample_);
+				if (!WAVEBinary.ExistdataChunk()) { return; }
+
+				// ADPCMのサンプル数はブロック構成から求め、fact チャンクの方が短い場合は切り詰める
+				const uint32_t ADPCMFrame = ADPCM::NumFrame(FormatTag_, Channels_, fmtChunk.BlockAlign(), static_cast<uint32_t>(WAVEBinary.dataSize()));
+				if (IsADPCM()) {
+					if (ADPCMFrame && DecodeADPCM) { Kernel_ = SampleKernel::Select(WAVEFormatTag::kPCM, FrameBits_, Channels_); }
+					NumFrame_ = (IsSupported() ? (WAVEBinary.ExistfactChunk() ? std::min(ADPCMFrame, WAVEBinary.factChunk().SampleLength()) : ADPCMFrame) : 0);
+				}
+				else {
+					Kernel_ = SampleKernel::Select(FormatTag_, BitsPerSample_, Channels_);
+					NumFrame_ = (IsSupported() ? WAVEBinary.dataSize() / BytesPerFrame() : 0);
+				}
+
+				// サンプル数は fact チャンクを優先し、無い場合は dataチャンクのサイズから求める(AvgBytesPerSec は使用しない)
+				const uint32_t BlockAlign = (fmtChunk.BlockAlign() ? fmtChunk.BlockAlign() : BytesPerFrame());
+				const uint32_t DataFrame = (IsADPCM() ? ADPCMFrame : (BlockAlign ? WAVEBinary.dataSize() / BlockAlign : 0));
+				SampleLength_ = (WAVEBinary.ExistfactChunk() ? WAVEBinary.factChunk().SampleLength() : DataFrame);
+
+				// SAEの表示と同じ dataチャンクサイズ / AvgBytesPerSec の秒数
+				if (fmtChunk.AvgBytesPerSec()) { SAESecond_ = double(WAVEBinary.dataChunk().ChunkSize()) / double(fmtChunk.AvgBytesPerSec()); }
+			}
+		};
+
+		// サウンドの解析結果
+		struct T_AnalysisData {
+		private:
+			bool IsValid_ = false;
+			double Peak_ = 0.0;
+			double RMS_ = 0.0;
+			double Loudness_ = -std::numeric_limits<double>::infinity();
+			uint32_t SamplesPerSec_ = 0;
+			uint32_t NumFrame_ = 0;
+			uint32_t LeadingSilence_ = 0;
+			uint32_t TrailingSilence_ = 0;
+
+		public:
+			[[nodiscard]] bool IsValid() const noexcept { return IsValid_; }
+			[[nodiscard]] double Peak() const noexcept { return Peak_; }
+			[[nodiscard]] double RMS() const noexcept { return RMS_; }
+			[[nodiscard]] double Loudness() const noexcept { return Loudness_; }
+			[[nodiscard]] uint32_t NumFrame() const noexcept { return NumFrame_; }
+			[[nodiscard]] uint32_t LeadingSilence() const noexcept { return LeadingSilence_; }
+			[[nodiscard]] uint32_t TrailingSilence() const noexcept { return TrailingSilence_; }
+			[[nodiscard]] double LeadingSilenceTime() const noexcept { return (SamplesPerSec_ ? double(LeadingSilence_) / SamplesPerSec_ : 0.0); }
+			[[nodiscard]] double TrailingSilenceTime() const noexcept { return (SamplesPerSec_ ? double(TrailingSilence_) / SamplesPerSec_ : 0.0); }
+
+			T_AnalysisData() = default;
+
+			T_AnalysisData(double Peak, double RMS, double Loudness, uint32_t SamplesPerSec, uint32_t NumFrame, uint32_t LeadingSilence, uint32_t TrailingSilence) noexcept
+				: IsValid_(true), Peak_(Peak), RMS_(RMS), Loudness_(Loudness), SamplesPerSec_(SamplesPerSec)
+				, NumFrame_(NumFrame), LeadingSilence_(LeadingSilence), TrailingSilence_(TrailingSilence) {
+			}
+		};
+
+		// dataチャンクを直接読み取ってピーク、RMS、ラウドネス(ITU-R BS.1770 / EBU R128)、前後の無音を算出する
+		struct T_SoundAnalyzer {
+		public:
+			inline static constexpr double kDefaultSilenceThreshold = 0.001; // -60dBFS
+
+		private:
+			inline static constexpr uint32_t kBlockFrame = 4096;
+			inline static constexpr double kAbsoluteGate = -70.0;
+			inline static constexpr double kRelativeGate = -10.0;
+			inline static constexpr double kLoudnessOffset = -0.691;
+			inline static constexpr double kPi = 3.14159265358979323846;
+
+			// K特性フィルタ(2段の双2次フィルタ)
+			struct T_Biquad {
+				double b0 = 1.0, b1 = 0.0, b2 = 0.0, a1 = 0.0, a2 = 0.0;
+				double z1 = 0.0, z2 = 0.0;
+
+				[[nodiscard]] double Process(double input) noexcept {
+					const double output = b0 * input + z1;
+					z1 = b1 * input - a1 * output + z2;
+					z2 = b2 * input - a2 * output;
+					return output;
+				}
+			};
+
+			[[nodiscard]] static T_Biquad HighShelf(double SamplesPerSec) noexcept {
+				const double K = std::tan(kPi * 1681.974450955533 / SamplesPerSec);
+				const double Q = 0.7071752369554196;
+				const double Vh = std::pow(10.0, 3.999843853973347 / 20.0);
+				const double Vb = std::pow(Vh, 0.4996667741545416);
+				const double a0 = 1.0 + K / Q + K * K;
+				T_Biquad Filter;
+				Filter.b0 = (Vh + Vb * K / Q + K * K) / a0;
+				Filter.b1 = 2.0 * (K * K - Vh) / a0;
+				Filter.b2 = (Vh - Vb * K / Q + K * K) / a0;
+				Filter.a1 = 2.0 * (K * K - 1.0) / a0;
+				Filter.a2 = (1.0 - K / Q + K * K) / a0;
+				return Filter;
+			}
+
+			[[nodiscard]] static T_Biquad HighPass(double SamplesPerSec) noexcept {
+				const double K = std::tan(kPi * 38.13547087602444 / SamplesPerSec);
+				const double Q = 0.5003270373238773;
+				const double a0 = 1.0 + K / Q + K * K;
+				T_Biquad Filter;
+				Filter.b0 = 1.0;
+				Filter.b1 = -2.0;
+				Filter.b2 = 1.0;
+				Filter.a1 = 2.0 * (K * K - 1.0) / a0;
+				Filter.a2 = (1.0 - K / Q + K * K) / a0;
+				return Filter;
+			}
+
+		public:
+			// Data は変換処理が読み取るサンプルの先頭(ADPCMは展開後のPCM)
+			[[nodiscard]] static T_AnalysisData Analyze(const unsigned char* const Data, const T_SampleFormat& SampleFormat, double SilenceThreshold = kDefaultSilenceThreshold) {
+				if (!SampleFormat.IsSupported() || !SampleFormat.SamplesPerSec()) { return T_AnalysisData(); }
+
+				const uint32_t Channels = SampleFormat.Channels();
+				const uint32_t SamplesPerSec = SampleFormat.SamplesPerSec();
+				const uint32_t BytesPerFrame = SampleFormat.BytesPerFrame();
+				const uint32_t NumFrame = SampleFormat.NumFrame();
+
+				// ラウドネスは100ms単位の二乗和を4つ重ねた400msブロックでゲートを掛ける
+				const uint32_t SubBlockFrame = std::max<uint32_t>(1, static_cast<uint32_t>(std::lround(SamplesPerSec * 0.1)));
+				std::vector<T_Biquad> Stage1(Channels, HighShelf(SamplesPerSec));
+				std::vector<T_Biquad> Stage2(Channels, HighPass(SamplesPerSec));
+				std::vector<double> SubBlockPower;
+				SubBlockPower.reserve(NumFrame / SubBlockFrame + 1);
+				double SubBlockSum = 0.0;
+				uint32_t SubBlockCount = 0;
+				double WeightedSum = 0.0;
+
+				std::vector<float> Buffer(size_t{ kBlockFrame } * Channels);
+				float Peak = 0.0f;
+				double SquareSum = 0.0;
+				uint32_t FirstSound = NumFrame;
+				uint32_t LastSound = 0;
+				const float Threshold = static_cast<float>(SilenceThreshold);
+
+				for (uint32_t BlockStart = 0; BlockStart < NumFrame; BlockStart += kBlockFrame) {
+					const uint32_t NumBlockFrame = std::min(kBlockFrame, NumFrame - BlockStart);
+					const size_t NumSample = size_t{ NumBlockFrame } * Channels;
+					SampleFormat.Kernel().Decode(&Data[size_t{ BlockStart } * BytesPerFrame], NumBlockFrame, SampleFormat.Channels(), Buffer.data());
+
+					// ピークと二乗和(ベクトル化しやすいように分岐の無いループにする)
+					float BlockPeak = 0.0f;
+					double BlockSquareSum = 0.0;
+					for (size_t index = 0; index < NumSample; ++index) {
+						BlockPeak = std::max(BlockPeak, std::fabs(Buffer[index]));
+						BlockSquareSum += double(Buffer[index]) * Buffer[index];
+					}
+					Peak = std::max(Peak, BlockPeak);
+					SquareSum += BlockSquareSum;
+
+					// 無音判定
+					if (BlockPeak > Threshold) {
+						for (uint32_t Frame = 0; Frame < NumBlockFrame; ++Frame) {
+							for (uint32_t Channel = 0; Channel < Channels; ++Channel) {
+								if (std::fabs(Buffer[size_t{ Frame } * Channels + Channel]) > Threshold) {
+									FirstSound = std::min(FirstSound, BlockStart + Frame);
+									LastSound = BlockStart + Frame;
+									break;
+								}
+							}
+						}
+					}
+
+					// K特性フィルタ
+					for (uint32_t Frame = 0; Frame < NumBlockFrame; ++Frame) {
+						double FramePower = 0.0;
+						for (uint32_t Channel = 0; Channel < Channels; ++Channel) {
+							const double Filtered = Stage2[Channel].Process(Stage1[Channel].Process(Buffer[size_t{ Frame } * Channels + Channel]));
+							FramePower += Filtered * Filtered;
+						}
+						WeightedSum += FramePower;
+						SubBlockSum += FramePower;
+						if (++SubBlockCount == SubBlockFrame) {
+							SubBlockPower.push_back(SubBlockSum / SubBlockFrame);
+							SubBlockSum = 0.0;
+							SubBlockCount = 0;
+						}
+					}
+				}
+
+				// 400msに満たない場合は全体を1ブロックとして扱う
+				std::vector<double> BlockPower;
+				if (SubBlockPower.size() < 4) {
+					if (NumFrame) { BlockPower.push_back(WeightedSum / NumFrame); }
+				}
+				else {
+					BlockPower.reserve(SubBlockPower.size() - 3);
+					for (size_t index = 3; index < SubBlockPower.size(); ++index) {
+						BlockPower.push_back((SubBlockPower[index - 3] + SubBlockPower[index - 2] + SubBlockPower[index - 1] + SubBlockPower[index]) / 4.0);
+					}
+				}
+
+				auto ToLoudness = [](double Power) { return kLoudnessOffset + 10.0 * std::log10(Power); };
+				auto GatedLoudness = [&BlockPower, &ToLoudness](double Gate) {
+					double Sum = 0.0;
+					size_t Count = 0;
+					for (double Power : BlockPower) {
+						if (Power > 0.0 && ToLoudness(Power) > Gate) {
+							Sum += Power;
+							++Count;
+						}
+					}
+					return (Count ? ToLoudness(Sum / Count) : -std::numeric_limits<double>::infinity());
+				};
+				const double AbsoluteLoudness = GatedLoudness(kAbsoluteGate);
+				const double Loudness = (std::isinf(AbsoluteLoudness) ? AbsoluteLoudness : GatedLoudness(AbsoluteLoudness + kRelativeGate));
+
+				const bool IsSilence = (FirstSound == NumFrame);
+				const double RMS = (NumFrame ? std::sqrt(SquareSum / (double(NumFrame) * Channels)) : 0.0);
+				return T_AnalysisData(Peak, RMS, Loudness, SamplesPerSec, NumFrame
+					, (IsSilence ? NumFrame : FirstSound), (IsSilence ? NumFrame : NumFrame - 1 - LastSound));
+			}
+		};
+
+		// サウンドの波形概要(チャンネルごとの最小値、最大値、RMSを2のべき乗のフレーム数でまとめた階層)
+		struct T_Waveform {
+		public:
+			struct T_Peak {
+				float Min = 0.0f;
+				float Max = 0.0f;
+				float RMS = 0.0f;
+			};
+			using Peak = T_Peak;
+
+			inline static constexpr uint32_t kBaseBlockFrame = 64;	// 最下層の1ブロックのフレーム数
+			inline static constexpr int32_t kAllChannel = -1;
+
+		private:
+			inline static constexpr uint32_t kParallelBlock = 1024;	// 並列に作成する際の最下層のブロック数の単位
+
+			struct T_Pyramid {
+				uint32_t NumFrame = 0;
+				uint16_t Channels = 0;
+				uint32_t SamplesPerSec = 0;
+				std::vector<size_t> LevelStart = {};	// 各階層の先頭のPeak位置
+				std::vector<T_Peak> Peak = {};			// 階層ごとにブロック順、ブロック内はチャンネル順
+			};
+
+			std::shared_ptr<const T_Pyramid> Pyramid_ = nullptr;
+
+			[[nodiscard]] static uint32_t NumBlockOf(uint32_t NumFrame, uint32_t Level) noexcept {
+				const uint64_t BlockFrame = uint64_t{ kBaseBlockFrame } << Level;
+				return static_cast<uint32_t>((NumFrame + BlockFrame - 1) / BlockFrame);
+			}
+
+			// 最上位は1ブロック
+			[[nodiscard]] static std::vector<size_t> LevelStartOf(uint32_t NumFrame, uint16_t Channels) {
+				std::vector<size_t> LevelStart = { 0 };
+				if (!NumFrame || !Channels) { return LevelStart; }
+				for (uint32_t Level = 0;; ++Level) {
+					const uint32_t NumBlock = NumBlockOf(NumFrame, Level);
+					LevelStart.push_back(LevelStart.back() + size_t{ NumBlock } * Channels);
+					if (NumBlock <= 1) { break; }
+				}
+				return LevelStart;
+			}
+
+			// 最下層のブロックをサンプルから求める(ベクトル化しやすいように分岐の無いループにする)
+			static void BuildBaseLevel(const unsigned char* const Data, const T_SampleFormat& SampleFormat, uint32_t FirstBlock, uint32_t LastBlock, T_Peak* const Dst) {
+				const uint32_t Channels = SampleFormat.Channels();
+				std::vector<float> Buffer(size_t{ kBaseBlockFrame } * Channels);
+				std::array<float, kBaseBlockFrame> Channel = {};
+				for (uint32_t Block = FirstBlock; Block < LastBlock; ++Block) {
+					const uint32_t StartFrame = Block * kBaseBlockFrame;
+					const uint32_t NumBlockFrame = std::min(kBaseBlockFrame, SampleFormat.NumFrame() - StartFrame);
+					SampleFormat.Kernel().Decode(&Data[size_t{ StartFrame } * SampleFormat.BytesPerFrame()], NumBlockFrame, SampleFormat.Channels(), Buffer.data());
+					for (uint32_t ChannelNo = 0; ChannelNo < Channels; ++ChannelNo) {
+						for (uint32_t Frame = 0; Frame < NumBlockFrame; ++Frame) { Channel[Frame] = Buffer[size_t{ Frame } * Channels + ChannelNo]; }
+						float Min = Channel[0];
+						float Max = Channel[0];
+						float SquareSum = 0.0f;
+						for (uint32_t Frame = 0; Frame < NumBlockFrame; ++Frame) {
+							Min = std::min(Min, Channel[Frame]);
+							Max = std::max(Max, Channel[Frame]);
+							SquareSum += Channel[Frame] * Channel[Frame];
+						}
+						Dst[size_t{ Block } * Channels + ChannelNo] = { Min, Max, std::sqrt(SquareSum / NumBlockFrame) };
+					}
+				}
+			}
+
+			// 下の階層の2ブロックをまとめる(RMSはフレーム数で重み付けする)
+			static void BuildUpperLevel(T_Pyramid& Pyramid, uint32_t Level) noexcept {
+				const uint16_t Channels = Pyramid.Channels;
+				const uint32_t NumBlock = NumBlockOf(Pyramid.NumFrame, Level);
+				const uint32_t NumLowerBlock = NumBlockOf(Pyramid.NumFrame, Level - 1);
+				const uint32_t LowerBlockFrame = kBaseBlockFrame << (Level - 1);
+				const T_Peak* const Lower = &Pyramid.Peak[Pyramid.LevelStart[Level - 1]];
+				T_Peak* const Upper = &Pyramid.Peak[Pyramid.LevelStart[Level]];
+				for (uint32_t Block = 0; Block < NumBlock; ++Block) {
+					const uint32_t Left = Block * 2;
+					const uint32_t Right = Left + 1;
+					const double LeftFrame = double(std::min<uint64_t>(LowerBlockFrame, Pyramid.NumFrame - uint64_t{ Left } * LowerBlockFrame));
+					const double RightFrame = (Right < NumLowerBlock ? double(std::min<uint64_t>(LowerBlockFrame, Pyramid.NumFrame - uint64_t{ Right } * LowerBlockFrame)) : 0.0);
+					for (uint16_t ChannelNo = 0; ChannelNo < Channels; ++ChannelNo) {
+						const T_Peak& L = Lower[size_t{ Left } * Channels + ChannelNo];
+						const T_Peak& R = (Right < NumLowerBlock ? Lower[size_t{ Right } * Channels + ChannelNo] : L);
+						const double Power = (double(L.RMS) * L.RMS * LeftFrame + double(R.RMS) * R.RMS * RightFrame) / (LeftFrame + RightFrame);
+						Upper[size_t{ Block } * Channels + ChannelNo] = { std::min(L.Min, R.Min), std::max(L.Max, R.Max), static_cast<float>(std::sqrt(Power)) };
+					}
+				}
+			}
+
+			explicit T_Waveform(std::shared_ptr<const T_Pyramid> Pyramid) noexcept : Pyramid_(std::move(Pyramid)) {}
+
+		public:
+			T_Waveform() = default;
+
+			[[nodiscard]] bool IsValid() const noexcept { return Pyramid_ != nullptr; }
+			[[nodiscard]] uint32_t NumFrame() const noexcept { return (IsValid() ? Pyramid_->NumFrame : 0); }
+			[[nodiscard]] int32_t Channel() const noexcept { return (IsValid() ? Pyramid_->Channels : 0); }
+			[[nodiscard]] uint32_t SamplesPerSec() const noexcept { return (IsValid() ? Pyramid_->SamplesPerSec : 0); }
+			[[nodiscard]] uint32_t NumLevel() const noexcept { return (IsValid() ? static_cast<uint32_t>(Pyramid_->LevelStart.size() - 1) : 0); }
+			[[nodiscard]] uint32_t BlockFrame(uint32_t Level) const noexcept { return (Level < NumLevel() ? kBaseBlockFrame << Level : 0); }
+			[[nodiscard]] uint32_t NumBlock(uint32_t Level) const noexcept { return (Level < NumLevel() ? NumBlockOf(Pyramid_->NumFrame, Level) : 0); }
+			[[nodiscard]] const std::vector<T_Peak>& PeakList() const noexcept { static const std::vector<T_Peak> kEmpty; return (IsValid() ? Pyramid_->Peak : kEmpty); }
+
+			/**
+			* @brief ブロックの取得
+			*
+			* @param uint32_t Level 階層 (0 = 最下層)
+			* @param uint32_t Block ブロック番号
+			* @param int32_t Channel チャンネル番号
+			* @return Peak 最小値、最大値、RMS (範囲外の場合は全て 0)
+			*/
+			[[nodiscard]] T_Peak Block(uint32_t Level, uint32_t Block, int32_t Channel) const noexcept {
+				if (Block >= NumBlock(Level) || Channel < 0 || Channel >= this->Channel()) { return {}; }
+				return Pyramid_->Peak[Pyramid_->LevelStart[Level] + size_t{ Block } * Pyramid_->Channels + static_cast<size_t>(Channel)];
+			}
+
+			/**
+			* @brief 表示範囲の波形概要を取得
+			*
+			* 　指定範囲を NumPixel 個に分割し、1ピクセルのフレーム数以下で最も粗い階層からピクセルごとの最小値、最大値、RMSを求めます
+			*
+			* 　1ピクセルが kBaseBlockFrame フレームより短い場合は最下層のブロックを使用します
+			*
+			* @param uint32_t StartFrame 開始サンプルフレーム
+			* @param uint32_t NumFrame 表示するサンプルフレーム数
+			* @param uint32_t NumPixel ピクセル数
+			* @param int32_t Channel チャンネル番号 (kAllChannel の場合は全チャンネルをまとめる)
+			* @return std::vector<Peak> ピクセルごとの最小値、最大値、RMS (範囲外のピクセルは全て 0)
+			*/
+			[[nodiscard]] std::vector<T_Peak> Render(uint32_t StartFrame, uint32_t NumFrame, uint32_t NumPixel, int32_t Channel = kAllChannel) const {
+				std::vector<T_Peak> Result(NumPixel);
+				if (!IsValid() || !NumPixel || !NumFrame || StartFrame >= this->NumFrame() || Channel >= this->Channel() || Channel < kAllChannel) { return Result; }
+
+				const double FramePerPixel = double(NumFrame) / NumPixel;
+				uint32_t Level = 0;
+				while (Level + 1 < NumLevel() && BlockFrame(Level + 1) <= FramePerPixel) { ++Level; }
+				const uint32_t LevelBlockFrame = BlockFrame(Level);
+				const uint32_t LevelNumBlock = NumBlock(Level);
+				const int32_t FirstChannel = (Channel == kAllChannel ? 0 : Channel);
+				const int32_t LastChannel = (Channel == kAllChannel ? this->Channel() : Channel + 1);
+
+				for (uint32_t Pixel = 0; Pixel < NumPixel; ++Pixel) {
+					const uint64_t First = StartFrame + static_cast<uint64_t>(Pixel * FramePerPixel);
+					const uint64_t Last = std::min<uint64_t>(StartFrame + static_cast<uint64_t>((Pixel + 1) * FramePerPixel), this->NumFrame());
+					if (First >= this->NumFrame()) { break; }
+					const uint32_t FirstBlock = static_cast<uint32_t>(First / LevelBlockFrame);
+					const uint32_t LastBlock = std::min<uint32_t>(LevelNumBlock, static_cast<uint32_t>((std::max<uint64_t>(First + 1, Last) + LevelBlockFrame - 1) / LevelBlockFrame));
+
+					T_Peak PixelPeak = Block(Level, FirstBlock, FirstChannel);
+					double Power = 0.0;
+					double Count = 0.0;
+					for (uint32_t BlockNo = FirstBlock; BlockNo < LastBlock; ++BlockNo) {
+						for (int32_t ChannelNo = FirstChannel; ChannelNo < LastChannel; ++ChannelNo) {
+							const T_Peak& Source = Pyramid_->Peak[Pyramid_->LevelStart[Level] + size_t{ BlockNo } * Pyramid_->Channels + static_cast<size_t>(ChannelNo)];
+							PixelPeak.Min = std::min(PixelPeak.Min, Source.Min);
+							PixelPeak.Max = std::max(PixelPeak.Max, Source.Max);
+							Power += double(Source.RMS) * Source.RMS;
+							Count += 1.0;
+						}
+					}
+					PixelPeak.RMS = static_cast<float>(std::sqrt(Power / Count));
+					Result[Pixel] = PixelPeak;
+				}
+				return Result;
+			}
+
+			struct T_Source {
+				const unsigned char* Data = nullptr;
+				const T_SampleFormat* SampleFormat = nullptr;
+			};
+
+			/**
+			* @brief 波形概要の作成
+			*
+			* 　全サウンドの最下層を kParallelBlock ブロック単位に分けて並列に求め、上の階層は下の階層から求めます
+			*
+			* 　長いサウンドも複数のスレッドで処理されます
+			*
+			* @param const std::vector<T_Source>& SourceList サンプルデータとフォーマット (Data が nullptr の場合は作成しない)
+			* @return std::vector<Waveform> 波形概要 (作成しないもしくは変換できないフォーマットの場合は IsValid() が false)
+			*/
+			[[nodiscard]] static std::vector<T_Waveform> Build(const std::vector<T_Source>& SourceList) {
+				struct T_Task {
+					size_t SourceIndex = 0;
+					uint32_t FirstBlock = 0;
+					uint32_t LastBlock = 0;
+				};
+				std::vector<std::shared_ptr<T_Pyramid>> PyramidList(SourceList.size());
+				std::vector<T_Task> TaskList;
+				for (size_t index = 0; index < SourceList.size(); ++index) {
+					const T_Source& Source = SourceList[index];
+					if (!Source.Data || !Source.SampleFormat->IsSupported() || !Source.SampleFormat->NumFrame()) { continue; }
+					auto Pyramid = std::make_shared<T_Pyramid>();
+					Pyramid->NumFrame = Source.SampleFormat->NumFrame();
+					Pyramid->Channels = Source.SampleFormat->Channels();
+					Pyramid->SamplesPerSec = Source.SampleFormat->SamplesPerSec();
+					Pyramid->LevelStart = LevelStartOf(Pyramid->NumFrame, Pyramid->Channels);
+					Pyramid->Peak.resize(Pyramid->LevelStart.back());
+					const uint32_t NumBaseBlock = NumBlockOf(Pyramid->NumFrame, 0);
+					for (uint32_t FirstBlock = 0; FirstBlock < NumBaseBlock; FirstBlock += kParallelBlock) {
+						TaskList.push_back({ index, FirstBlock, std::min(NumBaseBlock, FirstBlock + kParallelBlock) });
+					}
+					PyramidList[index] = std::move(Pyramid);
+				}
+
+				Parallel::For(TaskList.size(), [&SourceList, &PyramidList, &TaskList](size_t index) {
+					const T_Task& Task = TaskList[index];
+					const T_Source& Source = SourceList[Task.SourceIndex];
+					BuildBaseLevel(Source.Data, *Source.SampleFormat, Task.FirstBlock, Task.LastBlock, PyramidList[Task.SourceIndex]->Peak.data());
+				});
+				Parallel::For(PyramidList.size(), [&PyramidList](size_t index) {
+					if (!PyramidList[index]) { return; }
+					for (uint32_t Level = 1; Level + 1 < PyramidList[index]->LevelStart.size(); ++Level) { BuildUpperLevel(*PyramidList[index], Level); }
+				});
+
+				std::vector<T_Waveform> WaveformList(SourceList.size());
+				for (size_t index = 0; index < PyramidList.size(); ++index) {
+					if (PyramidList[index]) { WaveformList[index] = T_Waveform(std::move(PyramidList[index])); }
+				}
+				return WaveformList;
+			}
+
+			// キャッシュファイルの1件分(内容ハッシュ、フレーム数、チャンネル数、ヘルツ、Peak数、Peak)
+			void Write(std::vector<unsigned char>& buffer, uint64_t SoundHash) const {
+				if (!IsValid()) { return; }
+				const size_t Start = buffer.size();
+				buffer.resize(Start + 24 + Pyramid_->Peak.size() * 12);
+				unsigned char* const Dst = &buffer[Start];
+				EncodeEndian::UInt64LE(&Dst[0], SoundHash);
+				EncodeEndian::UInt32LE(&Dst[8], Pyramid_->NumFrame);
+				EncodeEndian::UInt32LE(&Dst[12], Pyramid_->Channels);
+				EncodeEndian::UInt32LE(&Dst[16], Pyramid_->SamplesPerSec);
+				EncodeEndian::UInt32LE(&Dst[20], static_cast<uint32_t>(Pyramid_->Peak.size()));
+				for (size_t index = 0; index < Pyramid_->Peak.size(); ++index) {
+					const float Value[3] = { Pyramid_->Peak[index].Min, Pyramid_->Peak[index].Max, Pyramid_->Peak[index].RMS };
+					for (int32_t Element = 0; Element < 3; ++Element) {
+						uint32_t Bits = 0;
+						std::memcpy(&Bits, &Value[Element], sizeof(Bits));
+						EncodeEndian::UInt32LE(&Dst[24 + index * 12 + Element * 4], Bits);
+					}
+				}
+			}
+
+			// 読み取った件数分 Offset を進める(形式が正しくない場合は false)
+			[[nodiscard]] static bool Read(const std::vector<unsigned char>& buffer, size_t& Offset, uint64_t& SoundHash, T_Waveform& Waveform) {
+				if (buffer.size() - Offset < 24) { return false; }
+				const unsigned char* const Src = &buffer[Offset];
+				auto Pyramid = std::make_shared<T_Pyramid>();
+				SoundHash = DecodeEndian::UInt64LE(&Src[0]);
+				Pyramid->NumFrame = DecodeEndian::UInt32LE(&Src[8]);
+				const uint32_t Channels = DecodeEndian::UInt32LE(&Src[12]);
+				Pyramid->SamplesPerSec = DecodeEndian::UInt32LE(&Src[16]);
+				const uint32_t NumPeak = DecodeEndian::UInt32LE(&Src[20]);
+				if (!Channels || Channels > UINT16_MAX || !Pyramid->NumFrame) { return false; }
+				Pyramid->Channels = static_cast<uint16_t>(Channels);
+				Pyramid->LevelStart = LevelStartOf(Pyramid->NumFrame, Pyramid->Channels);
+				if (Pyramid->LevelStart.back() != NumPeak || (buffer.size() - Offset - 24) / 12 < NumPeak) { return false; }
+
+				Pyramid->Peak.resize(NumPeak);
+				for (size_t index = 0; index < NumPeak; ++index) {
+					float Value[3] = {};
+					for (int32_t Element = 0; Element < 3; ++Element) {
+						const uint32_t Bits = DecodeEndian::UInt32LE(&Src[24 + index * 12 + Element * 4]);
+						std::memcpy(&Value[Element], &Bits, sizeof(Bits));
+					}
+					Pyramid->Peak[index] = { Value[0], Value[1], Value[2] };
+				}
+				Offset += 24 + size_t{ NumPeak } * 12;
+				Waveform = T_Waveform(std::move(Pyramid));
+				return true;
+			}
+		};
+
+		// T_SoundList は SoundBinary_ を参照するため、複製、移動はできない(SND間では shared_ptr で共有する)
+		struct T_SNDBinaryData {
+		private:
+			struct T_SoundList {
+			private:
+				const T_SoundPool::SharedBinary kSharedBinary;	// 共有サウンドの場合のみ保持
+				const T_ReadWAVEBinary kWAVEBinary;
+				const T_SampleFormat kSampleFormat;
+				const uint64_t kSoundHash;
+				const bool kHasCommentUTF8;
+				const std::string kCommentUTF8;		// コメントのUTF-8変換設定時のみ保持
+				const std::shared_ptr<const std::vector<unsigned char>> kDecodedBinary;	// ADPCMを展開した16bit PCM(複製時は共有する)
+				const std::shared_ptr<const T_CueData> kCueData;	// ループ区間、マーカーがある場合のみ保持
+				const bool kHasPayloadCRC;
+				const uint32_t kPayloadCRC;		// CRC-32の計算設定時のみ保持
+
+			public:
+				// サウンドの格納前に求められる変換結果(読み込み時はサウンドごとに並列で求める)
+				struct T_Prepared {
+					std::optional<T_ReadWAVEBinary::T_ChunkOffset> ChunkOffset = std::nullopt;	// 格納時にWAVEデータを解析し直さないように引き継ぐ
+					std::optional<T_SampleFormat> SampleFormat = std::nullopt;
+					bool DecodeOnLoad = false;
+					bool HasCommentUTF8 = false;
+					std::string CommentUTF8 = {};
+					std::shared_ptr<const std::vector<unsigned char>> DecodedBinary = nullptr;
+					std::shared_ptr<const T_CueData> CueData = nullptr;
+					bool HasPayloadCRC = false;
+					uint32_t PayloadCRC = 0;
+				};
+
+			private:
+				// 準備済みの場合はチャンク位置を引き継ぎ、未準備の場合は解析する
+				[[nodiscard]] static T_ReadWAVEBinary ReadWAVE(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize, const T_Prepared& Prepared) {
+					return (Prepared.ChunkOffset ? T_ReadWAVEBinary(WAVEVector, SoundSize, *Prepared.ChunkOffset) : T_ReadWAVEBinary(WAVEVector, SoundSize));
+				}
+
+				[[nodiscard]] static std::shared_ptr<const std::vector<unsigned char>> DecodeADPCM(const T_ReadWAVEBinary& WAVEBinary, const T_SampleFormat& SampleFormat) {
+					if (!SampleFormat.IsADPCM() || !SampleFormat.IsSupported()) { return nullptr; }
+					auto Decoded = std::make_shared<std::vector<unsigned char>>(size_t{ SampleFormat.NumFrame() } * SampleFormat.BytesPerFrame());
+					const auto fmtChunk = WAVEBinary.fmtChunk();
+					const auto Coef = (SampleFormat.FormatTag() == WAVEFormatTag::kMSADPCM ? ADPCM::MSCoef(fmtChunk.Extension(), WAVEBinary.fmtExtensionSize()) : std::vector<std::array<int32_t, 2>>());
+					ADPCM::Decode(SampleFormat.FormatTag(), SampleFormat.Channels(), fmtChunk.BlockAlign(), WAVEBinary.dataChunk().Data(), static_cast<uint32_t>(WAVEBinary.dataSize()), SampleFormat.NumFrame(), Coef, Decoded->data());
+					return Decoded;
+				}
+			public:
+				[[nodiscard]] ksize_t SoundStart() const noexcept { return kWAVEBinary.SoundStart(); }
+				[[nodiscard]] ksize_t SoundSize() const noexcept { return kWAVEBinary.SoundSize(); }
+				[[nodiscard]] uint64_t SoundHash() const noexcept { return kSoundHash; }
+				[[nodiscard]] bool IsShared() const noexcept { return kSharedBinary != nullptr; }
+				[[nodiscard]] const T_ReadWAVEBinary& WAVEBinary() const noexcept { return kWAVEBinary; }
+				[[nodiscard]] const T_SampleFormat& SampleFormat() const noexcept { return kSampleFormat; }
+				[[nodiscard]] const unsigned char* SampleData() const noexcept { return (kDecodedBinary ? kDecodedBinary->data() : kWAVEBinary.dataChunk().Data()); }
+				[[nodiscard]] size_t DecodedSize() const noexcept { return (kDecodedBinary ? kDecodedBinary->size() : 0); }
+				[[nodiscard]] bool HasCommentUTF8() const noexcept { return kHasCommentUTF8; }
+				[[nodiscard]] std::string CommentUTF8() const { return (kHasCommentUTF8 ? kCommentUTF8 : TextEncoding::CP932ToUTF8(kWAVEBinary.CommentView())); }
+				[[nodiscard]] const T_CueData& CueData() const noexcept { return (kCueData ? *kCueData : T_CueData::Empty()); }
+				[[nodiscard]] bool HasPayloadCRC() const noexcept { return kHasPayloadCRC; }
+				[[nodiscard]] uint32_t PayloadCRC() const noexcept { return kPayloadCRC; }
+
+				// WAVEVector の末尾 SoundSize バイトのサウンドからWAVEデータの解析、ADPCMの展開、コメントの変換、ループ区間とマーカーの読み取り、CRC-32の計算を行う
+				[[nodiscard]] static T_Prepared Prepare(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize) {
+					const T_ReadWAVEBinary WAVEBinary(WAVEVector, SoundSize);
+					T_Prepared Prepared;
+					Prepared.DecodeOnLoad = T_Config::Instance().DecodeOnLoad();
+					Prepared.ChunkOffset = WAVEBinary.ChunkOffset();
+					Prepared.SampleFormat.emplace(WAVEBinary, Prepared.DecodeOnLoad);
+					Prepared.HasCommentUTF8 = T_Config::Instance().CommentUTF8();
+					if (Prepared.HasCommentUTF8) { Prepared.CommentUTF8 = TextEncoding::CP932ToUTF8(WAVEBinary.CommentView()); }
+					Prepared.DecodedBinary = DecodeADPCM(WAVEBinary, *Prepared.SampleFormat);
+					Prepared.CueData = T_CueData::Read(WAVEBinary);
+					Prepared.HasPayloadCRC = T_Config::Instance().PayloadCRC();
+					if (Prepared.HasPayloadCRC) { Prepared.PayloadCRC = ContentHash::CRC32(WAVEBinary.SoundBinary(), SoundSize); }
+					return Prepared;
+				}
+
+				T_SoundList(const std::vector<unsigned char>& WAVEVector, ksize_t SoundSize, uint64_t SoundHash, T_Prepared&& Prepared)
+					: kSharedBinary(nullptr), kWAVEBinary(ReadWAVE(WAVEVector, SoundSize, Prepared))
+					, kSampleFormat(Prepared.SampleFormat ? *Prepared.SampleFormat : T_SampleFormat(kWAVEBinary, Prepared.DecodeOnLoad)), kSoundHash(SoundHash)
+					, kHasCommentUTF8(Prepared.HasCommentUTF8), kCommentUTF8(std::move(Prepared.CommentUTF8))
+					, kDecodedBinary(std::move(Prepared.DecodedBinary)), kCueData(std::move(Prepared.CueData))
+					, kHasPayloadCRC(Prepared.HasPayloadCRC), kPayloadCRC(Prepared.PayloadCRC) {
+				}
+
+				T_SoundList(const T_SoundPool::SharedBinary& SharedBinary, uint64_t SoundHash, T_Prepared&& Prepared)
+					: kSharedBinary(SharedBinary), kWAVEBinary(ReadWAVE(*kSharedBinary, static_cast<ksize_t>(kSharedBinary->size()), Prepared))
+					, kSampleFormat(Prepared.SampleFormat ? *Prepared.SampleFormat : T_SampleFormat(kWAVEBinary, Prepared.DecodeOnLoad)), kSoundHash(SoundHash)
+					, kHasCommentUTF8(Prepared.HasCommentUTF8), kCommentUTF8(std::move(Prepared.CommentUTF8))
+					, kDecodedBinary(std::move(Prepared.DecodedBinary)), kCueData(std::move(Prepared.CueData))
+					, kHasPayloadCRC(Prepared.HasPayloadCRC), kPayloadCRC(Prepared.PayloadCRC) {
+				}
+			};
+
+			struct T_DataList {
+			private:
+				const ksize_t kSoundListIndex;	// 配列Index
+				const int64_t kSoundNumber;		// GroupNo(-2147483648～2147483647) ItemNo(-2147483648～2147483647)
+			public:
+				[[nodiscard]] ksize_t SoundListIndex() const noexcept { return kSoundListIndex; }
+				[[nodiscard]] int32_t GroupNo() const noexcept { return Convert::DecodeSoundGroupNo(kSoundNumber); }
+				[[nodiscard]] int32_t ItemNo() const noexcept { return Convert::DecodeSoundItemNo(kSoundNumber); }
+
+				T_DataList(ksize_t SoundListIndex, int32_t GroupNo, int32_t ItemNo) noexcept
+					: kSoundListIndex(SoundListIndex)
+					, kSoundNumber(Convert::EncodeSoundNumber(GroupNo, ItemNo)) {
+				}
+			};
+
+			std::vector<T_SoundList> SoundList_ = {};
+			std::vector<T_DataList> DataList_ = {};
+			std::vector<unsigned char> SoundBinary_ = {};
+			ksize_t SoundSize_ = 0;
+			size_t DecodedSize_ = 0; // ADPCMを展開したPCMの合計サイズ
+
+		public:
+			[[nodiscard]] const std::vector<T_SoundList>& SoundList() const noexcept { return SoundList_; }
+			[[nodiscard]] const std::vector<T_DataList>& DataList() const noexcept { return DataList_; }
+			[[nodiscard]] const std::vector<unsigned char>& SoundBinary() const noexcept { return SoundBinary_; }
+			[[nodiscard]] const T_SoundList& SoundList(ksize_t index) const noexcept { return SoundList_[index]; }
+			[[nodiscard]] const T_DataList& DataList(ksize_t index) const noexcept { return DataList_[index]; }
+			[[nodiscard]] ksize_t NumSound() const noexcept { return static_cast<ksize_t>(SoundList_.size()); }
+			
+			[[nodiscard]] const unsigned char* const Sound(ksize_t index) const noexcept {
+				return SoundList_[index].WAVEBinary().SoundBinary();
+			}
+
+			[[nodiscard]] ksize_t SoundSize(ksize_t index) const noexcept {
+				return SoundList_[index].SoundSize();
+			}
+
+			[[nodiscard]] uint64_t SoundHash(ksize_t index) const noexcept {
+				return SoundList_[index].SoundHash();
+			}
+
+			void AddDataList(ksize_t SoundListIndex, int32_t GroupNo, int32_t ItemNo) {
+				DataList_.emplace_back(T_DataList(SoundListIndex, GroupNo, ItemNo));
+			}
+
+			using Prepared = T_SoundList::T_Prepared;
+
+			[[nodiscard]] static Prepared PrepareSound(const std::vector<unsigned char>& LoadSoundData) {
+				return T_SoundList::Prepare(LoadSoundData, static_cast<ksize_t>(LoadSoundData.size()));
+			}
+
+			// PrepareSound で求めた変換結果を使用する
+			void AddSound(const std::vector<unsigned char>& LoadSoundData, uint64_t SoundHash, Prepared&& PreparedSound) {
+				SoundSize_ += static_cast<ksize_t>(LoadSoundData.size());
+
+				// 共有設定時はサウンドプールのデータを参照する
+				if (T_Config::Instance().ShareSoundPool()) {
+					SoundList_.emplace_back(T_SoundList(T_SoundPool::Instance().Register(LoadSoundData, SoundHash), SoundHash, std::move(PreparedSound)));
+				}
+				else {
+					SoundBinary_.insert(SoundBinary_.end(), LoadSoundData.begin(), LoadSoundData.end());
+					SoundList_.emplace_back(T_SoundList(SoundBinary_, static_cast<ksize_t>(LoadSoundData.size()), SoundHash, std::move(PreparedSound)));
+				}
+				DecodedSize_ += SoundList_.back().DecodedSize();
+			}
+
+		public:
+			T_SNDBinaryData() = default;
+			T_SNDBinaryData(const T_SNDBinaryData&) = delete;
+			T_SNDBinaryData& operator=(const T_SNDBinaryData&) = delete;
+
+			// 読み込み前、消去後、移動後のSNDが参照する空のデータ(全SNDで共有するため変更しない)
+			[[nodiscard]] static const std::shared_ptr<T_SNDBinaryData>& Empty() {
+				static const std::shared_ptr<T_SNDBinaryData> Empty = std::make_shared<T_SNDBinaryData>();
+				return Empty;
+			}
+
+			void reserve(ksize_t NumSound, ksize_t FileSize) {
+				SoundList_.reserve(NumSound);
+				DataList_.reserve(NumSound);
+				SoundBinary_.reserve(T_Config::Instance().ShareSoundPool() ? 0 : FileSize);
+			}
+
+			void clear() {
+				SoundList_.clear();
+				DataList_.clear();
+				SoundBinary_.clear();
+				SoundSize_ = 0;
+				DecodedSize_ = 0;
+			}
+
+			void shrink_to_fit() {
+				SoundList_.shrink_to_fit();
+				DataList_.shrink_to_fit();
+			}
+
+			[[nodiscard]] bool empty() const noexcept {
+				return SoundList_.empty() && DataList_.empty() && SoundBinary_.empty();
+			}
+
+			// 共有サウンドを含めたサウンドデータの合計サイズ
+			[[nodiscard]] ksize_t size() const noexcept {
+				return SoundSize_;
+			}
+
+			// このSNDが単独で保持しているサウンドデータのサイズ(共有サウンドを除き、ADPCMを展開したPCMを含む)
+			[[nodiscard]] size_t OwnedSize() const noexcept {
+				return SoundBinary_.size() + DecodedSize_;
+			}
+		};
+
+		struct T_LoadSNDHeader {
+		private:
+			const std::string kRelativePath = {};
+			const std::string kFileName = {};
+			const std::string kFilePath = {};
+			const uintmax_t kFileSize = 0;
+			std::ifstream File = {};
+			unsigned char buffer[24] = {};
+			const bool kCheckError = false;
+			// 0～11 識別子("ElecbyteSnd")
+			// 12～ メイン情報
+			// 24～ コメント
+
+			[[nodiscard]] const std::string EnsureSndExtension(const std::filesystem::path& FileName) const {
+				std::filesystem::path FixedFileName = FileName;
+				if (FixedFileName.extension() != SNDFormat::kExtension) {
+					if (!FixedFileName.extension().empty()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDExtension);
+					}
+					FixedFileName.replace_extension(SNDFormat::kExtension);
+				}
+				return FixedFileName.string();
+			}
+
+			// 引数のパス → 検索先の一覧 → SNDConfigの検索パス → カレントディレクトリ の順に使用
+			[[nodiscard]] const std::string FindFilePathDown(const std::string& FilePath, const T_SearchPath& SearchPath) const {
+				if (FilePath.empty() && !SearchPath.empty()) {
+					const std::filesystem::path Found = SearchPath.Find(kRelativePath);
+					if (Found.empty()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::NotFound_SNDFile);
+					}
+					return Found.string();
+				}
+
+				T_FilePathSystem SNDFolder;
+				if (!FilePath.empty()) {
+					SNDFolder.SetPath(FilePath);
+					if (SNDFolder.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_LoadSNDPath);
+					}
+				}
+				if (FilePath.empty() || SNDFolder.ErrorCode() && !T_Config::Instance().SNDSearchPath().empty()) {
+					SNDFolder.SetPath(T_Config::Instance().SNDSearchPath());
+					if (SNDFolder.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSearchPath);
+					}
+				}
+				const std::filesystem::path AbsolutePath = (std::filesystem::exists(SNDFolder.Path()) ? SNDFolder.Path() : std::filesystem::canonical(std::filesystem::current_path()));
+
+				const std::filesystem::path Found = T_SearchPath().AddRoot(AbsolutePath).Find(kRelativePath);
+				if (Found.empty()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::NotFound_SNDFile);
+				}
+				return Found.string();
+			}
+
+			[[nodiscard]] bool CheckFileSize() const {
+				if (kFileSize <= UINT32_MAX) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDFileSize);
+				return true;
+			}
+			[[nodiscard]] bool CheckFilePath() const {
+				if (!FilePath().empty()) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_EmptySNDFilePath);
+				return true;
+			}
+			[[nodiscard]] bool CheckFileOpen() {
+				File.open(FilePath(), std::ios::binary);
+				if (File.is_open()) { return false; }
+				T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_OpenSNDFile);
+				return true;
+			}
+
+			[[nodiscard]] bool CheckSNDFormat() {
+				// ファイル読み取りが絡むので一か所にまとめた
+				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
+				const bool IsShortHeader = File.gcount() != static_cast<std::streamsize>(sizeof(buffer)); // サウンド数を読み取れない
+
+				if (IsCompressed()) {
+					if (IsShortHeader || CompressedVersion() != SNDFormat::kCompressedVersion) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+						return true;
+					}
+					return false;
+				}
+
+				if (Signature() != SNDFormat::kSignature) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSignature);
+					return true;
+				}
+				
+				// 修復設定時は既定の位置からサブヘッダーを辿る
+				if (IsShortHeader || (SubHeaderStart() != SNDFormat::kSubHeaderStart && !T_Config::Instance().RecoverSND())) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+					return true;
+				}
+				return false;
+			}
+
+			[[nodiscard]] bool CheckFileError() { // CheckFileOpen → CheckSNDFormat の順で実行
+				return CheckFileSize() || CheckFilePath() || CheckFileOpen() || CheckSNDFormat();
+			}
+
+		public:
+			[[nodiscard]] const std::string& FileName() const noexcept { return kFileName; }
+			[[nodiscard]] const std::string& FilePath() const noexcept { return kFilePath; }
+			[[nodiscard]] ksize_t FileSize() const noexcept { return static_cast<ksize_t>(kFileSize); }
+			[[nodiscard]] std::string_view Signature() const noexcept { return std::string_view(reinterpret_cast<const char*>(buffer), SNDFormat::kSignature.size()); }
+			[[nodiscard]] uint32_t Version() const noexcept { return DecodeEndian::UInt32BE(&buffer[12]); }
+			[[nodiscard]] uint32_t NumSound() const noexcept { return DecodeEndian::UInt32LE(&buffer[16]); }
+			[[nodiscard]] uint32_t SubHeaderStart() const noexcept { return DecodeEndian::UInt32LE(&buffer[20]); }
+			[[nodiscard]] bool IsCompressed() const noexcept { return std::string_view(reinterpret_cast<const char*>(buffer), SNDFormat::kCompressedSignature.size()) == SNDFormat::kCompressedSignature; }
+			[[nodiscard]] uint32_t CompressedVersion() const noexcept { return DecodeEndian::UInt32LE(&buffer[12]); }
+			[[nodiscard]] uint32_t NumPayload() const noexcept { return DecodeEndian::UInt32LE(&buffer[20]); }
+			[[nodiscard]] bool CheckError() const noexcept { return kCheckError; }
+
+		public:
+			T_LoadSNDHeader(const std::string& FileName, const std::string& FilePath, const T_SearchPath& SearchPath = {})
+				: kRelativePath(EnsureSndExtension(FileName)), kFileName(std::filesystem::path(kRelativePath).filename().string()), kFilePath(FindFilePathDown(FilePath, SearchPath))
+				, kFileSize(kFilePath.empty() ? 0 : std::filesystem::file_size(kFilePath)), kCheckError(CheckFileError()) {
+			}
+
+			void seekg(std::streampos& _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
+				File.seekg(_Pos, _Way);
+			}
+			void seekg(uint32_t _Pos, std::ios_base::seekdir _Way = std::ios::beg) {
+				File.seekg(_Pos, _Way);
+			}
+
+			void read(char* _Str, std::streamsize _Count) {
+				File.read(_Str, _Count);
+			}
+
+			[[nodiscard]] std::streampos tellg() {
+				return File.tellg();
+			}
+		};
+
+		// SND読み込み時のサブヘッダー情報格納先
+		// 非同期読み込みの進捗と中断要求(読み込み途中のデータはDataMutexで保護する)
+		struct T_LoadState {
+		private:
+			std::vector<std::function<void()>> CallbackList_ = {};
+			std::mutex CallbackMutex_;
+			bool Done_ = false;
+
+		public:
+			std::atomic<ksize_t> NumLoaded = 0;
+			std::atomic<ksize_t> NumSound = 0;
+			std::atomic<bool> Cancel = false;
+			std::mutex DataMutex;
+
+			// 同期読み込みの場合(nullptr)はロックしない
+			[[nodiscard]] static std::unique_lock<std::mutex> Lock(T_LoadState* State) {
+				return (State ? std::unique_lock<std::mutex>(State->DataMutex) : std::unique_lock<std::mutex>());
+			}
+			[[nodiscard]] static bool IsCancelled(const T_LoadState* State) noexcept {
+				return State && State->Cancel.load(std::memory_order_relaxed);
+			}
+			static void Progress(T_LoadState* State, ksize_t NumLoaded) noexcept {
+				if (State) { State->NumLoaded.store(NumLoaded, std::memory_order_release); }
+			}
+
+			[[nodiscard]] bool IsDone() {
+				std::lock_guard<std::mutex> Guard(CallbackMutex_);
+				return Done_;
+			}
+
+			// 読み込み完了時に呼び出す処理を登録(完了済みの場合はその場で呼び出す)
+			void OnComplete(std::function<void()> Callback) {
+				{
+					std::lock_guard<std::mutex> Guard(CallbackMutex_);
+					if (!Done_) {
+						CallbackList_.emplace_back(std::move(Callback));
+						return;
+					}
+				}
+				Callback();
+			}
+
+			void Complete() {
+				std::vector<std::function<void()>> CallbackList;
+				{
+					std::lock_guard<std::mutex> Guard(CallbackMutex_);
+					Done_ = true;
+					CallbackList.swap(CallbackList_);
+				}
+				for (auto& Callback : CallbackList) { Callback(); }
+			}
+		};
+
+		// サブヘッダーを辿った結果(読み取れなかった範囲とサウンド数)
+		struct T_RecoveryReport {
+			struct T_LostRange {
+				uint32_t Start = 0;				// ファイル先頭からの開始位置
+				uint32_t End = 0;				// 終了位置(この位置を含まない)
+				bool HasSoundNumber = false;	// 範囲の先頭が壊れたサウンドのサブヘッダーの場合は true
+				int32_t GroupNo = 0;			// サブヘッダーに記録されたサウンド番号(HasSoundNumber が false の場合は 0)
+				int32_t ItemNo = 0;
+			};
+			using LostRange = T_LostRange;
+
+			std::vector<T_LostRange> LostRangeList = {};
+			uint32_t NumSound = 0;	// ヘッダーに記録されたサウンド数
+			uint32_t NumEntry = 0;	// 読み取れたサウンド数(番号が重複して読み込まなかったサウンドを含む)
+			uint32_t NumResync = 0;	// 次の正しいサウンドを探して読み取りを再開した回数
+
+			[[nodiscard]] bool IsCorrupted() const noexcept { return !LostRangeList.empty() || NumEntry < NumSound; }
+			[[nodiscard]] uint32_t NumLost() const noexcept { return (NumEntry < NumSound ? NumSound - NumEntry : 0); }
+		};
+
+		struct T_LoadSNDSubHeader {
+		private:
+			unsigned char buffer[16] = {}; // 主要部分の情報のみ格納
+			// 0～16 メイン情報
+			// 17～  WAVEデータ
+			T_LoadSNDHeader& File;
+
+			// 一度に読み込んで並列に処理するサウンドデータの合計サイズ(1サウンドがこれより大きい場合は1つずつ処理する)
+			inline static constexpr uint64_t kBatchSize = uint64_t{ 8 } << 20;
+
+			struct T_EntryList {
+				uint32_t Offset = 0;	// サウンドデータの開始位置
+				uint32_t DataSize = 0;
+				int32_t GroupNo = 0;
+				int32_t ItemNo = 0;
+			};
+
+			std::vector<T_EntryList> EntryList = {};
+
+			[[nodiscard]] bool CheckReadError(uint64_t Position) const noexcept { // データの末尾に到達orアドレスかサイズが不正な値
+				return !NextAddress() || NextAddress() < Position + sizeof(buffer) || DataSize() > FileSize();
+			}
+
+			// 読み取りを再開する位置を探す際に一度に読み込むサイズ
+			inline static constexpr uint32_t kScanBlockSize = 64 * 1024;
+
+			[[nodiscard]] uint64_t FileSize() const noexcept { return File.FileSize(); }
+
+			// 見つかったサウンドを登録する(サウンド番号が重複したサウンドは読み込まない)
+			void AddEntry(uint64_t Position, T_UnorderedMap<int64_t>& EntryNumberUMap, T_RecoveryReport& Report) {
+				++Report.NumEntry;
+				if (EntryNumberUMap.exist(GroupNo(), ItemNo())) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Warning_DuplicateSoundNumber, GroupNo(), ItemNo());
+					return;
+				}
+				EntryNumberUMap.Register(GroupNo(), ItemNo());
+				EntryList.push_back({ static_cast<uint32_t>(Position + sizeof(buffer)), DataSize(), static_cast<int32_t>(GroupNo()), static_cast<int32_t>(ItemNo()) });
+			}
+
+			// Start～End を失われた範囲とする(サブヘッダーを読み取れた場合はそのサウンド番号も記録する)
+			[[nodiscard]] T_RecoveryReport::T_LostRange LostRange(uint64_t Start, uint64_t End, bool HasSubHeader) const noexcept {
+				T_RecoveryReport::T_LostRange Lost;
+				Lost.Start = static_cast<uint32_t>(Start);
+				Lost.End = static_cast<uint32_t>(End);
+				Lost.HasSoundNumber = HasSubHeader;
+				if (HasSubHeader) {
+					Lost.GroupNo = static_cast<int32_t>(GroupNo());
+					Lost.ItemNo = static_cast<int32_t>(ItemNo());
+				}
+				return Lost;
+			}
+
+			// サブヘッダーを読み取る(ファイルに収まらない場合は false)
+			[[nodiscard]] bool ReadSubHeader(uint64_t Position) {
+				if (Position + sizeof(buffer) > FileSize()) { return false; }
+				File.seekg(static_cast<uint32_t>(Position));
+				File.read(reinterpret_cast<char*>(&buffer), sizeof(buffer));
+				return true;
+			}
+
+			// サウンドデータがファイルに収まり、RIFF/WAVE形式で始まるか(サブヘッダーは読み取り済み)
+			[[nodiscard]] bool IsValidEntry(uint64_t Position) {
+				const uint64_t SoundStart = Position + sizeof(buffer);
+				if (DataSize() < 12 || SoundStart + DataSize() > FileSize()) { return false; }
+				unsigned char RIFFHeader[12] = {};
+				File.seekg(static_cast<uint32_t>(SoundStart));
+				File.read(reinterpret_cast<char*>(RIFFHeader), sizeof(RIFFHeader));
+				return !std::memcmp(&RIFFHeader[0], "RIFF", 4) && !std::memcmp(&RIFFHeader[8], "WAVE", 4);
+			}
+
+			// Start～End の範囲で最初の 0 以外のデータの位置(全て 0 の場合は無し)
+			[[nodiscard]] std::optional<uint64_t> FindNonZero(uint64_t Start, uint64_t End) {
+				std::vector<unsigned char> Block(kScanBlockSize);
+				for (uint64_t Offset = Start; Offset < End; Offset += kScanBlockSize) {
+					const uint32_t ReadSize = static_cast<uint32_t>(std::min<uint64_t>(kScanBlockSize, End - Offset));
+					File.seekg(static_cast<uint32_t>(Offset));
+					File.read(reinterpret_cast<char*>(Block.data()), ReadSize);
+					const auto NonZero = std::find_if(Block.begin(), Block.begin() + ReadSize, [](unsigned char c) { return c != 0; });
+					if (NonZero != Block.begin() + ReadSize) { return Offset + (NonZero - Block.begin()); }
+				}
+				return std::nullopt;
+			}
+
+			// From 以降で、直前のサブヘッダーを含めて正しいサウンドとして読み取れる最初の "RIFF" を探し、そのサブヘッダーの位置を返す(見つからない場合は無し)
+			[[nodiscard]] std::optional<uint64_t> FindNextEntry(uint64_t From) {
+				std::vector<unsigned char> Block(kScanBlockSize);
+				uint64_t ScanStart = From + sizeof(buffer);
+				while (ScanStart + 12 <= FileSize()) {
+					const uint32_t ReadSize = static_cast<uint32_t>(std::min<uint64_t>(kScanBlockSize, FileSize() - ScanStart));
+					File.seekg(static_cast<uint32_t>(ScanStart));
+					File.read(reinterpret_cast<char*>(Block.data()), ReadSize);
+					const std::string_view View(reinterpret_cast<const char*>(Block.data()), ReadSize);
+					for (size_t Found = View.find("RIFF"); Found != std::string_view::npos; Found = View.find("RIFF", Found + 1)) {
+						const uint64_t Position = ScanStart + Found - sizeof(buffer);
+						if (ReadSubHeader(Position) && IsValidEntry(Position)) { return Position; }
+					}
+					if (ScanStart + ReadSize >= FileSize()) { break; }
+					ScanStart += ReadSize - 3; // ブロックの境界をまたぐ "RIFF" を見つけるため3バイト重ねる
+				}
+				return std::nullopt;
+			}
+
+			// サブヘッダーだけを順に辿ってサウンドの位置を集める
+			// 修復設定時は次のアドレスが不正な場合やサウンドデータが壊れている場合に、最後に読み取れたサウンドの後ろから次の正しいサウンドを探して読み取りを再開する
+			void ReadEntryList(T_RecoveryReport& Report, T_LoadState* State) {
+				const bool Recover = T_Config::Instance().RecoverSND();
+				const ksize_t NumReserve = static_cast<ksize_t>(std::min<uint64_t>(File.NumSound(), FileSize() / sizeof(buffer)));
+				T_UnorderedMap<int64_t> EntryNumberUMap;
+				EntryNumberUMap.reserve(NumReserve);
+				EntryList.reserve(NumReserve);
+				Report.NumSound = File.NumSound();
+
+				uint64_t Position = SNDFormat::kSubHeaderStart;
+				if (!Recover) {
+					for (uint32_t LoadNo = 0; LoadNo < File.NumSound(); ++LoadNo) {
+						if (T_LoadState::IsCancelled(State)) { break; }
+						const bool HasSubHeader = ReadSubHeader(Position);
+						if (!HasSubHeader || CheckReadError(Position)) {
+							if (Position < FileSize()) { Report.LostRangeList.push_back(LostRange(Position, FileSize(), HasSubHeader)); }
+							break;
+						}
+						AddEntry(Position, EntryNumberUMap, Report);
+						// サウンドデータがファイルの末尾で切れている場合はそのサウンドから読み取れなかった範囲とする
+						if (Position + sizeof(buffer) + DataSize() > FileSize()) {
+							Report.LostRangeList.push_back(LostRange(Position, FileSize(), true));
+							break;
+						}
+						Position = NextAddress();
+					}
+					return;
+				}
+
+				uint64_t ValidEnd = Position; // 最後に読み取れたサウンドデータの終端
+				while (Position < FileSize() && !T_LoadState::IsCancelled(State)) {
+					const bool HasSubHeader = ReadSubHeader(Position);
+					const bool IsValid = HasSubHeader && IsValidEntry(Position);
+					if (IsValid) {
+						AddEntry(Position, EntryNumberUMap, Report);
+						ValidEnd = Position + sizeof(buffer) + DataSize();
+						if (NextAddress() >= ValidEnd && NextAddress() <= FileSize()) {
+							Position = NextAddress();
+							continue;
+						}
+						// 最後のサウンドの次のアドレスは 0 の場合がある
+						if (Report.NumEntry >= File.NumSound() && !NextAddress()) { break; }
+					}
+
+					// 壊れていたサウンドはサブヘッダーのサウンド番号を記録する(探索でサブヘッダーを上書きする前に求める)
+					const bool IsZeroSubHeader = std::all_of(std::begin(buffer), std::end(buffer), [](unsigned char c) { return c == 0; });
+					T_RecoveryReport::T_LostRange Lost = LostRange(ValidEnd, FileSize(), !IsValid && HasSubHeader && !IsZeroSubHeader);
+					const std::optional<uint64_t> NextEntry = FindNextEntry(ValidEnd);
+					Lost.End = static_cast<uint32_t>(NextEntry.value_or(FileSize()));
+
+					// 0 のみの範囲は整列用の詰め物として扱う
+					if (const std::optional<uint64_t> LostStart = FindNonZero(ValidEnd, Lost.End)) {
+						Lost.Start = static_cast<uint32_t>(*LostStart);
+						Report.LostRangeList.push_back(Lost);
+					}
+					if (!NextEntry) { break; }
+					++Report.NumResync;
+					Position = *NextEntry;
+				}
+			}
+
+		public:
+			[[nodiscard]] uint32_t NextAddress() const noexcept { return DecodeEndian::UInt32LE(&buffer[0]); }
+			[[nodiscard]] uint32_t DataSize() const noexcept { return DecodeEndian::UInt32LE(&buffer[4]); }
+			[[nodiscard]] uint32_t GroupNo() const noexcept { return DecodeEndian::UInt32LE(&buffer[8]); }
+			[[nodiscard]] uint32_t ItemNo() const noexcept { return DecodeEndian::UInt32LE(&buffer[12]); }
+			[[nodiscard]] bool CheckError() { return false; } // 処理が思いつかないので保留
+
+		public:
+			T_LoadSNDSubHeader(T_LoadSNDHeader& LoadSNDHeader) : File(LoadSNDHeader) {}
+
+			// サブヘッダーを辿った後、サウンドデータを kBatchSize ごとに読み込んでハッシュ、WAVEデータの解析、ADPCMの展開を並列に行い、ファイル順に格納する
+			// (内容が同一のサウンドは最初のサウンドを参照する)
+			void ReadSoundBinary(T_UnorderedMap<int64_t>& SoundNumberUMap, T_UnorderedMap<int32_t>& SoundGroupNoUMap, T_SNDBinaryData& SNDBinaryData, T_RecoveryReport& Report, T_LoadState* State = nullptr) {
+				ReadEntryList(Report, State);
+
+				std::unordered_multimap<uint64_t, ksize_t> SoundHashMap;
+				SoundHashMap.reserve(EntryList.size());
+				std::unordered_multimap<uint64_t, size_t> BatchHashMap;
+				std::vector<std::vector<unsigned char>> RawBinary;
+				std::vector<uint64_t> SoundHash;
+				std::vector<std::optional<ksize_t>> SoundListIndex;
+				std::vector<size_t> FirstIndex; // 同じバッチ内で内容が同一の最初のサウンド
+				std::vector<T_SNDBinaryData::Prepared> PreparedSound;
+				size_t BatchStart = 0;
+				while (BatchStart < EntryList.size() && !T_LoadState::IsCancelled(State)) {
+					size_t BatchEnd = BatchStart;
+					uint64_t BatchSize = 0;
+					while (BatchEnd < EntryList.size() && (BatchEnd == BatchStart || BatchSize + EntryList[BatchEnd].DataSize <= kBatchSize)) {
+						BatchSize += EntryList[BatchEnd++].DataSize;
+					}
+
+					// ファイルの末尾を超えた部分は 0 で埋める
+					const size_t NumBatch = BatchEnd - BatchStart;
+					if (RawBinary.size() < NumBatch) { RawBinary.resize(NumBatch); }
+					for (size_t index = 0; index < NumBatch; ++index) {
+						const T_EntryList& Entry = EntryList[BatchStart + index];
+						RawBinary[index].resize(Entry.DataSize);
+						const uint32_t ReadSize = (Entry.Offset < File.FileSize() ? std::min<uint32_t>(Entry.DataSize, File.FileSize() - Entry.Offset) : 0);
+						File.seekg(Entry.Offset);
+						File.read(reinterpret_cast<char*>(RawBinary[index].data()), ReadSize);
+					}
+
+					SoundHash.assign(NumBatch, 0);
+					Parallel::For(NumBatch, [&RawBinary, &SoundHash](size_t index) {
+						SoundHash[index] = ContentHash::FNV1a64(RawBinary[index].data(), RawBinary[index].size());
+					});
+
+					// サウンドデータ重複チェック(格納済みのサウンド、同じバッチ内の前のサウンドの順に探す)
+					SoundListIndex.assign(NumBatch, std::nullopt);
+					FirstIndex.assign(NumBatch, 0);
+					BatchHashMap.clear();
+					for (size_t index = 0; index < NumBatch; ++index) {
+						const std::vector<unsigned char>& WAVEBinary = RawBinary[index];
+						const auto Range = SoundHashMap.equal_range(SoundHash[index]);
+						for (auto it = Range.first; it != Range.second && !SoundListIndex[index]; ++it) {
+							if (SNDBinaryData.SoundSize(it->second) == WAVEBinary.size() && !std::memcmp(SNDBinaryData.Sound(it->second), WAVEBinary.data(), WAVEBinary.size())) {
+								SoundListIndex[index] = it->second;
+							}
+						}
+						if (SoundListIndex[index]) { continue; }
+
+						FirstIndex[index] = index;
+						const auto BatchRange = BatchHashMap.equal_range(SoundHash[index]);
+						for (auto it = BatchRange.first; it != BatchRange.second; ++it) {
+							if (RawBinary[it->second] == WAVEBinary) {
+								FirstIndex[index] = it->second;
+								break;
+							}
+						}
+						if (FirstIndex[index] == index) { BatchHashMap.emplace(SoundHash[index], index); }
+					}
+
+					// WAVEデータの解析とADPCMの展開は新規サウンドのみ行う
+					PreparedSound.assign(NumBatch, T_SNDBinaryData::Prepared());
+					Parallel::For(NumBatch, [&RawBinary, &SoundListIndex, &FirstIndex, &PreparedSound](size_t index) {
+						if (!SoundListIndex[index] && FirstIndex[index] == index) {
+							PreparedSound[index] = T_SNDBinaryData::PrepareSound(RawBinary[index]);
+						}
+					});
+
+					const auto Lock = T_LoadState::Lock(State);
+					for (size_t index = 0; index < NumBatch; ++index) {
+						const T_EntryList& Entry = EntryList[BatchStart + index];
+
+						// 新規サウンドの場合はサウンドデータを格納
+						if (!SoundListIndex[index] && FirstIndex[index] != index) {
+							SoundListIndex[index] = SoundListIndex[FirstIndex[index]];
+						}
+						else if (!SoundListIndex[index]) {
+							SoundListIndex[index] = SNDBinaryData.NumSound();
+							SNDBinaryData.AddSound(RawBinary[index], SoundHash[index], std::move(PreparedSound[index]));
+							SoundHashMap.emplace(SoundHash[index], *SoundListIndex[index]);
+						}
+
+						SoundNumberUMap.Register(Entry.GroupNo, Entry.ItemNo);
+						// グループ数の取得用
+						if (!SoundGroupNoUMap.exist(Entry.GroupNo)) {
+							SoundGroupNoUMap.Register(Entry.GroupNo);
+						}
+						SNDBinaryData.AddDataList(*SoundListIndex[index], Entry.GroupNo, Entry.ItemNo);
+					}
+					BatchStart = BatchEnd;
+					T_LoadState::Progress(State, static_cast<ksize_t>(BatchStart));
+				}
+			}
+		};
+
+		// 圧縮SNDファイルの読み込み(サウンドごとに独立して並列展開する)
+		struct T_LoadSNDCompressed {
+		private:
+			T_LoadSNDHeader& File;
+
+			struct T_EntryList {
+				int32_t GroupNo = 0;
+				int32_t ItemNo = 0;
+				uint32_t PayloadIndex = 0;
+			};
+
+			struct T_PayloadList {
+				uint32_t Offset = 0;
+				uint32_t CompressedSize = 0;
+				uint32_t RawSize = 0;
+			};
+
+			std::vector<T_EntryList> EntryList = {};
+			std::vector<T_PayloadList> PayloadList = {};
+
+			[[nodiscard]] uint64_t IndexEnd() const noexcept {
+				return SNDFormat::kCompressedHeaderSize + (uint64_t{ File.NumSound() } + File.NumPayload()) * SNDFormat::kCompressedIndexSize;
+			}
+
+			[[nodiscard]] bool ReadIndex() {
+				if (IndexEnd() > File.FileSize()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+					return true;
+				}
+
+				std::vector<unsigned char> buffer(static_cast<size_t>(IndexEnd() - SNDFormat::kCompressedHeaderSize));
+				File.seekg(SNDFormat::kCompressedHeaderSize);
+				File.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+
+				const unsigned char* Index = buffer.data();
+				EntryList.resize(File.NumSound());
+				for (auto& Entry : EntryList) {
+					Entry.GroupNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&Index[0]));
+					Entry.ItemNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&Index[4]));
+					Entry.PayloadIndex = DecodeEndian::UInt32LE(&Index[8]);
+					Index += SNDFormat::kCompressedIndexSize;
+					if (Entry.PayloadIndex >= File.NumPayload()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+						return true;
+					}
+				}
+				PayloadList.resize(File.NumPayload());
+				for (auto& Payload : PayloadList) {
+					Payload.Offset = DecodeEndian::UInt32LE(&Index[0]);
+					Payload.CompressedSize = DecodeEndian::UInt32LE(&Index[4]);
+					Payload.RawSize = DecodeEndian::UInt32LE(&Index[8]);
+					Index += SNDFormat::kCompressedIndexSize;
+					if (Payload.Offset < IndexEnd() || uint64_t{ Payload.Offset } + Payload.CompressedSize > File.FileSize()
+						|| Payload.RawSize > LZ4Block::MaxDecompressedSize(Payload.CompressedSize)) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+						return true;
+					}
+				}
+				return false;
+			}
+
+		public:
+			T_LoadSNDCompressed(T_LoadSNDHeader& LoadSNDHeader) : File(LoadSNDHeader) {}
+
+			[[nodiscard]] bool ReadSoundBinary(T_UnorderedMap<int64_t>& SoundNumberUMap, T_UnorderedMap<int32_t>& SoundGroupNoUMap, T_SNDBinaryData& SNDBinaryData, T_LoadState* State = nullptr) {
+				if (ReadIndex()) { return true; }
+				if (T_LoadState::IsCancelled(State)) { return true; }
+
+				// 展開後のサイズは展開用の領域を確保する前に確認する
+				uint64_t RawSize = 0;
+				for (const auto& Payload : PayloadList) { RawSize += Payload.RawSize; }
+				if (RawSize > SNDFormat::kFileSizeLimit) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDFileSize);
+					return true;
+				}
+
+				// 圧縮データを一括で読み込み
+				std::vector<unsigned char> CompressedBinary(static_cast<size_t>(File.FileSize() - IndexEnd()));
+				File.read(reinterpret_cast<char*>(CompressedBinary.data()), CompressedBinary.size());
+
+				// 圧縮データごとに並列展開(圧縮サイズと展開サイズが同じ場合は無圧縮で格納されている)
+				std::vector<std::vector<unsigned char>> RawBinary(PayloadList.size());
+				std::vector<uint64_t> SoundHash(PayloadList.size());
+				std::vector<T_SNDBinaryData::Prepared> PreparedSound(PayloadList.size());
+				std::vector<unsigned char> Failed(PayloadList.size(), 0);
+				Parallel::For(PayloadList.size(), [&](size_t index) {
+					const T_PayloadList& Payload = PayloadList[index];
+					const unsigned char* const Compressed = &CompressedBinary[static_cast<size_t>(Payload.Offset - IndexEnd())];
+					RawBinary[index].resize(Payload.RawSize);
+					if (Payload.CompressedSize == Payload.RawSize) {
+						std::memcpy(RawBinary[index].data(), Compressed, Payload.RawSize);
+					}
+					else if (!LZ4Block::Decompress(Compressed, Payload.CompressedSize, RawBinary[index].data(), Payload.RawSize)) {
+						Failed[index] = 1;
+						return;
+					}
+					SoundHash[index] = ContentHash::FNV1a64(RawBinary[index].data(), RawBinary[index].size());
+					PreparedSound[index] = T_SNDBinaryData::PrepareSound(RawBinary[index]);
+				});
+				if (std::find(Failed.begin(), Failed.end(), 1) != Failed.end()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Corrupted_SNDFile);
+					return true;
+				}
+
+				if (T_LoadState::IsCancelled(State)) { return true; }
+
+				const auto Lock = T_LoadState::Lock(State);
+				SNDBinaryData.reserve(static_cast<ksize_t>(EntryList.size()), static_cast<ksize_t>(RawSize));
+				for (size_t index = 0; index < RawBinary.size(); ++index) {
+					SNDBinaryData.AddSound(RawBinary[index], SoundHash[index], std::move(PreparedSound[index]));
+					std::vector<unsigned char>().swap(RawBinary[index]);
+				}
+
+				for (const auto& Entry : EntryList) {
+					// 取得したサウンド番号が重複
+					if (SoundNumberUMap.exist(Entry.GroupNo, Entry.ItemNo)) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Warning_DuplicateSoundNumber, Entry.GroupNo, Entry.ItemNo);
+						continue;
+					}
+					SoundNumberUMap.Register(Entry.GroupNo, Entry.ItemNo);
+					if (!SoundGroupNoUMap.exist(Entry.GroupNo)) {
+						SoundGroupNoUMap.Register(Entry.GroupNo);
+					}
+					SNDBinaryData.AddDataList(Entry.PayloadIndex, Entry.GroupNo, Entry.ItemNo);
+				}
+				T_LoadState::Progress(State, static_cast<ksize_t>(EntryList.size()));
+				return false;
+			}
+		};
+
+		// 先読みしたグループの管理(固定サイズが上限を超えたら最も古く使用したグループから解除する)
+		struct T_PrefetchList {
+		public:
+			inline static constexpr size_t kDefaultBudget = size_t{ 64 } << 20;
+
+		private:
+			struct T_LockRange {
+				ksize_t SoundListIndex = 0;
+				const unsigned char* Data = nullptr;
+				size_t Size = 0;
+			};
+
+			struct T_PrefetchGroup {
+				std::list<int32_t>::iterator LRUPosition;
+				std::vector<T_LockRange> LockList;	// 固定中のSoundList(重複なし)
+				size_t Size = 0;
+				uint64_t LastUse = 0;				// 全SND共通の使用順
+			};
+
+			std::list<int32_t> LRUList_ = {};	// 先頭が最も新しく使用したグループ
+			std::unordered_map<int32_t, T_PrefetchGroup> GroupList_ = {};
+			size_t Budget_ = kDefaultBudget;
+			size_t Size_ = 0;
+
+			static void Unlock(const T_PrefetchGroup& Group) {
+				for (const auto& Range : Group.LockList) {
+					T_PageLock::Instance().Unlock(Range.Data, Range.Size);
+				}
+			}
+
+			void EraseGroup(int32_t GroupNo) {
+				auto it = GroupList_.find(GroupNo);
+				if (it == GroupList_.end()) { return; }
+				Unlock(it->second);
+				Size_ -= it->second.Size;
+				LRUList_.erase(it->second.LRUPosition);
+				GroupList_.erase(it);
+			}
+
+			// 直前に使用したグループは残して上限まで解除する
+			void Trim() {
+				while (Size_ > Budget_ && LRUList_.size() > 1) {
+					EraseGroup(LRUList_.back());
+				}
+			}
+
+		public:
+			T_PrefetchList() = default;
+			~T_PrefetchList() { clear(); }
+
+			// 複製先のサウンドデータは別のメモリなので固定状態は引き継がない
+			T_PrefetchList(const T_PrefetchList& Other) noexcept : Budget_(Other.Budget_) {}
+			T_PrefetchList& operator=(const T_PrefetchList& Other) {
+				if (this != &Other) {
+					clear();
+					Budget_ = Other.Budget_;
+				}
+				return *this;
+			}
+
+			bool Prefetch(int32_t GroupNo, const std::vector<ksize_t>& SoundListIndex, const T_SNDBinaryData& SNDBinaryData, uint64_t Use = 0) {
+				auto it = GroupList_.find(GroupNo);
+				if (it == GroupList_.end()) {
+					LRUList_.push_front(GroupNo);
+					it = GroupList_.emplace(GroupNo, T_PrefetchGroup{ LRUList_.begin(), {}, 0, 0 }).first;
+				}
+				else {
+					LRUList_.splice(LRUList_.begin(), LRUList_, it->second.LRUPosition);
+				}
+
+				bool Result = true;
+				T_PrefetchGroup& Group = it->second;
+				Group.LastUse = Use;
+				for (const ksize_t index : SoundListIndex) {
+					const auto Locked = std::find_if(Group.LockList.begin(), Group.LockList.end(), [index](const T_LockRange& Range) { return Range.SoundListIndex == index; });
+					if (Locked != Group.LockList.end()) { continue; }
+					const T_LockRange Range = { index, SNDBinaryData.Sound(index), SNDBinaryData.SoundSize(index) };
+					Result &= T_PageLock::Instance().Lock(Range.Data, Range.Size);
+					Group.LockList.push_back(Range);
+					Group.Size += Range.Size;
+					Size_ += Range.Size;
+				}
+				Trim();
+				return Result;
+			}
+
+			void Evict(int32_t GroupNo) { EraseGroup(GroupNo); }
+
+			// 最も古く使用したグループの使用順(グループが無い場合は nullopt)
+			[[nodiscard]] std::optional<uint64_t> OldestUse() const {
+				if (LRUList_.empty()) { return std::nullopt; }
+				return GroupList_.at(LRUList_.back()).LastUse;
+			}
+			void EvictOldest() {
+				if (!LRUList_.empty()) { EraseGroup(LRUList_.back()); }
+			}
+			[[nodiscard]] bool IsPrefetched(int32_t GroupNo, ksize_t SoundListIndex) const {
+				auto it = GroupList_.find(GroupNo);
+				if (it == GroupList_.end()) { return false; }
+				return std::any_of(it->second.LockList.begin(), it->second.LockList.end(), [SoundListIndex](const T_LockRange& Range) { return Range.SoundListIndex == SoundListIndex; });
+			}
+
+			void Budget(size_t Size) {
+				Budget_ = Size;
+				Trim();
+			}
+
+			[[nodiscard]] size_t Budget() const noexcept { return Budget_; }
+			[[nodiscard]] size_t size() const noexcept { return Size_; }
+
+			void clear() {
+				for (const auto& Group : GroupList_) { Unlock(Group.second); }
+				GroupList_.clear();
+				LRUList_.clear();
+				Size_ = 0;
+			}
+		};
+
+		// 全SNDのサウンドデータ使用量と固定サイズの管理
+		// (固定サイズが上限を超えたら全SNDの中で最も古く先読みしたグループから固定を解除する)
+		struct T_Residency {
+		private:
+			T_Residency() = default;
+			~T_Residency() = default;
+			T_Residency(const T_Residency&) = delete;
+			T_Residency& operator=(const T_Residency&) = delete;
+
+		private:
+			struct T_Record {
+				T_PrefetchList PrefetchList = {};
+				size_t OwnedSize = 0;	// 共有サウンドを除いたサウンドデータのサイズ
+			};
+
+			std::unordered_map<uint64_t, T_Record> RecordList_ = {};
+			uint64_t NextID_ = 1;
+			uint64_t UseCounter_ = 0;
+			size_t Budget_ = 0;			// 0 = 無制限
+			size_t PeakSize_ = 0;
+			size_t PeakLockSize_ = 0;
+			mutable std::mutex Mutex_ = {};
+
+			[[nodiscard]] size_t CurrentSize() const {
+				size_t Size = T_SoundPool::Instance().size();
+				for (const auto& Record : RecordList_) { Size += Record.second.OwnedSize; }
+				return Size;
+			}
+
+			void UpdatePeak() {
+				PeakSize_ = std::max(PeakSize_, CurrentSize());
+				PeakLockSize_ = std::max(PeakLockSize_, T_PageLock::Instance().size());
+			}
+
+			// 直前に使用したグループは残して上限まで解除する
+			void Trim() {
+				while (Budget_ && T_PageLock::Instance().size() > Budget_) {
+					T_PrefetchList* Oldest = nullptr;
+					uint64_t OldestUse = UseCounter_;
+					for (auto& Record : RecordList_) {
+						const auto Use = Record.second.PrefetchList.OldestUse();
+						if (Use && *Use < OldestUse) {
+							OldestUse = *Use;
+							Oldest = &Record.second.PrefetchList;
+						}
+					}
+					if (!Oldest) { break; }
+					Oldest->EvictOldest();
+				}
+			}
+
+		public:
+			[[nodiscard]] static T_Residency& Instance() {
+				static T_Residency instance;
+				return instance;
+			}
+
+		public:
+			[[nodiscard]] uint64_t Register(size_t PrefetchBudget = T_PrefetchList::kDefaultBudget) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				const uint64_t ID = NextID_++;
+				RecordList_[ID].PrefetchList.Budget(PrefetchBudget);
+				return ID;
+			}
+
+			void Unregister(uint64_t ID) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				RecordList_.erase(ID);
+			}
+
+			void Update(uint64_t ID, size_t OwnedSize) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				RecordList_[ID].OwnedSize = OwnedSize;
+				UpdatePeak();
+			}
+
+			void clear(uint64_t ID) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				T_Record& Record = RecordList_[ID];
+				Record.PrefetchList.clear();
+				Record.OwnedSize = 0;
+			}
+
+			bool Prefetch(uint64_t ID, int32_t GroupNo, const std::vector<ksize_t>& SoundListIndex, const T_SNDBinaryData& SNDBinaryData) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				const bool Result = RecordList_[ID].PrefetchList.Prefetch(GroupNo, SoundListIndex, SNDBinaryData, ++UseCounter_);
+				Trim();
+				UpdatePeak();
+				return Result;
+			}
+
+			void Evict(uint64_t ID, int32_t GroupNo) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				RecordList_[ID].PrefetchList.Evict(GroupNo);
+			}
+
+			void PrefetchBudget(uint64_t ID, size_t Size) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				RecordList_[ID].PrefetchList.Budget(Size);
+			}
+
+			[[nodiscard]] size_t PrefetchBudget(uint64_t ID) const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				auto it = RecordList_.find(ID);
+				return (it != RecordList_.end() ? it->second.PrefetchList.Budget() : T_PrefetchList::kDefaultBudget);
+			}
+
+			[[nodiscard]] size_t PrefetchSize(uint64_t ID) const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				auto it = RecordList_.find(ID);
+				return (it != RecordList_.end() ? it->second.PrefetchList.size() : 0);
+			}
+
+			[[nodiscard]] bool IsPrefetched(uint64_t ID, int32_t GroupNo, ksize_t SoundListIndex) const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				auto it = RecordList_.find(ID);
+				return it != RecordList_.end() && it->second.PrefetchList.IsPrefetched(GroupNo, SoundListIndex);
+			}
+
+			void Budget(size_t Size) {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				Budget_ = Size;
+				Trim();
+			}
+
+			[[nodiscard]] size_t Budget() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				return Budget_;
+			}
+
+			[[nodiscard]] size_t size() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				return CurrentSize();
+			}
+
+			[[nodiscard]] size_t peak() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				UpdatePeak();
+				return PeakSize_;
+			}
+
+			[[nodiscard]] size_t LockSize() const {
+				return T_PageLock::Instance().size();
+			}
+
+			[[nodiscard]] size_t LockPeak() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				UpdatePeak();
+				return PeakLockSize_;
+			}
+
+			[[nodiscard]] size_t NumSND() const {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				return RecordList_.size();
+			}
+
+			void ResetPeak() {
+				std::lock_guard<std::mutex> Lock(Mutex_);
+				PeakSize_ = CurrentSize();
+				PeakLockSize_ = T_PageLock::Instance().size();
+			}
+		};
+
+		// SNDごとの管理番号(複製時は新しい番号を取得し、破棄時に固定を解除する)
+		// (移動時は番号を引き継ぎ、移動元は次に使用する時に新しい番号を取得する)
+		struct T_ResidencyHandle {
+		private:
+			mutable std::atomic<uint64_t> ID_ = 0; // 0 = 未取得
+
+		public:
+			[[nodiscard]] uint64_t ID() const {
+				uint64_t ID = ID_.load(std::memory_order_acquire);
+				if (ID) { return ID; }
+				const uint64_t NewID = T_Residency::Instance().Register();
+				if (ID_.compare_exchange_strong(ID, NewID, std::memory_order_acq_rel)) { return NewID; }
+				T_Residency::Instance().Unregister(NewID);
+				return ID;
+			}
+
+			T_ResidencyHandle() : ID_(T_Residency::Instance().Register()) {}
+			explicit T_ResidencyHandle(std::nullptr_t) noexcept {}
+			T_ResidencyHandle(const T_ResidencyHandle& Other) : ID_(T_Residency::Instance().Register(T_Residency::Instance().PrefetchBudget(Other.ID()))) {}
+			T_ResidencyHandle(T_ResidencyHandle&& Other) noexcept : ID_(Other.ID_.exchange(0, std::memory_order_acq_rel)) {}
+			T_ResidencyHandle& operator=(const T_ResidencyHandle& Other) {
+				if (this != &Other) {
+					T_Residency::Instance().clear(ID());
+					T_Residency::Instance().PrefetchBudget(ID(), T_Residency::Instance().PrefetchBudget(Other.ID()));
+				}
+				return *this;
+			}
+			T_ResidencyHandle& operator=(T_ResidencyHandle&& Other) noexcept {
+				if (this != &Other) {
+					const uint64_t OldID = ID_.exchange(Other.ID_.exchange(0, std::memory_order_acq_rel), std::memory_order_acq_rel);
+					if (OldID) { T_Residency::Instance().Unregister(OldID); }
+				}
+				return *this;
+			}
+			~T_ResidencyHandle() {
+				if (const uint64_t ID = ID_.load(std::memory_order_acquire)) { T_Residency::Instance().Unregister(ID); }
+			}
+
+			void swap(T_ResidencyHandle& Other) noexcept {
+				ID_.store(Other.ID_.exchange(ID_.load(std::memory_order_acquire), std::memory_order_acq_rel), std::memory_order_release);
+			}
+		};
+
+		// コメントの部分一致/前方一致検索用の索引(ASCIIの大文字小文字は区別しない)
+		struct T_CommentIndex {
+		private:
+			std::string Text_ = {};				// 変換後のコメントを '\0' 区切りで連結
+			std::vector<ksize_t> Offset_ = {};	// 各コメントの開始位置(末尾に Text_ のサイズ)
+			std::vector<ksize_t> Suffix_ = {};	// 接尾辞配列(UTF-8の文字先頭のみ)
+			std::vector<ksize_t> Sorted_ = {};	// コメント順に並べたID
+
+			[[nodiscard]] static char Fold(char c) noexcept {
+				return ('A' <= c && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c);
+			}
+
+			[[nodiscard]] static std::string Fold(std::string_view Text) {
+				std::string Folded(Text);
+				for (char& c : Folded) { c = Fold(c); }
+				return Folded;
+			}
+
+			// 指定位置から次の区切りまでの文字列
+			[[nodiscard]] std::string_view At(ksize_t Position) const noexcept {
+				return std::string_view(Text_.c_str() + Position);
+			}
+
+			[[nodiscard]] ksize_t ID(ksize_t Position) const noexcept {
+				return static_cast<ksize_t>(std::upper_bound(Offset_.begin(), Offset_.end(), Position) - Offset_.begin() - 1);
+			}
+
+			[[nodiscard]] static std::vector<ksize_t> Unique(std::vector<ksize_t> Result) {
+				std::sort(Result.begin(), Result.end());
+				Result.erase(std::unique(Result.begin(), Result.end()), Result.end());
+				return Result;
+			}
+
+		public:
+			T_CommentIndex() = default;
+
+			// UTF8List の順番をIDとする
+			explicit T_CommentIndex(const std::vector<std::string>& UTF8List) {
+				size_t TextSize = 0;
+				for (const auto& Comment : UTF8List) { TextSize += Comment.size() + 1; }
+				Text_.reserve(TextSize);
+				Offset_.reserve(UTF8List.size() + 1);
+				for (const auto& Comment : UTF8List) {
+					Offset_.push_back(static_cast<ksize_t>(Text_.size()));
+					// 区切り文字と衝突しないように終端文字以降は使用しない
+					Text_ += Fold(std::string_view(Comment.c_str()));
+					Text_ += '\0';
+				}
+				Offset_.push_back(static_cast<ksize_t>(Text_.size()));
+
+				for (ksize_t Position = 0; Position < Text_.size(); ++Position) {
+					const unsigned char c = static_cast<unsigned char>(Text_[Position]);
+					if (c && (c & 0xc0) != 0x80) { Suffix_.push_back(Position); }
+				}
+				std::sort(Suffix_.begin(), Suffix_.end(), [this](ksize_t Left, ksize_t Right) { return At(Left) < At(Right); });
+
+				Sorted_.resize(UTF8List.size());
+				for (ksize_t index = 0; index < Sorted_.size(); ++index) { Sorted_[index] = index; }
+				std::stable_sort(Sorted_.begin(), Sorted_.end(), [this](ksize_t Left, ksize_t Right) { return At(Offset_[Left]) < At(Offset_[Right]); });
+			}
+
+			// 部分一致するIDを昇順で取得
+			[[nodiscard]] std::vector<ksize_t> Find(std::string_view UTF8Text) const {
+				const std::string Pattern = Fold(UTF8Text.substr(0, UTF8Text.find('\0')));
+				if (Pattern.empty()) { return Unique(Sorted_); }
+				auto Range = std::equal_range(Suffix_.begin(), Suffix_.end(), Pattern, [this, &Pattern](const auto& Left, const auto& Right) {
+					if constexpr (std::is_same_v<std::decay_t<decltype(Left)>, std::string>) { return Left < At(Right).substr(0, Pattern.size()); }
+					else { return At(Left).substr(0, Pattern.size()) < Right; }
+				});
+				std::vector<ksize_t> Result;
+				Result.reserve(static_cast<size_t>(Range.second - Range.first));
+				for (auto it = Range.first; it != Range.second; ++it) { Result.push_back(ID(*it)); }
+				return Unique(std::move(Result));
+			}
+
+			// 前方一致するIDを昇順で取得
+			[[nodiscard]] std::vector<ksize_t> FindPrefix(std::string_view UTF8Text) const {
+				const std::string Pattern = Fold(UTF8Text.substr(0, UTF8Text.find('\0')));
+				auto Range = std::equal_range(Sorted_.begin(), Sorted_.end(), Pattern, [this, &Pattern](const auto& Left, const auto& Right) {
+					if constexpr (std::is_same_v<std::decay_t<decltype(Left)>, std::string>) { return Left < At(Offset_[Right]).substr(0, Pattern.size()); }
+					else { return At(Offset_[Left]).substr(0, Pattern.size()) < Right; }
+				});
+				return Unique(std::vector<ksize_t>(Range.first, Range.second));
+			}
+
+			[[nodiscard]] size_t size() const noexcept { return Sorted_.size(); }
+		};
+
+		// 2つのSNDの差分(サウンド番号順)
+		struct T_SNDDiff {
+		public:
+			using SoundNumber = std::pair<int32_t, int32_t>; // GroupNo, ItemNo
+
+		private:
+			std::vector<SoundNumber> Added_ = {};
+			std::vector<SoundNumber> Removed_ = {};
+			std::vector<SoundNumber> Changed_ = {};
+
+		public:
+			[[nodiscard]] const std::vector<SoundNumber>& Added() const noexcept { return Added_; }
+			[[nodiscard]] const std::vector<SoundNumber>& Removed() const noexcept { return Removed_; }
+			[[nodiscard]] const std::vector<SoundNumber>& Changed() const noexcept { return Changed_; }
+			[[nodiscard]] bool empty() const noexcept { return Added_.empty() && Removed_.empty() && Changed_.empty(); }
+
+			T_SNDDiff(std::vector<SoundNumber> Added, std::vector<SoundNumber> Removed, std::vector<SoundNumber> Changed)
+				: Added_(std::move(Added)), Removed_(std::move(Removed)), Changed_(std::move(Changed)) {
+				std::sort(Added_.begin(), Added_.end());
+				std::sort(Removed_.begin(), Removed_.end());
+				std::sort(Changed_.begin(), Changed_.end());
+			}
+		};
+
+		struct T_SNDData {
+			int32_t NumGroup_ = 0;
+			int32_t NumItem_ = 0;
+			std::string FileName_ = {};
+			uint64_t ContentHash_ = 0; // サウンド番号と内容から求めたファイル全体のハッシュ
+			T_UnorderedMap<int64_t> SoundNumberUMap = {};
+			T_UnorderedMap<int32_t> SoundGroupNoUMap = {};
+			std::shared_ptr<T_SNDBinaryData> SNDBinaryData = T_SNDBinaryData::Empty(); // 複製したSND間で共有し、読み込み時は新しく作成する(共有中のデータは変更しない)
+			std::vector<T_AnalysisData> AnalysisList_ = {}; // SoundListごとの解析結果
+			std::vector<T_Waveform> WaveformList_ = {}; // SoundListごとの波形概要
+			std::shared_ptr<const T_CommentIndex> CommentIndex_ = nullptr; // DataListの順番をIDとするコメント索引
+			T_SearchPath SearchPath_ = {}; // 読み込み時の検索先(空の場合はSNDConfigの検索パス)
+			T_RecoveryReport RecoveryReport_ = {}; // 読み込み時にサブヘッダーを辿った結果
+			T_ResidencyHandle Residency_ = {}; // サウンドデータより先に解放する
+
+			// 同一内容のサウンドは1回だけ変換する
+			void BuildCommentIndex() {
+				std::vector<std::string> SoundComment(SNDBinaryData->NumSound());
+				Parallel::For(SoundComment.size(), [this, &SoundComment](size_t index) {
+					SoundComment[index] = SNDBinaryData->SoundList(static_cast<ksize_t>(index)).CommentUTF8();
+				});
+				std::vector<std::string> CommentList;
+				CommentList.reserve(SNDBinaryData->DataList().size());
+				for (const auto& Data : SNDBinaryData->DataList()) {
+					CommentList.push_back(SoundComment[Data.SoundListIndex()]);
+				}
+				CommentIndex_ = std::make_shared<const T_CommentIndex>(CommentList);
+			}
+
+			// 波形概要のキャッシュファイル(エラーログと同じフォルダ、SAELibフォルダを作成できない場合は空)
+			inline static constexpr std::string_view kWaveformSignature = "SAELibSndWaveform";
+			inline static constexpr uint32_t kWaveformVersion = 1;
+
+			std::filesystem::path WaveformCachePath() const {
+				T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSndFileFormat::kSystemDirectoryName : ""));
+				if (SAELibFile.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SAELibFolderPath);
+					return {};
+				}
+				if (T_Config::Instance().CreateSAELibFile()) {
+					SAELibFile.CreateDirectory(SAELibFile.Path());
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateSAELibFolder);
+						return {};
+					}
+				}
+				return SAELibFile.Path() / (std::string(ReadSndFileFormat::kWaveformFileName) + "_" + FileName() + ".bin");
+			}
+
+			// 内容ハッシュ、フレーム数、チャンネル数が一致するサウンドへキャッシュを割り当てる(形式が正しくない場合は使用しない)
+			void ReadWaveformCache(const std::filesystem::path& Path, std::vector<T_Waveform>& WaveformList) const {
+				std::ifstream File(Path, std::ios::binary);
+				if (!File.is_open()) { return; }
+				const std::vector<unsigned char> buffer((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+				if (buffer.size() < kWaveformSignature.size() + 12 || std::memcmp(buffer.data(), kWaveformSignature.data(), kWaveformSignature.size())) { return; }
+				size_t Offset = kWaveformSignature.size();
+				if (DecodeEndian::UInt32LE(&buffer[Offset]) != kWaveformVersion || DecodeEndian::UInt32LE(&buffer[Offset + 4]) != T_Waveform::kBaseBlockFrame) { return; }
+				const uint32_t NumEntry = DecodeEndian::UInt32LE(&buffer[Offset + 8]);
+				Offset += 12;
+
+				std::unordered_multimap<uint64_t, ksize_t> SoundHashMap;
+				for (ksize_t index = 0; index < SNDBinaryData->NumSound(); ++index) { SoundHashMap.emplace(SNDBinaryData->SoundHash(index), index); }
+				for (uint32_t Entry = 0; Entry < NumEntry; ++Entry) {
+					uint64_t SoundHash = 0;
+					T_Waveform Waveform;
+					if (!T_Waveform::Read(buffer, Offset, SoundHash, Waveform)) { return; }
+					const auto Range = SoundHashMap.equal_range(SoundHash);
+					for (auto it = Range.first; it != Range.second; ++it) {
+						const auto& SampleFormat = SNDBinaryData->SoundList(it->second).SampleFormat();
+						if (SampleFormat.NumFrame() == Waveform.NumFrame() && SampleFormat.Channels() == Waveform.Channel()) { WaveformList[it->second] = Waveform; }
+					}
+				}
+			}
+
+			void WriteWaveformCache(const std::filesystem::path& Path, const std::vector<T_Waveform>& WaveformList) const {
+				// 0～16 識別子("SAELibSndWaveform")
+				// 17～  バージョン、最下層の1ブロックのフレーム数、件数
+				// 以降  波形概要(内容ハッシュ、フレーム数、チャンネル数、ヘルツ、Peak数、Peak(最小値、最大値、RMS))
+				std::vector<unsigned char> buffer(kWaveformSignature.size() + 12);
+				std::memcpy(buffer.data(), kWaveformSignature.data(), kWaveformSignature.size());
+				uint32_t NumEntry = 0;
+				for (ksize_t index = 0; index < WaveformList.size(); ++index) {
+					if (!WaveformList[index].IsValid()) { continue; }
+					WaveformList[index].Write(buffer, SNDBinaryData->SoundHash(index));
+					++NumEntry;
+				}
+				EncodeEndian::UInt32LE(&buffer[kWaveformSignature.size()], kWaveformVersion);
+				EncodeEndian::UInt32LE(&buffer[kWaveformSignature.size() + 4], T_Waveform::kBaseBlockFrame);
+				EncodeEndian::UInt32LE(&buffer[kWaveformSignature.size() + 8], NumEntry);
+
+				std::ofstream File(Path, std::ios::binary);
+				File.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_WriteWaveformCache);
+				}
+			}
+
+			const T_CommentIndex& CommentIndex() {
+				if (!CommentIndex_) { BuildCommentIndex(); }
+				return *CommentIndex_;
+			}
+
+			// 並び順に依存しないように、サウンド番号順に番号、サイズ、ハッシュを連結して求める
+			[[nodiscard]] uint64_t CalcContentHash() const {
+				struct T_HashEntry {
+					int64_t SoundNumber;
+					uint64_t SoundHash;
+					uint64_t SoundSize;
+				};
+				std::vector<T_HashEntry> EntryList;
+				EntryList.reserve(SNDBinaryData->DataList().size());
+				for (const auto& Data : SNDBinaryData->DataList()) {
+					EntryList.push_back({ Convert::EncodeSoundNumber(Data.GroupNo(), Data.ItemNo()), SNDBinaryData->SoundHash(Data.SoundListIndex()), SNDBinaryData->SoundSize(Data.SoundListIndex()) });
+				}
+				std::sort(EntryList.begin(), EntryList.end(), [](const T_HashEntry& Left, const T_HashEntry& Right) { return Left.SoundNumber < Right.SoundNumber; });
+
+				uint64_t Hash = ContentHash::kFNVOffsetBasis;
+				for (const auto& Entry : EntryList) {
+					unsigned char buffer[24] = {};
+					for (int32_t Byte = 0; Byte < 8; ++Byte) {
+						buffer[Byte] = static_cast<unsigned char>(static_cast<uint64_t>(Entry.SoundNumber) >> (Byte * 8));
+						buffer[8 + Byte] = static_cast<unsigned char>(Entry.SoundHash >> (Byte * 8));
+						buffer[16 + Byte] = static_cast<unsigned char>(Entry.SoundSize >> (Byte * 8));
+					}
+					Hash = ContentHash::FNV1a64(buffer, sizeof(buffer), Hash);
+				}
+				return Hash;
+			}
+
+			// 指定番号に該当するSoundList(ItemNo が nullopt の場合はグループ全体)
+			[[nodiscard]] std::vector<ksize_t> FindSoundListIndex(int32_t GroupNo, std::optional<int32_t> ItemNo) const {
+				std::vector<ksize_t> SoundListIndex;
+				for (const auto& Data : SNDBinaryData->DataList()) {
+					if (Data.GroupNo() != GroupNo || (ItemNo && Data.ItemNo() != *ItemNo)) { continue; }
+					if (std::find(SoundListIndex.begin(), SoundListIndex.end(), Data.SoundListIndex()) == SoundListIndex.end()) {
+						SoundListIndex.push_back(Data.SoundListIndex());
+					}
+				}
+				return SoundListIndex;
+			}
+
+			void NumGroup(int32_t value) noexcept { NumGroup_ = value; }
+			void NumItem(int32_t value) noexcept { NumItem_ = value; }
+			void FileName(const std::string& value) noexcept { FileName_ = value; }
+
+			void ReserveData(T_LoadSNDHeader& LoadSNDHeader) {
+				const ksize_t kNumSound = LoadSNDHeader.NumSound();
+				const ksize_t kFileSize = LoadSNDHeader.FileSize();
+
+				SoundNumberUMap.reserve(kNumSound);
+				SoundGroupNoUMap.reserve(kNumSound);
+				SNDBinaryData->reserve(kNumSound, kFileSize);
+			}
+
+			void shrink_to_fit() {
+				SoundNumberUMap.shrink_to_fit();
+				SoundGroupNoUMap.shrink_to_fit();
+				SNDBinaryData->shrink_to_fit();
+			}
+
+			bool LoadSNDFile(const std::string& FileName_, const std::string& FilePath_, const T_SearchPath& SearchPath, T_LoadState* State = nullptr) {
+				if (!empty()) {
+					const auto Lock = T_LoadState::Lock(State);
+					clear();
+				}
+				T_LoadSNDHeader LoadSNDHeader(FileName_, FilePath_, SearchPath);
+				if (LoadSNDHeader.CheckError()) { return false; }
+
+				{
+					const auto Lock = T_LoadState::Lock(State);
+					NumItem(LoadSNDHeader.NumSound());
+					FileName(LoadSNDHeader.FileName());
+					SNDBinaryData = std::make_shared<T_SNDBinaryData>(); // 複製元と共有しているデータは変更しない
+					ReserveData(LoadSNDHeader);
+				}
+				if (State) { State->NumSound.store(LoadSNDHeader.NumSound(), std::memory_order_release); }
+
+				T_RecoveryReport RecoveryReport;
+				if (LoadSNDHeader.IsCompressed()) {
+					T_LoadSNDCompressed LoadSNDCompressed(LoadSNDHeader);
+					if (LoadSNDCompressed.ReadSoundBinary(SoundNumberUMap, SoundGroupNoUMap, *SNDBinaryData, State)) {
+						const auto Lock = T_LoadState::Lock(State);
+						clear();
+						return false;
+					}
+					RecoveryReport.NumSound = RecoveryReport.NumEntry = LoadSNDHeader.NumSound();
+				}
+				else {
+					T_LoadSNDSubHeader LoadSNDSubHeader(LoadSNDHeader);
+					if (LoadSNDSubHeader.CheckError()) { return false; }
+					LoadSNDSubHeader.ReadSoundBinary(SoundNumberUMap, SoundGroupNoUMap, *SNDBinaryData, RecoveryReport, State);
+				}
+
+				const auto Lock = T_LoadState::Lock(State);
+				if (T_LoadState::IsCancelled(State)) {
+					clear();
+					return false;
+				}
+				NumGroup(static_cast<int32_t>(SoundGroupNoUMap.size()));
+				RecoveryReport_ = std::move(RecoveryReport);
+				ContentHash_ = CalcContentHash();
+				if (T_Config::Instance().CommentUTF8()) { BuildCommentIndex(); }
+				T_LoadState::Progress(State, LoadSNDHeader.NumSound());
+
+				// 全てのロードが終了したら余分に確保したメモリを解放
+				// (非同期読み込み中に取得されたSoundDataが参照している配列は移動しない)
+				if (State) {
+					SoundNumberUMap.shrink_to_fit();
+					SoundGroupNoUMap.shrink_to_fit();
+				}
+				else {
+					shrink_to_fit();
+				}
+				T_Residency::Instance().Update(Residency_.ID(), SNDBinaryData->OwnedSize());
+				if (T_Config::Instance().RecoverSND() && RecoveryReport_.IsCorrupted()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Warning_RecoveredSNDFile, static_cast<int32_t>(RecoveryReport_.LostRangeList.size()));
+				}
+
+				// ログ出力
+				if (T_Config::Instance().CreateLogFile()) {
+					T_FilePathSystem SAELibFile(T_Config::Instance().SAELibFilePath() / (T_Config::Instance().CreateSAELibFile() ? ReadSndFileFormat::kSystemDirectoryName : ""));
+					if (SAELibFile.ErrorCode()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SAELibFolderPath);
+						return false;
+					}
+					if (T_Config::Instance().CreateSAELibFile()) {
+						SAELibFile.CreateDirectory(SAELibFile.Path());
+						if (SAELibFile.ErrorCode()) {
+							T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateSAELibFolder);
+							return false;
+						}
+					}
+
+					const std::string ErrorLogFileName = std::string(ReadSndFileFormat::kErrorLogFileName) + "_" + FileName() + ".txt";
+					std::ofstream ErrorLogFile(SAELibFile.Path() / ErrorLogFileName);
+					if (!ErrorLogFile.is_open()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateErrorLogFile);
+					}
+					T_ErrorHandle::Instance().WriteErrorLog(ErrorLogFile);
+				}
+
+				return true;
+			}
+
+			// ユーザー向けのT_DataListアクセス手段
+			struct T_AccessData {
+			private:
+				const T_SNDBinaryData* const kSNDBinaryDataPtr;
+				const ksize_t kDataListIndex; // 配列Index(最大値のときダミーデータフラグとして使用)
+
+				const auto& DataListRef() const noexcept { return kSNDBinaryDataPtr->DataList(kDataListIndex); }
+				const auto& SoundListRef() const noexcept { return kSNDBinaryDataPtr->SoundList(DataListRef().SoundListIndex()); }
+				const auto& WAVEBinaryRef() const noexcept { return SoundListRef().WAVEBinary(); }
+				const auto& SampleFormatRef() const noexcept { return SoundListRef().SampleFormat(); }
+
+				// SAEで表示されるフレーム秒数の算出用定数
+				inline static constexpr double kFramesPerSecond = 60.0;
+
+				[[nodiscard]] static uint32_t TicksPerSecondOrDefault(uint32_t TicksPerSecond) noexcept {
+					return (TicksPerSecond ? TicksPerSecond : T_Config::Instance().TicksPerSecond());
+				}
+
+				[[nodiscard]] uint32_t ClampFrame(uint32_t StartFrame, uint32_t NumFrame) const noexcept {
+					if (IsDummy() || !SampleFormatRef().IsSupported() || StartFrame >= SampleFormatRef().NumFrame()) { return 0; }
+					return std::min(NumFrame, SampleFormatRef().NumFrame() - StartFrame);
+				}
+
+				[[nodiscard]] const unsigned char* FramePtr(uint32_t StartFrame) const noexcept {
+					return SoundListRef().SampleData() + size_t{ StartFrame } * SampleFormatRef().BytesPerFrame();
+				}
+
+			public:
+				/**
+				* @brief ダミーデータ判断
+				*
+				* 　自身がダミーデータであるかを確認します
+				*
+				* 　SNDConfig::SetThrowErrorの設定がOFFの場合にエラー回避のために使用されます
+				*
+				* @return bool (false = 自身が正常なデータ：true = 自身がダミーデータ)
+				*/
+				bool IsDummy() const noexcept { return kDataListIndex == KSIZE_MAX; }
+
+				/**
+				* @brief グループ番号の取得
+				*
+				* 　対象音声のグループ番号を返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t GroupNo グループ番号
+				*/
+				int32_t GroupNo() const noexcept { return (IsDummy() ? 0 : DataListRef().GroupNo()); }
+
+				/**
+				* @brief アイテム番号の取得
+				*
+				* 　対象音声のアイテム番号を返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t ImageNo アイテム番号
+				*/
+				int32_t ItemNo() const noexcept { return (IsDummy() ? 0 : DataListRef().ItemNo()); }
+
+				/**
+				* @brief バイトサイズの取得
+				*
+				* 　対象音声のバイトサイズを返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t ByteSize バイトサイズ
+				*/
+				int32_t ByteSize() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(WAVEBinaryRef().dataChunk().ChunkSize())); }
+
+				/**
+				* @brief チャンネルの取得
+				*
+				* 　対象音声のチャンネル数を返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t Channel チャンネル
+				*/
+				int32_t Channel() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(SampleFormatRef().Channels())); }
+
+				/**
+				* @brief ヘルツの取得
+				*
+				* 　対象音声のヘルツを返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t Hz ヘルツ
+				*/
+				int32_t Hz() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(SampleFormatRef().SamplesPerSec())); }
+
+				/**
+				* @brief ビットの取得
+				*
+				* 　対象音声のビットを返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return int32_t Bit ビット
+				*/
+				int32_t Bit() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(SampleFormatRef().BitsPerSample())); }
+
+				/**
+				* @brief サンプル秒数の取得
+				*
+				* 　対象音声のサンプル秒数を返します (SAEの表示と同じく dataチャンクサイズ / AvgBytesPerSec で求めた値です)
+				*
+				* 　正確な長さは Duration 関数を使用してください
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return double SampleRate サンプル秒数
+				*/
+				double SampleRate() const noexcept { return (IsDummy() ? 0 : SampleFormatRef().SAESecond()); }
+				
+				/**
+				* @brief フレーム秒数の取得
+				*
+				* 　対象音声のフレーム秒数を返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return double SampleFrame フレーム秒数
+				*/
+				double SampleFrame() const noexcept { return (IsDummy() ? 0 : SampleRate() * kFramesPerSecond); }
+
+				/**
+				* @brief コメントの取得
+				*
+				* 　SAEで設定された対象音声のコメントを返します
+				*
+				* 　ダミーデータの場合は DummyBinaryData を返します
+				* 
+				* 　DummyBinaryData は常に長さ1の配列で内容は {0} です
+				*
+				* @return const unsigned char* const Comment コメントデータ配列
+				* @retval const unsigned char* const DummyBinaryData ダミーデータ配列
+				*/
+				const unsigned char* Comment() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyBinaryData : WAVEBinaryRef().SAECChunk().Comment()); }
+
+				/**
+				* @brief コメントの参照を取得
+				*
+				* 　SAEで設定された対象音声のコメントをチャンクサイズの範囲で返します(文字コードは Shift_JIS のままです)
+				*
+				* 　コメントが存在しない場合やダミーデータの場合は空の文字列を返します
+				*
+				* @return std::string_view Comment コメント (終端文字は含まない)
+				*/
+				std::string_view CommentView() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyStringView : WAVEBinaryRef().CommentView()); }
+
+				/**
+				* @brief UTF-8に変換したコメントを取得
+				*
+				* 　対象音声のコメントを Shift_JIS から UTF-8 へ変換して返します
+				*
+				* 　SNDConfig::SetCommentUTF8 が有効な状態で読み込んだ場合は読み込み時に変換した結果を返します
+				*
+				* 　変換できない文字は U+FFFD に置き換えます
+				*
+				* @return std::string Comment UTF-8のコメント
+				*/
+				std::string CommentUTF8() const { return (IsDummy() ? std::string() : SoundListRef().CommentUTF8()); }
+
+				/**
+				* @brief ループ区間の取得
+				*
+				* 　smplチャンクに記録された対象音声のループ区間を記録順に返します
+				*
+				* 　読み込み時に読み取った値をそのまま返すため、範囲はサンプルフレーム数を超える場合があります
+				*
+				* 　smplチャンクが無い場合やダミーデータの場合は空の配列を返します
+				*
+				* @return const std::vector<LoopPoint>& LoopList ループ区間の一覧
+				*/
+				const std::vector<T_CueData::T_LoopPoint>& LoopList() const noexcept { return (IsDummy() ? T_CueData::Empty() : SoundListRef().CueData()).LoopList; }
+
+				/**
+				* @brief マーカーの取得
+				*
+				* 　cue チャンクに記録された対象音声のマーカーを記録順に返します
+				*
+				* 　LIST adtl チャンクに同じIDのラベル、注釈、区間の長さがある場合はそれぞれ設定されます
+				*
+				* 　cue チャンクが無い場合やダミーデータの場合は空の配列を返します
+				*
+				* @return const std::vector<CuePoint>& CuePointList マーカーの一覧
+				*/
+				const std::vector<T_CueData::T_CuePoint>& CuePointList() const noexcept { return (IsDummy() ? T_CueData::Empty() : SoundListRef().CueData()).CuePointList; }
+
+				/**
+				* @brief サウンドの解析
+				*
+				* 　対象音声のピーク、RMS、ラウドネス、前後の無音を解析して返します
+				*
+				* 　ダミーデータもしくは解析できないフォーマットの場合は IsValid() が false の解析結果を返します
+				*
+				* @param double SilenceThreshold 無音と判定する振幅 (省略時は -60dBFS)
+				* @return SoundAnalysis 解析結果
+				*/
+				T_AnalysisData Analyze(double SilenceThreshold = T_SoundAnalyzer::kDefaultSilenceThreshold) const { return (IsDummy() ? T_AnalysisData() : T_SoundAnalyzer::Analyze(SoundListRef().SampleData(), SampleFormatRef(), SilenceThreshold)); }
+
+				/**
+				* @brief サンプルフレーム数の取得
+				*
+				* 　対象音声のdataチャンクに含まれるサンプルフレーム数を返します
+				*
+				* 　ダミーデータもしくは変換できないフォーマットの場合は 0 を返します
+				*
+				* @return uint32_t NumFrame サンプルフレーム数
+				*/
+				uint32_t NumFrame() const noexcept { return (IsDummy() ? 0 : SampleFormatRef().NumFrame()); }
+
+				/**
+				* @brief サウンドデータサイズの取得
+				*
+				* 　対象音声のWAVEデータ全体のサイズを返します(共有サウンドの場合も同じサイズを返します)
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return ksize_t PayloadSize サウンドデータサイズ
+				*/
+				ksize_t PayloadSize() const noexcept { return (IsDummy() ? 0 : SoundListRef().SoundSize()); }
+
+				/**
+				* @brief サンプル数の取得
+				*
+				* 　factチャンクがある場合はそのサンプル数、無い場合は dataチャンクのサイズ / BlockAlign を返します
+				*
+				* 　読み込み時に求めた値を返すため、毎回の計算は行いません
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return uint32_t SampleLength サンプル数 (1チャンネルあたり)
+				*/
+				uint32_t SampleLength() const noexcept { return (IsDummy() ? 0 : SampleFormatRef().SampleLength()); }
+
+				/**
+				* @brief 長さ(秒)の取得
+				*
+				* 　サンプル数 / ヘルツで求めた正確な長さを返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return double Duration 長さ(秒)
+				*/
+				double Duration() const noexcept { return (IsDummy() || !SampleFormatRef().SamplesPerSec() ? 0 : double(SampleFormatRef().SampleLength()) / SampleFormatRef().SamplesPerSec()); }
+
+				/**
+				* @brief 長さ(フレーム数)の取得
+				*
+				* 　再生が終わるまでのフレーム数を整数で返します (端数のフレームは切り上げ)
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @param uint32_t TicksPerSecond 1秒あたりのフレーム数 (省略時は SNDConfig::SetTicksPerSecond の設定)
+				* @return uint32_t NumTick フレーム数
+				*/
+				uint32_t NumTick(uint32_t TicksPerSecond = 0) const noexcept {
+					if (IsDummy() || !SampleFormatRef().SamplesPerSec()) { return 0; }
+					const uint64_t Tick = (uint64_t{ SampleFormatRef().SampleLength() } * TicksPerSecondOrDefault(TicksPerSecond) + SampleFormatRef().SamplesPerSec() - 1) / SampleFormatRef().SamplesPerSec();
+					return static_cast<uint32_t>(std::min<uint64_t>(Tick, UINT32_MAX));
+				}
+
+				/**
+				* @brief サンプル位置からフレーム番号への変換
+				*
+				* 　指定したサンプル位置を含むフレーム番号を返します (端数は切り捨て)
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @param uint32_t Sample サンプル位置
+				* @param uint32_t TicksPerSecond 1秒あたりのフレーム数 (省略時は SNDConfig::SetTicksPerSecond の設定)
+				* @return uint32_t Tick フレーム番号
+				*/
+				uint32_t SampleToTick(uint32_t Sample, uint32_t TicksPerSecond = 0) const noexcept {
+					if (IsDummy() || !SampleFormatRef().SamplesPerSec()) { return 0; }
+					return static_cast<uint32_t>(std::min<uint64_t>(uint64_t{ Sample } * TicksPerSecondOrDefault(TicksPerSecond) / SampleFormatRef().SamplesPerSec(), UINT32_MAX));
+				}
+
+				/**
+				* @brief フレーム番号からサンプル位置への変換
+				*
+				* 　指定したフレームの開始時点のサンプル位置を返します (サンプル数を超える場合はサンプル数)
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @param uint32_t Tick フレーム番号
+				* @param uint32_t TicksPerSecond 1秒あたりのフレーム数 (省略時は SNDConfig::SetTicksPerSecond の設定)
+				* @return uint32_t Sample サンプル位置
+				*/
+				uint32_t TickToSample(uint32_t Tick, uint32_t TicksPerSecond = 0) const noexcept {
+					if (IsDummy()) { return 0; }
+					const uint64_t Sample = uint64_t{ Tick } * SampleFormatRef().SamplesPerSec() / TicksPerSecondOrDefault(TicksPerSecond);
+					return static_cast<uint32_t>(std::min<uint64_t>(Sample, SampleFormatRef().SampleLength()));
+				}
+
+				/**
+				* @brief 内容ハッシュの取得
+				*
+				* 　読み込み時に求めた対象音声のWAVEデータ全体のハッシュ(FNV-1a 64bit)を返します
+				*
+				* 　ダミーデータの場合は 0 を返します
+				*
+				* @return uint64_t ContentHash 内容ハッシュ
+				*/
+				uint64_t ContentHash() const noexcept { return (IsDummy() ? 0 : SoundListRef().SoundHash()); }
+
+				/**
+				* @brief CRC-32の取得
+				*
+				* 　SNDConfig::SetPayloadCRC が ON の状態で読み込んだ場合に、読み込み時に求めた対象音声のWAVEデータ全体のCRC-32を返します
+				*
+				* 　CRC-32を求めていない場合やダミーデータの場合は 0 を返します
+				*
+				* @return uint32_t PayloadCRC CRC-32
+				*/
+				uint32_t PayloadCRC() const noexcept { return (IsDummy() ? 0 : SoundListRef().PayloadCRC()); }
+
+				/**
+				* @brief サウンドデータの照合
+				*
+				* 　現在のWAVEデータ全体のCRC-32を求め、読み込み時に求めたCRC-32と一致するかを返します
+				*
+				* 　CRC-32を求めていない場合やダミーデータの場合は false を返します
+				*
+				* @return bool 照合結果 (false = 不一致もしくは照合できない：true = 一致)
+				*/
+				bool VerifyPayload() const noexcept {
+					if (IsDummy() || !SoundListRef().HasPayloadCRC()) { return false; }
+					return ContentHash::CRC32(WAVEBinaryRef().SoundBinary(), SoundListRef().SoundSize()) == SoundListRef().PayloadCRC();
+				}
+
+				/**
+				* @brief サンプルの変換
+				*
+				* 　対象音声のサンプルを -1.0～1.0 のfloatへ変換してインターリーブのまま書き込みます
+				*
+				* 　変換処理は読み込み時にフォーマット、ビット数、チャンネル数から選択されています
+				*
+				* @param float* Dst 書き込み先 (NumFrame × Channel 以上の長さ)
+				* @param uint32_t StartFrame 開始サンプルフレーム
+				* @param uint32_t NumFrame 変換するサンプルフレーム数
+				* @return uint32_t 変換したサンプルフレーム数 (ダミーデータもしくは変換できないフォーマットの場合は 0)
+				*/
+				uint32_t DecodeSamples(float* const Dst, uint32_t StartFrame, uint32_t NumFrame) const noexcept {
+					const uint32_t NumDecode = ClampFrame(StartFrame, NumFrame);
+					if (!NumDecode) { return 0; }
+					SampleFormatRef().Kernel().Decode(FramePtr(StartFrame), NumDecode, SampleFormatRef().Channels(), Dst);
+					return NumDecode;
+				}
+
+				/**
+				* @brief サンプルのミックス
+				*
+				* 　対象音声のサンプルに左右の音量を掛けてステレオのfloatバッファへ加算します
+				*
+				* 　モノラルは左右へ、3チャンネル以上は平均してから左右へ加算します
+				*
+				* @param float* Dst 加算先のステレオバッファ (NumFrame × 2 以上の長さ)
+				* @param uint32_t StartFrame 開始サンプルフレーム
+				* @param uint32_t NumFrame 加算するサンプルフレーム数
+				* @param float GainL 左チャンネルの音量
+				* @param float GainR 右チャンネルの音量
+				* @return uint32_t 加算したサンプルフレーム数 (ダミーデータもしくは変換できないフォーマットの場合は 0)
+				*/
+				uint32_t MixSamples(float* const Dst, uint32_t StartFrame, uint32_t NumFrame, float GainL, float GainR) const noexcept {
+					const uint32_t NumMix = ClampFrame(StartFrame, NumFrame);
+					if (!NumMix) { return 0; }
+					SampleFormatRef().Kernel().Mix(FramePtr(StartFrame), NumMix, SampleFormatRef().Channels(), GainL, GainR, Dst);
+					return NumMix;
+				}
+
+				T_AccessData(const T_SNDBinaryData* const SNDBinaryDataPtr, const ksize_t DataListIndex) : kSNDBinaryDataPtr(SNDBinaryDataPtr), kDataListIndex(DataListIndex) {}
+			};
+
+			// コメント索引の検索結果をSoundDataへ変換
+			std::vector<T_AccessData> CommentResult(const std::vector<ksize_t>& DataListIndex) const {
+				std::vector<T_AccessData> Result;
+				Result.reserve(DataListIndex.size());
+				for (ksize_t index : DataListIndex) { Result.push_back(T_AccessData(SNDBinaryData.get(), index)); }
+				return Result;
+			}
+
+			// ユーザー向けの非同期読み込み操作手段
+			struct T_LoadTask {
+			private:
+				T_SNDData* SNDDataPtr_ = nullptr;
+				std::shared_ptr<T_LoadState> State_ = nullptr;
+				std::shared_future<bool> Result_ = {};
+
+			public:
+				/**
+				* @brief 読み込み済みサウンド数の取得
+				*
+				* 　処理済みのサブヘッダー数を返します(重複して読み飛ばしたサウンドも含みます)
+				*
+				* @return ksize_t NumLoaded 読み込み済みサウンド数
+				*/
+				ksize_t NumLoaded() const noexcept { return State_->NumLoaded.load(std::memory_order_acquire); }
+
+				/**
+				* @brief 全サウンド数の取得
+				*
+				* 　ヘッダーに記録されたサウンド数を返します(ヘッダーの読み込み前は 0)
+				*
+				* @return ksize_t NumSound 全サウンド数
+				*/
+				ksize_t NumSound() const noexcept { return State_->NumSound.load(std::memory_order_acquire); }
+
+				/**
+				* @brief 進捗率の取得
+				*
+				* @return double Progress 進捗率 (0.0～1.0)
+				*/
+				double Progress() const noexcept {
+					const ksize_t Total = NumSound();
+					return (Total ? std::min(1.0, static_cast<double>(NumLoaded()) / Total) : 0.0);
+				}
+
+				/**
+				* @brief 読み込みの中断
+				*
+				* 　読み込みの中断を要求します
+				*
+				* 　中断されたSNDデータは空になり、結果は false になります
+				*/
+				void Cancel() noexcept { State_->Cancel.store(true, std::memory_order_relaxed); }
+
+				/**
+				* @brief 読み込み完了の確認
+				*
+				* @return bool 確認結果 (false = 読み込み中：true = 完了)
+				*/
+				bool IsDone() const { return State_->IsDone(); }
+
+				/**
+				* @brief 読み込み完了まで待機
+				*/
+				void wait() const { Result_.wait(); }
+
+				/**
+				* @brief 読み込み結果の取得
+				*
+				* 　読み込み完了まで待機して結果を返します
+				*
+				* 　読み込み中に例外が投げられた場合は再度投げます
+				*
+				* @return bool 読み込み結果 (false = 失敗もしくは中断：true = 成功)
+				*/
+				bool get() const { return Result_.get(); }
+
+				/**
+				* @brief 完了時の処理を登録
+				*
+				* 　読み込みスレッドで完了時に呼び出されます(完了済みの場合はその場で呼び出されます)
+				*
+				* @param std::function<void()> Callback 完了時の処理
+				*/
+				void OnComplete(std::function<void()> Callback) const { State_->OnComplete(std::move(Callback)); }
+
+				/**
+				* @brief 読み込み済みデータの存在確認
+				*
+				* 　読み込み中でも読み込み済みのサウンド番号を確認できます
+				*
+				* @param int32_t GroupNo グループ番号
+				* @param int32_t ItemNo アイテム番号
+				* @return bool 検索結果 (false = 存在なし(未読込を含む) : true = 存在あり)
+				*/
+				bool ExistSoundNumber(int32_t GroupNo, int32_t ItemNo) const {
+					std::lock_guard<std::mutex> Lock(State_->DataMutex);
+					return SNDDataPtr_->SoundNumberUMap.exist(GroupNo, ItemNo);
+				}
+
+				/**
+				* @brief 読み込み済みデータへアクセス
+				*
+				* 　読み込み中でも読み込み済みのサウンドへアクセスできます
+				*
+				* 　対象が存在しない(未読込を含む)場合は例外を投げずにダミーデータを返します
+				*
+				* @param int32_t GroupNo グループ番号
+				* @param int32_t ItemNo アイテム番号
+				* @return SoundData 対象のデータ
+				*/
+				T_AccessData GetSoundData(int32_t GroupNo, int32_t ItemNo) const {
+					std::lock_guard<std::mutex> Lock(State_->DataMutex);
+					return SNDDataPtr_->FindSoundData(Convert::EncodeSoundNumber(GroupNo, ItemNo));
+				}
+
+				// C++20 のco_awaitで完了を待機するためのインターフェース
+				bool await_ready() const { return IsDone(); }
+				template<typename CoroutineHandle>
+				void await_suspend(CoroutineHandle Handle) const { OnComplete([Handle]() mutable { Handle.resume(); }); }
+				bool await_resume() const { return get(); }
+
+				T_LoadTask(T_SNDData* SNDDataPtr, std::shared_ptr<T_LoadState> State, std::shared_future<bool> Result)
+					: SNDDataPtr_(SNDDataPtr), State_(std::move(State)), Result_(std::move(Result)) {}
+			};
+
+		public:
+			/**
+			* @brief SNDデータのサウンドグループ数を取得
+			*
+			* 　読み込んだSNDデータのサウンドグループ数を返します
+			*
+			* @return int32_t NumGroup サウンドグループ数
+			*/
+			int32_t NumGroup() const noexcept { return NumGroup_; }
+
+			/**
+			* @brief SNDデータのサウンドデータ数を取得
+			*
+			* 　読み込んだSNDデータの全サウンドデータ（アイテム）数を返します
+			*
+			* @return int32_t NumItem サウンドデータ数
+			*/
+			int32_t NumItem() const noexcept { return NumItem_; }
+
+			/**
+			* @brief SNDデータのファイル名を取得
+			*
+			* 　読み込んだSNDデータの拡張子を除いたファイル名を返します
+			*
+			* @return const std::string& FileName ファイル名
+			*/
+			const std::string& FileName() const noexcept { return FileName_; }
+
+			/**
+			* @brief SNDデータの初期化
+			*
+			* 　読み込んだSNDデータを初期化します
+			*
+			* @note
+			*/
+			void clear() {
+				T_Residency::Instance().clear(Residency_.ID());
+				NumGroup(0);
+				NumItem(0);
+				FileName_.clear();
+				ContentHash_ = 0;
+				SoundNumberUMap.clear();
+				SoundGroupNoUMap.clear();
+				SNDBinaryData = T_SNDBinaryData::Empty();
+				AnalysisList_.clear();
+				WaveformList_.clear();
+				CommentIndex_.reset();
+				RecoveryReport_ = {};
+			}
+
+			/**
+			* @brief SNDデータの存在確認
+			*
+			* 　読み込んだSNDデータの空かを判定します
+			*
+			* @return bool 判定結果 (false = データが存在：true = データが空)
+			*/
+			bool empty() const noexcept {
+				return FileName().empty() && SNDBinaryData->empty() && SoundNumberUMap.empty() && SoundGroupNoUMap.empty();
+			}
+
+			/**
+			* @brief ファイル全体の内容ハッシュを取得
+			*
+			* 　読み込み時に全サウンドのサウンド番号、サイズ、内容ハッシュから求めたハッシュを返します
+			*
+			* 　サウンドの格納順やヘッダー情報には依存しません
+			*
+			* @return uint64_t ContentHash 内容ハッシュ (未読み込みの場合は 0)
+			*/
+			uint64_t ContentHash() const noexcept {
+				return ContentHash_;
+			}
+
+			/**
+			* @brief 読み込み結果の取得
+			*
+			* 　読み込み時にサブヘッダーを辿った結果(読み取れなかった範囲とサウンド数)を返します
+			*
+			* 　SNDConfig::SetRecoverSND が OFF の場合は読み込みを中断した位置からファイル末尾までを読み取れなかった範囲とします
+			*
+			* 　圧縮SNDファイルの場合は常に空の範囲を返します
+			*
+			* @return const RecoveryReport& RecoveryReport 読み込み結果 (未読み込みの場合は空)
+			*/
+			const T_RecoveryReport& GetRecoveryReport() const noexcept {
+				return RecoveryReport_;
+			}
+
+			/**
+			* @brief 他のSNDとの差分を取得
+			*
+			* 　読み込み時に求めた内容ハッシュを比較し、自身から見て指定SNDで追加、削除、変更されたサウンド番号を返します
+			*
+			* 　サウンドデータの中身は比較しません
+			*
+			* @param const SND& Other 比較先のSND
+			* @return Difference 差分 (各リストはサウンド番号順)
+			*/
+			T_SNDDiff Diff(const T_SNDData& Other) const {
+				std::vector<T_SNDDiff::SoundNumber> Added, Removed, Changed;
+				if (ContentHash() == Other.ContentHash() && NumItem() == Other.NumItem()) {
+					return T_SNDDiff(std::move(Added), std::move(Removed), std::move(Changed));
+				}
+				for (const auto& Data : SNDBinaryData->DataList()) {
+					const int32_t OtherIndex = Other.SoundNumberUMap.find(Data.GroupNo(), Data.ItemNo());
+					if (OtherIndex < 0) {
+						Removed.emplace_back(Data.GroupNo(), Data.ItemNo());
+						continue;
+					}
+					const ksize_t SoundListIndex = Data.SoundListIndex();
+					const ksize_t OtherSoundListIndex = Other.SNDBinaryData->DataList(static_cast<ksize_t>(OtherIndex)).SoundListIndex();
+					if (SNDBinaryData->SoundHash(SoundListIndex) != Other.SNDBinaryData->SoundHash(OtherSoundListIndex)
+						|| SNDBinaryData->SoundSize(SoundListIndex) != Other.SNDBinaryData->SoundSize(OtherSoundListIndex)) {
+						Changed.emplace_back(Data.GroupNo(), Data.ItemNo());
+					}
+				}
+				for (const auto& Data : Other.SNDBinaryData->DataList()) {
+					if (!SoundNumberUMap.exist(Data.GroupNo(), Data.ItemNo())) {
+						Added.emplace_back(Data.GroupNo(), Data.ItemNo());
+					}
+				}
+				return T_SNDDiff(std::move(Added), std::move(Removed), std::move(Changed));
+			}
+
+			/**
+			* @brief SNDデータのデータサイズを取得
+			*
+			* 　読み込んだSNDデータのデータサイズを返します
+			*
+			* @return size_t SNDDataSize SNDデータサイズ
+			*/
+			size_t size() const noexcept {
+				return SNDBinaryData->size();
+			}
+
+		public:
+			using SoundData = T_AccessData;
+			using SoundAnalysis = T_AnalysisData;
+			using Waveform = T_Waveform;
+			using LoopPoint = T_CueData::T_LoopPoint;
+			using RecoveryReport = T_RecoveryReport;
+			using CuePoint = T_CueData::T_CuePoint;
+			using LoadTask = T_LoadTask;
+			using Difference = T_SNDDiff;
+			using SearchPath = T_SearchPath;
+
+			T_SNDData() = default;
+
+			/**
+			* @brief 複製/移動
+			*
+			* 　複製したSNDはサウンドデータを共有し、再読み込みや消去をしたSNDだけが新しいデータを持ちます(共有中のデータは変更されません)
+			*
+			* 　移動は索引、サウンドデータを付け替えるだけで、移動元は空のSNDになります
+			*
+			* 　取得済みの SoundData は移動後も移動先のSNDと同じデータを参照します
+			*
+			* 　非同期読み込み中のSNDは読み込みが完了するまで移動しないでください
+			*/
+			T_SNDData(const T_SNDData&) = default;
+			T_SNDData(T_SNDData&& Other) noexcept : Residency_(nullptr) { swap(Other); }
+			T_SNDData& operator=(const T_SNDData& Other) {
+				if (this != &Other) { T_SNDData(Other).swap(*this); }
+				return *this;
+			}
+			T_SNDData& operator=(T_SNDData&& Other) noexcept {
+				if (this != &Other) { T_SNDData(std::move(Other)).swap(*this); }
+				return *this;
+			}
+
+			/**
+			* @brief 入れ替え
+			*
+			* 　2つのSNDの内容を入れ替えます(サウンドデータの複製、解析は行いません)
+			*
+			* 　再読み込みしたSNDと入れ替えることで、読み込み中も古いデータを参照し続けられます
+			*
+			* @param SND& Other 入れ替え先のSND
+			*/
+			void swap(T_SNDData& Other) noexcept {
+				std::swap(NumGroup_, Other.NumGroup_);
+				std::swap(NumItem_, Other.NumItem_);
+				FileName_.swap(Other.FileName_);
+				std::swap(ContentHash_, Other.ContentHash_);
+				std::swap(SoundNumberUMap, Other.SoundNumberUMap);
+				std::swap(SoundGroupNoUMap, Other.SoundGroupNoUMap);
+				SNDBinaryData.swap(Other.SNDBinaryData);
+				AnalysisList_.swap(Other.AnalysisList_);
+				WaveformList_.swap(Other.WaveformList_);
+				CommentIndex_.swap(Other.CommentIndex_);
+				std::swap(SearchPath_, Other.SearchPath_);
+				std::swap(RecoveryReport_, Other.RecoveryReport_);
+				Residency_.swap(Other.Residency_);
+			}
+			friend void swap(T_SNDData& lhs, T_SNDData& rhs) noexcept { lhs.swap(rhs); }
+
+			/**
+			* @brief サウンドデータの共有確認
+			*
+			* 　複製したSNDと同じサウンドデータを共有しているかを返します
+			*
+			* @param const SND& Other 比較先のSND
+			* @return bool 確認結果 (false = 別のデータ：true = 共有中)
+			*/
+			bool IsSharing(const T_SNDData& Other) const noexcept {
+				return !SNDBinaryData->empty() && SNDBinaryData == Other.SNDBinaryData;
+			}
+
+			T_SNDData(const std::string& FileName, const std::string& FilePath = "")
+			{
+				LoadSNDFile(FileName, FilePath, SearchPath_);
+			}
+
+			/**
+			* @brief 指定されたSNDファイルを読み込み
+			*
+			* 　実行ファイルから子階層へファイル名を検索して読み込みます
+			*
+			* 　第二引数指定時は指定した階層からファイル名を検索します(SetSearchPath、SNDConfigよりも優先されます)
+			*
+			* 　実行時に既存の要素は初期化、上書きされます
+			*
+			* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可、フォルダを含む場合は検索先からの相対パス)
+			* @param const std::string& FilePath 対象のパス (省略時はSetSearchPathの検索先、未設定の場合は実行ファイルの子階層を探索)
+			* @return bool 読み込み結果 (false = 失敗：true = 成功)
+			*/
+			bool LoadSND(const std::string& FileName, const std::string& FilePath = "") {
+				return LoadSNDFile(FileName, FilePath, SearchPath_);
+			}
+
+			/**
+			* @brief 指定された検索先からSNDファイルを読み込み
+			*
+			* 　指定した検索先を登録順に検索して読み込みます(SetSearchPath、SNDConfigよりも優先されます)
+			*
+			* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可、フォルダを含む場合は検索先からの相対パス)
+			* @param const SearchPath& SearchPath 検索先 (空の場合はLoadSND(FileName)と同じ)
+			* @return bool 読み込み結果 (false = 失敗：true = 成功)
+			*/
+			bool LoadSND(const std::string& FileName, const SearchPath& SearchPath) {
+				return LoadSNDFile(FileName, "", (SearchPath.empty() ? SearchPath_ : SearchPath));
+			}
+
+			/**
+			* @brief 検索先の設定/取得
+			*
+			* 　FilePathを省略したLoadSND、LoadSNDAsyncで使用する検索先を設定します
+			*
+			* 　空の検索先を設定した場合はSNDConfig::SetSNDSearchPathの設定に戻ります
+			*
+			* @param const SearchPath& SearchPath 検索先
+			* @return const SearchPath& 検索先 / なし(void)
+			*/
+			void SetSearchPath(const SearchPath& SearchPath) { SearchPath_ = SearchPath; }
+			const SearchPath& GetSearchPath() const noexcept { return SearchPath_; }
+
+			/**
+			* @brief 指定されたSNDファイルを非同期で読み込み
+			*
+			* 　LoadSND関数と同じ処理を別スレッドで行い、進捗の取得と中断ができるLoadTaskを返します
+			*
+			* 　読み込み済みのサウンドはLoadTask経由で読み込み中でも取得できます
+			*
+			* 　完了するまでSNDの関数は呼び出さず、SNDを破棄しないでください
+			*
+			* 　LoadTaskを破棄しても読み込みは継続されます
+			*
+			* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可)
+			* @param const std::string& FilePath 対象のパス (省略時は実行ファイルの子階層を探索)
+			* @return LoadTask 読み込みタスク
+			*/
+			LoadTask LoadSNDAsync(const std::string& FileName, const std::string& FilePath = "") {
+				return LoadSNDFileAsync(FileName, FilePath, SearchPath_);
+			}
+
+			/**
+			* @brief 指定された検索先からSNDファイルを非同期で読み込み
+			*
+			* 　LoadSND(FileName, SearchPath)関数と同じ処理を別スレッドで行います
+			*
+			* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可、フォルダを含む場合は検索先からの相対パス)
+			* @param const SearchPath& SearchPath 検索先 (空の場合はLoadSNDAsync(FileName)と同じ)
+			* @return LoadTask 読み込みタスク
+			*/
+			LoadTask LoadSNDAsync(const std::string& FileName, const SearchPath& SearchPath) {
+				return LoadSNDFileAsync(FileName, "", (SearchPath.empty() ? SearchPath_ : SearchPath));
+			}
+
+		private:
+			LoadTask LoadSNDFileAsync(const std::string& FileName, const std::string& FilePath, const T_SearchPath& SearchPath) {
+				auto State = std::make_shared<T_LoadState>();
+				std::promise<bool> Promise;
+				std::shared_future<bool> Result = Promise.get_future().share();
+				std::thread([this, State, Promise = std::move(Promise), FileName, FilePath, SearchPath]() mutable {
+					try {
+						Promise.set_value(LoadSNDFile(FileName, FilePath, SearchPath, State.get()));
+					}
+					catch (...) {
+						Promise.set_exception(std::current_exception());
+					}
+					// 結果を設定してから完了時の処理を呼び出す(co_awaitの再開先でget()を呼び出せるように)
+					State->Complete();
+				}).detach();
+				return LoadTask(this, State, Result);
+			}
+
+		public:
+			/**
+			* @brief 指定番号の存在確認
+			*
+			* 　読み込んだSNDデータを検索し、指定番号が存在するかを確認します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @return bool 検索結果 (false = 存在なし : true = 存在あり)
+			*/
+			bool ExistSoundNumber(int32_t GroupNo, int32_t ItemNo) {
+				return SoundNumberUMap.exist(GroupNo, ItemNo);
+			}
+
+			/**
+			* @brief 指定番号のデータへアクセス
+			*
+			* 　指定したグループ番号とアイテム番号のSNDデータへアクセスします
+			*
+			* 　対象が存在しない場合はSNDConfig::SetThrowErrorの設定に準拠します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @retval 対象が存在する SoundData
+			* @retval 対象が存在しない SNDConfig::SetThrowError (false = ダミーデータの参照：true = 例外を投げる)
+			*/
+			SoundData GetSoundData(int32_t GroupNo, int32_t ItemNo) {
+				if (ExistSoundNumber(GroupNo, ItemNo)) {
+					return SoundData(SNDBinaryData.get(), SoundNumberUMap.find(GroupNo, ItemNo));
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return SoundData(SNDBinaryData.get(), KSIZE_MAX);
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundNumber, GroupNo, ItemNo);
+			}
+
+			/**
+			* @brief エンコード済みサウンド番号のデータへアクセス
+			*
+			* 　Convert::EncodeSoundNumber でまとめたサウンド番号でSNDデータへアクセスします
+			*
+			* 　対象が存在しない場合は例外を投げずにダミーデータを返します
+			*
+			* @param int64_t SoundNumber エンコード済みサウンド番号
+			* @return SoundData 対象のデータ (存在しない場合はダミーデータ)
+			*/
+			SoundData FindSoundData(int64_t SoundNumber) {
+				const int32_t index = SoundNumberUMap.find(SoundNumber);
+				return SoundData(SNDBinaryData.get(), (index >= 0 ? static_cast<ksize_t>(index) : KSIZE_MAX));
+			}
+
+			/**
+			* @brief 指定インデックスデータの存在確認
+			*
+			* 　読み込んだSNDデータを検索し、指定インデックスのデータ存在するかを確認します
+			*
+			* @param int32_t index データ配列インデックス
+			* @return bool 検索結果 (false = 存在なし : true = 存在あり)
+			*/
+			bool ExistSoundDataIndex(int32_t SoundDataIndex) const {
+				return static_cast<ksize_t>(SoundDataIndex) < SoundNumberUMap.size();
+			}
+
+			/**
+			* @brief 指定インデックスのデータへアクセス
+			*
+			* 　SNDデータへ指定したインデックスでアクセスします
+			*
+			* 　対象が存在しない場合はSNDConfig::SetThrowErrorの設定に準拠します
+			*
+			* @param int32_t index データ配列インデックス
+			* @retval 対象が存在する SoundData
+			* @retval 対象が存在しない SNDConfig::SetThrowError (false = ダミーデータの参照：true = 例外を投げる)
+			*/
+			SoundData GetSoundDataIndex(int32_t index) const {
+				if (ExistSoundDataIndex(index)) {
+					return SoundData(SNDBinaryData.get(), index);
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return SoundData(SNDBinaryData.get(), KSIZE_MAX);
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundIndex, index);
+			}
+
+			/**
+			* @brief 全サウンドの解析
+			*
+			* 　読み込んだ全サウンドを並列で解析し、結果を保持します
+			*
+			* 　内容が同一のサウンドは1回だけ解析されます
+			*
+			* @param double SilenceThreshold 無音と判定する振幅 (省略時は -60dBFS)
+			*/
+			void AnalyzeAll(double SilenceThreshold = T_SoundAnalyzer::kDefaultSilenceThreshold) {
+				AnalysisList_.assign(SNDBinaryData->NumSound(), T_AnalysisData());
+				Parallel::For(AnalysisList_.size(), [this, SilenceThreshold](size_t index) {
+					const auto& SoundList = SNDBinaryData->SoundList(static_cast<ksize_t>(index));
+					AnalysisList_[index] = T_SoundAnalyzer::Analyze(SoundList.SampleData(), SoundList.SampleFormat(), SilenceThreshold);
+				});
+			}
+
+			/**
+			* @brief 全サウンドの波形概要の作成
+			*
+			* 　読み込んだ全サウンドの波形概要(最小値、最大値、RMSの階層)を並列で作成し、結果を保持します
+			*
+			* 　長いサウンドは一定のブロック数ごとに分けて複数のスレッドで作成されます
+			*
+			* 　SNDConfig::SetWaveformCache が ON の場合はSAELibフォルダのキャッシュを使用し、新しく作成したサウンドがあればキャッシュを書き直します
+			*/
+			void BuildWaveformAll() {
+				std::vector<T_Waveform> WaveformList(SNDBinaryData->NumSound());
+				const std::filesystem::path CachePath = (T_Config::Instance().WaveformCache() && !WaveformList.empty() ? WaveformCachePath() : std::filesystem::path());
+				if (!CachePath.empty()) { ReadWaveformCache(CachePath, WaveformList); }
+
+				std::vector<T_Waveform::T_Source> SourceList(WaveformList.size());
+				bool IsChanged = false;
+				for (ksize_t index = 0; index < SourceList.size(); ++index) {
+					const auto& SoundList = SNDBinaryData->SoundList(index);
+					if (WaveformList[index].IsValid() || !SoundList.SampleFormat().IsSupported()) { continue; }
+					SourceList[index] = { SoundList.SampleData(), &SoundList.SampleFormat() };
+					IsChanged = true;
+				}
+				if (IsChanged) {
+					std::vector<T_Waveform> BuildList = T_Waveform::Build(SourceList);
+					for (size_t index = 0; index < BuildList.size(); ++index) {
+						if (SourceList[index].Data) { WaveformList[index] = std::move(BuildList[index]); }
+					}
+					if (!CachePath.empty()) { WriteWaveformCache(CachePath, WaveformList); }
+				}
+				WaveformList_ = std::move(WaveformList);
+			}
+
+			/**
+			* @brief グループの先読み
+			*
+			* 　指定したグループ(もしくはサウンド)のサウンドデータを物理メモリへ載せて固定します
+			*
+			* 　固定したサウンドの初回再生でページフォルトが発生しなくなります
+			*
+			* 　固定サイズが PrefetchBudget を超えた場合は最も古く先読みしたグループから固定を解除します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号 (省略時はグループ全体)
+			* @return bool 先読み結果 (false = 対象が存在しないもしくはOSが固定を拒否した(物理メモリへは載せています)：true = 固定済み)
+			*/
+			bool Prefetch(int32_t GroupNo) {
+				const std::vector<ksize_t> SoundListIndex = FindSoundListIndex(GroupNo, std::nullopt);
+				return !SoundListIndex.empty() && T_Residency::Instance().Prefetch(Residency_.ID(), GroupNo, SoundListIndex, *SNDBinaryData);
+			}
+			bool Prefetch(int32_t GroupNo, int32_t ItemNo) {
+				const std::vector<ksize_t> SoundListIndex = FindSoundListIndex(GroupNo, ItemNo);
+				return !SoundListIndex.empty() && T_Residency::Instance().Prefetch(Residency_.ID(), GroupNo, SoundListIndex, *SNDBinaryData);
+			}
+
+			/**
+			* @brief 先読みの解除
+			*
+			* 　指定したグループの固定を解除します(メモリ不足時にOSが退避できるようになります)
+			*
+			* @param int32_t GroupNo グループ番号
+			*/
+			void Evict(int32_t GroupNo) {
+				T_Residency::Instance().Evict(Residency_.ID(), GroupNo);
+			}
+
+			/**
+			* @brief 先読みの上限サイズを設定/取得
+			*
+			* 　固定するサウンドデータの合計サイズの上限を設定します(初期値は 64MB)
+			*
+			* @param size_t Size 上限サイズ
+			* @return size_t Size 上限サイズ
+			*/
+			void PrefetchBudget(size_t Size) { T_Residency::Instance().PrefetchBudget(Residency_.ID(), Size); }
+			size_t PrefetchBudget() const { return T_Residency::Instance().PrefetchBudget(Residency_.ID()); }
+
+			/**
+			* @brief 先読み中のサイズを取得
+			*
+			* @return size_t Size 固定中のサウンドデータの合計サイズ
+			*/
+			size_t PrefetchSize() const { return T_Residency::Instance().PrefetchSize(Residency_.ID()); }
+
+			/**
+			* @brief 先読み済みの確認
+			*
+			* 　指定番号のサウンドデータが先読みで固定されているかを確認します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @return bool 確認結果 (false = 固定されていない：true = 固定中)
+			*/
+			bool IsPrefetched(int32_t GroupNo, int32_t ItemNo) {
+				if (!ExistSoundNumber(GroupNo, ItemNo)) { return false; }
+				const ksize_t SoundListIndex = SNDBinaryData->DataList(SoundNumberUMap.find(GroupNo, ItemNo)).SoundListIndex();
+				return T_Residency::Instance().IsPrefetched(Residency_.ID(), GroupNo, SoundListIndex);
+			}
+
+			/**
+			* @brief コメントの部分一致検索
+			*
+			* 　UTF-8に変換したコメントに指定文字列を含むサウンドを返します(英字の大文字小文字は区別しません)
+			*
+			* 　初回の検索時に全コメントの索引を作成します(SNDConfig::SetCommentUTF8 が有効な場合は読み込み時に作成済みです)
+			*
+			* @param std::string_view Text 検索文字列 (UTF-8)
+			* @return std::vector<SoundData> SoundList 該当するサウンド (読み込み順)
+			*/
+			std::vector<SoundData> FindComment(std::string_view Text) {
+				return CommentResult(CommentIndex().Find(Text));
+			}
+
+			/**
+			* @brief コメントの前方一致検索
+			*
+			* 　UTF-8に変換したコメントが指定文字列から始まるサウンドを返します(英字の大文字小文字は区別しません)
+			*
+			* @param std::string_view Text 検索文字列 (UTF-8)
+			* @return std::vector<SoundData> SoundList 該当するサウンド (読み込み順)
+			*/
+			std::vector<SoundData> FindCommentPrefix(std::string_view Text) {
+				return CommentResult(CommentIndex().FindPrefix(Text));
+			}
+
+			/**
+			* @brief 指定番号の解析結果を取得
+			*
+			* 　AnalyzeAll関数で解析した指定番号の解析結果を返します
+			*
+			* 　未解析の場合は既定の無音判定で全サウンドを解析します
+			*
+			* 　対象が存在しない場合はSNDConfig::SetThrowErrorの設定に準拠します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @retval 対象が存在する SoundAnalysis
+			* @retval 対象が存在しない SNDConfig::SetThrowError (false = IsValid() が false の解析結果：true = 例外を投げる)
+			*/
+			SoundAnalysis GetSoundAnalysis(int32_t GroupNo, int32_t ItemNo) {
+				if (AnalysisList_.size() != SNDBinaryData->NumSound()) { AnalyzeAll(); }
+				if (ExistSoundNumber(GroupNo, ItemNo)) {
+					return AnalysisList_[SNDBinaryData->DataList(SoundNumberUMap.find(GroupNo, ItemNo)).SoundListIndex()];
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return SoundAnalysis();
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundNumber, GroupNo, ItemNo);
+			}
+
+			/**
+			* @brief 指定番号の波形概要を取得
+			*
+			* 　BuildWaveformAll関数で作成した指定番号の波形概要を返します
+			*
+			* 　未作成の場合は全サウンドの波形概要を作成します
+			*
+			* 　対象が存在しない場合はSNDConfig::SetThrowErrorの設定に準拠します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @retval 対象が存在する Waveform
+			* @retval 対象が存在しない SNDConfig::SetThrowError (false = IsValid() が false の波形概要：true = 例外を投げる)
+			*/
+			Waveform GetWaveform(int32_t GroupNo, int32_t ItemNo) {
+				if (WaveformList_.size() != SNDBinaryData->NumSound()) { BuildWaveformAll(); }
+				if (ExistSoundNumber(GroupNo, ItemNo)) {
+					return WaveformList_[SNDBinaryData->DataList(SoundNumberUMap.find(GroupNo, ItemNo)).SoundListIndex()];
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return Waveform();
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundNumber, GroupNo, ItemNo);
+			}
+
+		}; // struct T_SNDData
+
+		// SNDファイルの書き出し
+		struct T_SNDWriter {
+		private:
+			const T_SNDData& kSNDData;
+			bool SortSoundNumber_ = false;
+			bool Compress_ = false;
+			ksize_t PayloadAlign_ = 1;
+
+			inline static constexpr ksize_t kSubHeaderSize = 16;
+			inline static constexpr ksize_t kPageSize = 4096;
+
+			struct T_WriteList {
+				ksize_t DataListIndex = 0;
+				ksize_t SubHeaderStart = 0;
+				ksize_t SoundStart = 0;
+			};
+
+			[[nodiscard]] static uint64_t AlignUp(uint64_t value, ksize_t align) noexcept {
+				return (align <= 1 ? value : (value + align - 1) / align * align);
+			}
+
+			[[nodiscard]] std::vector<ksize_t> WriteOrder() const {
+				const T_SNDBinaryData& SNDBinaryData = *kSNDData.SNDBinaryData;
+				std::vector<ksize_t> Order(SNDBinaryData.DataList().size());
+				for (ksize_t index = 0; index < Order.size(); ++index) { Order[index] = index; }
+
+				if (SortSoundNumber_) {
+					std::stable_sort(Order.begin(), Order.end(), [&SNDBinaryData](ksize_t lhs, ksize_t rhs) {
+						const auto& L = SNDBinaryData.DataList(lhs);
+						const auto& R = SNDBinaryData.DataList(rhs);
+						return (L.GroupNo() != R.GroupNo() ? L.GroupNo() < R.GroupNo() : L.ItemNo() < R.ItemNo());
+					});
+				}
+				return Order;
+			}
+
+			// 書き出し位置の算出(サブヘッダーの直後にサウンドデータが続く形式のため最初のサウンドは整列できない)
+			[[nodiscard]] bool BuildWriteList(std::vector<T_WriteList>& WriteList) const {
+				const T_SNDBinaryData& SNDBinaryData = *kSNDData.SNDBinaryData;
+				uint64_t Offset = SNDFormat::kSubHeaderStart;
+
+				for (ksize_t DataListIndex : WriteOrder()) {
+					uint64_t SoundStart = Offset + kSubHeaderSize;
+					if (!WriteList.empty()) {
+						SoundStart = AlignUp(SoundStart, PayloadAlign_);
+					}
+					Offset = SoundStart + SNDBinaryData.SoundSize(SNDBinaryData.DataList(DataListIndex).SoundListIndex());
+					if (Offset > SNDFormat::kFileSizeLimit) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDFileSize);
+						return false;
+					}
+					WriteList.push_back({ DataListIndex, static_cast<ksize_t>(SoundStart - kSubHeaderSize), static_cast<ksize_t>(SoundStart) });
+				}
+				return true;
+			}
+
+			void WriteSNDBinary(std::ofstream& File, const std::vector<T_WriteList>& WriteList) const {
+				// ヘッダー
+				// 0～11 識別子("ElecbyteSnd")
+				// 12～ バージョン、サウンド数、サブヘッダー開始位置
+				// 24～ コメント(空)
+				std::vector<unsigned char> buffer(SNDFormat::kSubHeaderStart, 0);
+				std::memcpy(buffer.data(), SNDFormat::kSignature.data(), SNDFormat::kSignature.size());
+				EncodeEndian::UInt32BE(&buffer[12], SNDFormat::kSNDVersion);
+				EncodeEndian::UInt32LE(&buffer[16], static_cast<uint32_t>(WriteList.size()));
+				EncodeEndian::UInt32LE(&buffer[20], SNDFormat::kSubHeaderStart);
+				File.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+				const T_SNDBinaryData& SNDBinaryData = *kSNDData.SNDBinaryData;
+				ksize_t Offset = SNDFormat::kSubHeaderStart;
+				for (size_t WriteNo = 0; WriteNo < WriteList.size(); ++WriteNo) {
+					const T_WriteList& Target = WriteList[WriteNo];
+					const auto& DataList = SNDBinaryData.DataList(Target.DataListIndex);
+					const ksize_t SoundSize = SNDBinaryData.SoundSize(DataList.SoundListIndex());
+					const ksize_t NextAddress = (WriteNo + 1 < WriteList.size() ? WriteList[WriteNo + 1].SubHeaderStart : Target.SoundStart + SoundSize);
+
+					// 整列用の空白
+					buffer.assign(Target.SubHeaderStart - Offset, 0);
+					File.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+					// 0～16 メイン情報
+					// 17～  WAVEデータ
+					unsigned char SubHeader[kSubHeaderSize] = {};
+					EncodeEndian::UInt32LE(&SubHeader[0], NextAddress);
+					EncodeEndian::UInt32LE(&SubHeader[4], SoundSize);
+					EncodeEndian::UInt32LE(&SubHeader[8], static_cast<uint32_t>(DataList.GroupNo()));
+					EncodeEndian::UInt32LE(&SubHeader[12], static_cast<uint32_t>(DataList.ItemNo()));
+					File.write(reinterpret_cast<const char*>(SubHeader), sizeof(SubHeader));
+					File.write(reinterpret_cast<const char*>(SNDBinaryData.Sound(DataList.SoundListIndex())), SoundSize);
+
+					Offset = Target.SoundStart + SoundSize;
+				}
+			}
+
+			// 重複したサウンドデータは1つの圧縮データを参照する
+			[[nodiscard]] bool WriteCompressedBinary(std::ofstream& File) const {
+				const T_SNDBinaryData& SNDBinaryData = *kSNDData.SNDBinaryData;
+				const std::vector<ksize_t> Order = WriteOrder();
+
+				// 圧縮効果が無いサウンドは無圧縮で格納する
+				std::vector<std::vector<unsigned char>> CompressedBinary(SNDBinaryData.NumSound());
+				Parallel::For(CompressedBinary.size(), [&](size_t index) {
+					const ksize_t SoundIndex = static_cast<ksize_t>(index);
+					CompressedBinary[index] = LZ4Block::Compress(SNDBinaryData.Sound(SoundIndex), SNDBinaryData.SoundSize(SoundIndex));
+					if (CompressedBinary[index].size() >= SNDBinaryData.SoundSize(SoundIndex)) {
+						CompressedBinary[index].assign(SNDBinaryData.Sound(SoundIndex), SNDBinaryData.Sound(SoundIndex) + SNDBinaryData.SoundSize(SoundIndex));
+					}
+				});
+
+				uint64_t Offset = SNDFormat::kCompressedHeaderSize + uint64_t{ Order.size() + CompressedBinary.size() } * SNDFormat::kCompressedIndexSize;
+				std::vector<unsigned char> buffer(static_cast<size_t>(Offset), 0);
+				std::memcpy(buffer.data(), SNDFormat::kCompressedSignature.data(), SNDFormat::kCompressedSignature.size());
+				EncodeEndian::UInt32LE(&buffer[12], SNDFormat::kCompressedVersion);
+				EncodeEndian::UInt32LE(&buffer[16], static_cast<uint32_t>(Order.size()));
+				EncodeEndian::UInt32LE(&buffer[20], static_cast<uint32_t>(CompressedBinary.size()));
+
+				unsigned char* Index = &buffer[SNDFormat::kCompressedHeaderSize];
+				for (ksize_t DataListIndex : Order) {
+					const auto& DataList = SNDBinaryData.DataList(DataListIndex);
+					EncodeEndian::UInt32LE(&Index[0], static_cast<uint32_t>(DataList.GroupNo()));
+					EncodeEndian::UInt32LE(&Index[4], static_cast<uint32_t>(DataList.ItemNo()));
+					EncodeEndian::UInt32LE(&Index[8], DataList.SoundListIndex());
+					Index += SNDFormat::kCompressedIndexSize;
+				}
+				for (ksize_t SoundIndex = 0; SoundIndex < CompressedBinary.size(); ++SoundIndex) {
+					if (Offset + CompressedBinary[SoundIndex].size() > SNDFormat::kFileSizeLimit) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDFileSize);
+						return false;
+					}
+					EncodeEndian::UInt32LE(&Index[0], static_cast<uint32_t>(Offset));
+					EncodeEndian::UInt32LE(&Index[4], static_cast<uint32_t>(CompressedBinary[SoundIndex].size()));
+					EncodeEndian::UInt32LE(&Index[8], SNDBinaryData.SoundSize(SoundIndex));
+					Index += SNDFormat::kCompressedIndexSize;
+					Offset += CompressedBinary[SoundIndex].size();
+				}
+
+				File.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+				for (const auto& Compressed : CompressedBinary) {
+					File.write(reinterpret_cast<const char*>(Compressed.data()), Compressed.size());
+				}
+				return true;
+			}
+
+			[[nodiscard]] const std::filesystem::path EnsureSndExtension(const std::filesystem::path& FileName) const {
+				std::filesystem::path FixedFileName = FileName;
+				if (FixedFileName.extension() != SNDFormat::kExtension) {
+					if (!FixedFileName.extension().empty()) {
+						T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDExtension);
+					}
+					FixedFileName.replace_extension(SNDFormat::kExtension);
+				}
+				return FixedFileName;
+			}
+
+		public:
+			T_SNDWriter(const T_SNDData& SNDData) : kSNDData(SNDData) {}
+
+			/**
+			* @brief サウンド番号順の並び替え設定
+			*
+			* 　書き出すサウンドをグループ番号、アイテム番号の順に並び替えるかを指定できます
+			*
+			* @param bool flag (false = 読み込み順：true = サウンド番号順)
+			*/
+			void SortSoundNumber(bool flag) noexcept { SortSoundNumber_ = flag; }
+
+			/**
+			* @brief サウンドデータの整列設定
+			*
+			* 　サウンドデータの開始位置を指定したバイト境界に揃えます
+			*
+			* 　SNDファイルの形式上、最初のサウンドデータは整列されません
+			*
+			* @param ksize_t Align バイト境界 (0 または 1 の場合は整列しない)
+			*/
+			void PayloadAlign(ksize_t Align) noexcept { PayloadAlign_ = (Align ? Align : 1); }
+
+			/**
+			* @brief 再配置設定
+			*
+			* 　サウンド番号順の並び替えとページ境界への整列をまとめて設定します
+			*
+			* 　重複したサウンドデータはSNDファイルの形式上まとめられないため、読み込み時の重複排除で共有されます
+			*/
+			void Repack() noexcept {
+				SortSoundNumber(true);
+				PayloadAlign(kPageSize);
+			}
+
+			/**
+			* @brief 圧縮設定
+			*
+			* 　サウンドデータをサウンドごとにLZ4ブロック形式で圧縮した圧縮SNDファイルとして書き出すかを指定できます
+			*
+			* 　圧縮SNDファイルはLoadSND関数でそのまま読み込めます
+			*
+			* 　重複したサウンドデータは1つにまとめられ、サウンドデータの整列設定は使用されません
+			*
+			* @param bool flag (false = SNDファイル：true = 圧縮SNDファイル)
+			*/
+			void Compress(bool flag) noexcept { Compress_ = flag; }
+
+			/**
+			* @brief SNDファイルの書き出し
+			*
+			* 　読み込んだSNDデータをSNDファイルとして書き出します
+			*
+			* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可)
+			* @param const std::string& FilePath 書き出し先のパス (省略時は実行ファイルの階層)
+			* @return bool 書き出し結果 (false = 失敗：true = 成功)
+			*/
+			bool WriteSND(const std::string& FileName, const std::string& FilePath = "") {
+				if (FileName.empty()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_EmptySNDFilePath);
+					return false;
+				}
+
+				std::vector<T_WriteList> WriteList;
+				if (!Compress_ && !BuildWriteList(WriteList)) { return false; }
+
+				T_FilePathSystem SNDFolder(FilePath.empty() ? std::filesystem::current_path() : std::filesystem::path(FilePath));
+				if (SNDFolder.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_LoadSNDPath);
+					return false;
+				}
+				SNDFolder.CreateDirectory(SNDFolder.Path());
+				if (SNDFolder.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateExportSNDFolder);
+					return false;
+				}
+
+				std::ofstream File(SNDFolder.Path() / EnsureSndExtension(FileName), std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateSNDFile);
+					return false;
+				}
+
+				if (Compress_) {
+					if (!WriteCompressedBinary(File)) { return false; }
+				}
+				else {
+					WriteSNDBinary(File, WriteList);
+				}
+				File.flush();
+
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_WriteSNDFile);
+					return false;
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CloseSNDFile);
+					return false;
+				}
+				return true;
+			}
+
+			/**
+			* @brief WAVファイルの書き出し
+			*
+			* 　読み込んだサウンドデータを "グループ番号-アイテム番号.wav" の名前で1サウンドずつWAVファイルとして書き出します
+			*
+			* 　サウンドデータはSNDファイル内のWAVEデータをそのまま書き出し、複数のスレッドで並列に処理します
+			*
+			* @param const std::string& FolderPath 書き出し先のフォルダ (省略時は実行ファイルの階層)
+			* @return bool 書き出し結果 (false = 1つ以上失敗：true = 全て成功)
+			*/
+			bool ExportWAV(const std::string& FolderPath = "") const {
+				T_FilePathSystem WAVFolder(FolderPath.empty() ? std::filesystem::current_path() : std::filesystem::path(FolderPath));
+				if (WAVFolder.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_LoadSNDPath);
+					return false;
+				}
+				WAVFolder.CreateDirectory(WAVFolder.Path());
+				if (WAVFolder.ErrorCode()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateExportWAVFolder);
+					return false;
+				}
+
+				// ワーカー内では例外を投げられないため失敗内容を記録して後でまとめて通知する
+				const T_SNDBinaryData& SNDBinaryData = *kSNDData.SNDBinaryData;
+				std::vector<int32_t> Result(SNDBinaryData.DataList().size(), -1);
+				Parallel::For(Result.size(), [&](size_t index) {
+					const auto& DataList = SNDBinaryData.DataList(static_cast<ksize_t>(index));
+					const std::string FileName = std::to_string(DataList.GroupNo()) + "-" + std::to_string(DataList.ItemNo()) + ".wav";
+
+					std::ofstream File(WAVFolder.Path() / FileName, std::ios::binary);
+					if (!File.is_open()) {
+						Result[index] = ErrorMessage::Failed_CreateWAVFile;
+						return;
+					}
+					File.write(reinterpret_cast<const char*>(SNDBinaryData.Sound(DataList.SoundListIndex())), SNDBinaryData.SoundSize(DataList.SoundListIndex()));
+					File.flush();
+					if (File.fail() || File.bad()) {
+						Result[index] = ErrorMessage::Failed_WriteWAVFile;
+						return;
+					}
+					File.close();
+					if (File.fail() || File.bad()) {
+						Result[index] = ErrorMessage::Failed_CloseWAVFile;
+					}
+				});
+
+				bool Success = true;
+				for (size_t index = 0; index < Result.size(); ++index) {
+					if (Result[index] < 0) { continue; }
+					const auto& DataList = SNDBinaryData.DataList(static_cast<ksize_t>(index));
+					T_ErrorHandle::Instance().SetError(Result[index], DataList.GroupNo(), DataList.ItemNo());
+					Success = false;
+				}
+				return Success;
+			}
+		};
+
+		// 読み込み済みSNDの状態を1つのバイナリにまとめたスナップショットの形式
+		// 各セクションは先頭からのオフセットで参照するため、共有メモリ等の任意のアドレスに配置したまま参照できる
+		// 0～15   識別子("SAELibSndSnap")
+		// 16～47  バージョン、グループ数、サウンドデータ数、DataList数、SoundList数、サウンド番号索引の容量、グループ番号索引の容量、ファイル名のサイズ
+		// 48～63  内容ハッシュ、全体のサイズ
+		// 64～111 DataList、SoundList、サウンド番号索引、グループ番号索引、ファイル名、サウンドデータの開始位置
+		// 以降    各セクション(16バイト境界に整列)
+		namespace SnapshotFormat {
+			inline constexpr std::string_view kSignature = "SAELibSndSnap";
+			inline constexpr uint32_t kVersion = 1;
+			inline constexpr size_t kHeaderSize = 112;
+			inline constexpr size_t kAlign = 16;
+
+			// DataList(GroupNo, ItemNo, SoundList番号, 予約)
+			inline constexpr size_t kDataListSize = 16;
+
+			// SoundList
+			// 0～31  WAVEデータの開始位置、サンプルデータの開始位置(ADPCMは展開後のPCM)、内容ハッシュ、SAEの秒数(double)
+			// 32～63 WAVEデータのサイズ、サンプルデータのサイズ、dataチャンクのサイズ、ヘルツ、サンプルフレーム数、サンプル数、コメントの位置(WAVEデータ内)、コメントのサイズ
+			// 64～79 フォーマット、チャンネル数、ビット数、変換時のビット数、変換処理のフォーマット(0 = 変換できない)、予約
+			inline constexpr size_t kSoundListSize = 80;
+
+			// 索引(キー、DataList番号もしくはグループの登録順、予約)の線形探索ハッシュ表の要素サイズと最小の要素数
+			inline constexpr size_t kIndexSlotSize = 16;
+			inline constexpr size_t kMinIndexCapacity = 16;
+		};
+
+		// スナップショットを配置する名前付き共有メモリ(作成したプロセスが破棄すると新しく開くことはできない)
+		struct T_SharedMemory {
+		private:
+			std::string Name_ = {};
+			unsigned char* Data_ = nullptr;
+			size_t Size_ = 0;
+			bool IsOwner_ = false;
+#if defined(_WIN32)
+			HANDLE Handle_ = nullptr;
+#endif
+
+			// POSIXの共有メモリ名は '/' から始める
+			[[nodiscard]] static std::string NativeName(const std::string& Name) {
+#if defined(_WIN32)
+				return Name;
+#else
+				return (!Name.empty() && Name.front() == '/' ? Name : "/" + Name);
+#endif
+			}
+
+			void Release() noexcept {
+#if defined(_WIN32)
+				if (Data_) { UnmapViewOfFile(Data_); }
+				if (Handle_) { CloseHandle(Handle_); }
+				Handle_ = nullptr;
+#else
+				if (Data_) { munmap(Data_, Size_); }
+				if (IsOwner_) { shm_unlink(Name_.c_str()); }
+#endif
+				Name_.clear();
+				Data_ = nullptr;
+				Size_ = 0;
+				IsOwner_ = false;
+			}
+
+		public:
+			T_SharedMemory() = default;
+			~T_SharedMemory() { Release(); }
+			T_SharedMemory(const T_SharedMemory&) = delete;
+			T_SharedMemory& operator=(const T_SharedMemory&) = delete;
+
+			T_SharedMemory(T_SharedMemory&& Other) noexcept { *this = std::move(Other); }
+			T_SharedMemory& operator=(T_SharedMemory&& Other) noexcept {
+				if (this == &Other) { return *this; }
+				Release();
+				Name_ = std::move(Other.Name_);
+				Data_ = std::exchange(Other.Data_, nullptr);
+				Size_ = std::exchange(Other.Size_, 0);
+				IsOwner_ = std::exchange(Other.IsOwner_, false);
+#if defined(_WIN32)
+				Handle_ = std::exchange(Other.Handle_, nullptr);
+#endif
+				return *this;
+			}
+
+			[[nodiscard]] const std::string& Name() const noexcept { return Name_; }
+			[[nodiscard]] const unsigned char* Data() const noexcept { return Data_; }
+			[[nodiscard]] unsigned char* WritableData() noexcept { return (IsOwner_ ? Data_ : nullptr); }
+			[[nodiscard]] size_t size() const noexcept { return Size_; }
+			[[nodiscard]] bool empty() const noexcept { return Data_ == nullptr; }
+			[[nodiscard]] bool IsOwner() const noexcept { return IsOwner_; }
+
+			// 書き込み可能な共有メモリを作成する(同名の共有メモリが残っている場合は置き換える)
+			[[nodiscard]] bool Create(const std::string& Name, size_t Size) {
+				Release();
+				if (Name.empty() || !Size) { return false; }
+				const std::string Native = NativeName(Name);
+#if defined(_WIN32)
+				const uint64_t Size64 = Size;
+				HANDLE Handle = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, static_cast<DWORD>(Size64 >> 32), static_cast<DWORD>(Size64), Native.c_str());
+				if (!Handle) { return false; }
+				if (GetLastError() == ERROR_ALREADY_EXISTS) {
+					CloseHandle(Handle);
+					return false;
+				}
+				void* Data = MapViewOfFile(Handle, FILE_MAP_WRITE, 0, 0, Size);
+				if (!Data) {
+					CloseHandle(Handle);
+					return false;
+				}
+				Handle_ = Handle;
+#else
+				shm_unlink(Native.c_str());
+				const int FileDescriptor = shm_open(Native.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+				if (FileDescriptor < 0) { return false; }
+				if (ftruncate(FileDescriptor, static_cast<off_t>(Size)) != 0) {
+					close(FileDescriptor);
+					shm_unlink(Native.c_str());
+					return false;
+				}
+				void* Data = mmap(nullptr, Size, PROT_READ | PROT_WRITE, MAP_SHARED, FileDescriptor, 0);
+				close(FileDescriptor);
+				if (Data == MAP_FAILED) {
+					shm_unlink(Native.c_str());
+					return false;
+				}
+#endif
+				Name_ = Native;
+				Data_ = static_cast<unsigned char*>(Data);
+				Size_ = Size;
+				IsOwner_ = true;
+				return true;
+			}
+
+			// 作成済みの共有メモリを読み取り専用で開く
+			[[nodiscard]] bool Open(const std::string& Name) {
+				Release();
+				if (Name.empty()) { return false; }
+				const std::string Native = NativeName(Name);
+#if defined(_WIN32)
+				HANDLE Handle = OpenFileMappingA(FILE_MAP_READ, FALSE, Native.c_str());
+				if (!Handle) { return false; }
+				void* Data = MapViewOfFile(Handle, FILE_MAP_READ, 0, 0, 0);
+				MEMORY_BASIC_INFORMATION Info = {};
+				if (!Data || !VirtualQuery(Data, &Info, sizeof(Info))) {
+					if (Data) { UnmapViewOfFile(Data); }
+					CloseHandle(Handle);
+					return false;
+				}
+				Handle_ = Handle;
+				const size_t Size = Info.RegionSize;
+#else
+				const int FileDescriptor = shm_open(Native.c_str(), O_RDONLY, 0);
+				if (FileDescriptor < 0) { return false; }
+				struct stat Status = {};
+				if (fstat(FileDescriptor, &Status) != 0 || Status.st_size <= 0) {
+					close(FileDescriptor);
+					return false;
+				}
+				const size_t Size = static_cast<size_t>(Status.st_size);
+				void* Data = mmap(nullptr, Size, PROT_READ, MAP_SHARED, FileDescriptor, 0);
+				close(FileDescriptor);
+				if (Data == MAP_FAILED) { return false; }
+#endif
+				Name_ = Native;
+				Data_ = static_cast<unsigned char*>(Data);
+				Size_ = Size;
+				IsOwner_ = false;
+				return true;
+			}
+		};
+
+		// スナップショットのサウンドデータへのアクセス手段(SND::SoundDataと同じ値を返す)
+		struct T_SnapshotData {
+		private:
+			const unsigned char* const kBase;
+			const unsigned char* const kDataRecord;		// nullptr の場合はダミーデータ
+			const unsigned char* const kSoundRecord;
+			const SampleKernel::T_Kernel kKernel;
+
+			// SAEで表示されるフレーム秒数の算出用定数
+			inline static constexpr double kFramesPerSecond = 60.0;
+
+			[[nodiscard]] uint16_t U16(size_t Offset) const noexcept { return DecodeEndian::UInt16LE(&kSoundRecord[Offset]); }
+			[[nodiscard]] uint32_t U32(size_t Offset) const noexcept { return DecodeEndian::UInt32LE(&kSoundRecord[Offset]); }
+			[[nodiscard]] uint64_t U64(size_t Offset) const noexcept { return DecodeEndian::UInt64LE(&kSoundRecord[Offset]); }
+
+			[[nodiscard]] static SampleKernel::T_Kernel SelectKernel(const unsigned char* const SoundRecord) noexcept {
+				if (!SoundRecord || !DecodeEndian::UInt16LE(&SoundRecord[72])) { return {}; }
+				return SampleKernel::Select(DecodeEndian::UInt16LE(&SoundRecord[72]), DecodeEndian::UInt16LE(&SoundRecord[70]), DecodeEndian::UInt16LE(&SoundRecord[66]));
+			}
+
+			[[nodiscard]] uint32_t ClampFrame(uint32_t StartFrame, uint32_t NumFrame) const noexcept {
+				if (IsDummy() || !kKernel.Decode || StartFrame >= this->NumFrame()) { return 0; }
+				return std::min(NumFrame, this->NumFrame() - StartFrame);
+			}
+
+			[[nodiscard]] const unsigned char* FramePtr(uint32_t StartFrame) const noexcept {
+				return SampleData() + size_t{ StartFrame } * Channel() * (U16(70) / 8);
+			}
+
+		public:
+			[[nodiscard]] bool IsDummy() const noexcept { return kDataRecord == nullptr; }
+			[[nodiscard]] int32_t GroupNo() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(DecodeEndian::UInt32LE(&kDataRecord[0]))); }
+			[[nodiscard]] int32_t ItemNo() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(DecodeEndian::UInt32LE(&kDataRecord[4]))); }
+			[[nodiscard]] int32_t ByteSize() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(U32(40))); }
+			[[nodiscard]] int32_t Channel() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(U16(66))); }
+			[[nodiscard]] int32_t Hz() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(U32(44))); }
+			[[nodiscard]] int32_t Bit() const noexcept { return (IsDummy() ? 0 : static_cast<int32_t>(U16(68))); }
+			[[nodiscard]] uint16_t FormatTag() const noexcept { return (IsDummy() ? 0 : U16(64)); }
+			[[nodiscard]] double SampleRate() const noexcept {
+				if (IsDummy()) { return 0; }
+				const uint64_t Bits = U64(24);
+				double Second = 0.0;
+				std::memcpy(&Second, &Bits, sizeof(Second));
+				return Second;
+			}
+			[[nodiscard]] double SampleFrame() const noexcept { return (IsDummy() ? 0 : SampleRate() * kFramesPerSecond); }
+			[[nodiscard]] uint32_t NumFrame() const noexcept { return (IsDummy() ? 0 : U32(48)); }
+			[[nodiscard]] uint32_t SampleLength() const noexcept { return (IsDummy() ? 0 : U32(52)); }
+			[[nodiscard]] double Duration() const noexcept { return (IsDummy() || !Hz() ? 0 : double(SampleLength()) / Hz()); }
+			[[nodiscard]] ksize_t PayloadSize() const noexcept { return (IsDummy() ? 0 : U32(32)); }
+			[[nodiscard]] uint64_t ContentHash() const noexcept { return (IsDummy() ? 0 : U64(16)); }
+
+			// WAVEデータ全体とサンプルデータ(ADPCMは展開後のPCM)
+			[[nodiscard]] const unsigned char* Payload() const noexcept { return (IsDummy() ? ReadSndFileFormat::kDummyBinaryData : kBase + U64(0)); }
+			[[nodiscard]] const unsigned char* SampleData() const noexcept { return (IsDummy() || !U32(36) ? ReadSndFileFormat::kDummyBinaryData : kBase + U64(8)); }
+			[[nodiscard]] size_t SampleDataSize() const noexcept { return (IsDummy() ? 0 : U32(36)); }
+
+			[[nodiscard]] const unsigned char* Comment() const noexcept { return (IsDummy() || !U32(56) ? ReadSndFileFormat::kDummyBinaryData : Payload() + U32(56)); }
+			[[nodiscard]] std::string_view CommentView() const noexcept { return (IsDummy() || !U32(56) ? ReadSndFileFormat::kDummyStringView : std::string_view(reinterpret_cast<const char*>(Comment()), U32(60))); }
+			[[nodiscard]] std::string CommentUTF8() const { return TextEncoding::CP932ToUTF8(CommentView()); }
+
+			uint32_t DecodeSamples(float* const Dst, uint32_t StartFrame, uint32_t NumFrame) const noexcept {
+				const uint32_t NumDecode = ClampFrame(StartFrame, NumFrame);
+				if (!NumDecode) { return 0; }
+				kKernel.Decode(FramePtr(StartFrame), NumDecode, static_cast<uint16_t>(Channel()), Dst);
+				return NumDecode;
+			}
+
+			uint32_t MixSamples(float* const Dst, uint32_t StartFrame, uint32_t NumFrame, float GainL, float GainR) const noexcept {
+				const uint32_t NumMix = ClampFrame(StartFrame, NumFrame);
+				if (!NumMix) { return 0; }
+				kKernel.Mix(FramePtr(StartFrame), NumMix, static_cast<uint16_t>(Channel()), GainL, GainR, Dst);
+				return NumMix;
+			}
+
+			T_SnapshotData(const unsigned char* const Base, const unsigned char* const DataRecord, const unsigned char* const SoundRecord) noexcept
+				: kBase(Base), kDataRecord(DataRecord), kSoundRecord(SoundRecord), kKernel(SelectKernel(SoundRecord)) {
+			}
+		};
+
+		// 読み込み済みSNDのスナップショット(作成と読み取り専用の参照)
+		struct T_SNDSnapshot {
+		private:
+			struct T_Layout {
+				uint32_t NumberCapacity = 0;
+				uint32_t GroupCapacity = 0;
+				uint64_t DataListOffset = 0;
+				uint64_t SoundListOffset = 0;
+				uint64_t NumberIndexOffset = 0;
+				uint64_t GroupIndexOffset = 0;
+				uint64_t FileNameOffset = 0;
+				uint64_t PayloadOffset = 0;
+				std::vector<uint64_t> SoundOffset = {};		// SoundListごとのWAVEデータの開始位置
+				std::vector<uint64_t> DecodedOffset = {};	// SoundListごとの展開済みPCMの開始位置(無い場合は 0)
+				uint64_t TotalSize = 0;
+			};
+
+			const unsigned char* Data_ = nullptr;
+			size_t Size_ = 0;
+			std::shared_ptr<const T_SharedMemory> SharedMemory_ = nullptr; // OpenShared で開いた場合のみ保持
+
+			[[nodiscard]] static uint64_t AlignUp(uint64_t value) noexcept {
+				return (value + SnapshotFormat::kAlign - 1) / SnapshotFormat::kAlign * SnapshotFormat::kAlign;
+			}
+
+			[[nodiscard]] static uint64_t SlotHash(uint64_t value) noexcept {
+				value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+				value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+				return value ^ (value >> 31);
+			}
+
+			// 負荷率が 1/2 以下になる2の累乗の容量
+			[[nodiscard]] static uint32_t IndexCapacity(size_t Size) noexcept {
+				uint32_t Capacity = static_cast<uint32_t>(SnapshotFormat::kMinIndexCapacity);
+				while (Capacity / 2 < Size) { Capacity *= 2; }
+				return Capacity;
+			}
+
+			[[nodiscard]] static T_Layout BuildLayout(const T_SNDData& SNDData) {
+				const T_SNDBinaryData& SNDBinaryData = *SNDData.SNDBinaryData;
+				T_Layout Layout;
+				Layout.NumberCapacity = IndexCapacity(SNDData.SoundNumberUMap.size());
+				Layout.GroupCapacity = IndexCapacity(SNDData.SoundGroupNoUMap.size());
+
+				uint64_t Offset = SnapshotFormat::kHeaderSize;
+				Layout.DataListOffset = AlignUp(Offset);
+				Offset = Layout.DataListOffset + SNDBinaryData.DataList().size() * SnapshotFormat::kDataListSize;
+				Layout.SoundListOffset = AlignUp(Offset);
+				Offset = Layout.SoundListOffset + uint64_t{ SNDBinaryData.NumSound() } * SnapshotFormat::kSoundListSize;
+				Layout.NumberIndexOffset = AlignUp(Offset);
+				Offset = Layout.NumberIndexOffset + uint64_t{ Layout.NumberCapacity } * SnapshotFormat::kIndexSlotSize;
+				Layout.GroupIndexOffset = AlignUp(Offset);
+				Offset = Layout.GroupIndexOffset + uint64_t{ Layout.GroupCapacity } * SnapshotFormat::kIndexSlotSize;
+				Layout.FileNameOffset = AlignUp(Offset);
+				Offset = Layout.FileNameOffset + SNDData.FileName().size();
+				Layout.PayloadOffset = AlignUp(Offset);
+				Offset = Layout.PayloadOffset;
+
+				Layout.SoundOffset.resize(SNDBinaryData.NumSound());
+				Layout.DecodedOffset.resize(SNDBinaryData.NumSound());
+				for (ksize_t index = 0; index < SNDBinaryData.NumSound(); ++index) {
+					const auto& SoundList = SNDBinaryData.SoundList(index);
+					Layout.SoundOffset[index] = AlignUp(Offset);
+					Offset = Layout.SoundOffset[index] + SoundList.SoundSize();
+					if (SoundList.DecodedSize()) {
+						Layout.DecodedOffset[index] = AlignUp(Offset);
+						Offset = Layout.DecodedOffset[index] + SoundList.DecodedSize();
+					}
+				}
+				Layout.TotalSize = Offset;
+				return Layout;
+			}
+
+			static void WriteIndexSlot(unsigned char* const IndexData, uint32_t Capacity, uint64_t Key, uint32_t Value) noexcept {
+				const uint64_t Mask = Capacity - 1;
+				for (uint64_t index = SlotHash(Key) & Mask;; index = (index + 1) & Mask) {
+					unsigned char* const Slot = &IndexData[index * SnapshotFormat::kIndexSlotSize];
+					if (DecodeEndian::UInt32LE(&Slot[8]) == KSIZE_MAX) {
+						EncodeEndian::UInt64LE(&Slot[0], Key);
+						EncodeEndian::UInt32LE(&Slot[8], Value);
+						return;
+					}
+					if (DecodeEndian::UInt64LE(&Slot[0]) == Key) { return; }
+				}
+			}
+
+			static void Write(const T_SNDData& SNDData, const T_Layout& Layout, unsigned char* const Dst) {
+				const T_SNDBinaryData& SNDBinaryData = *SNDData.SNDBinaryData;
+				std::memset(Dst, 0, static_cast<size_t>(Layout.PayloadOffset));
+
+				std::memcpy(Dst, SnapshotFormat::kSignature.data(), SnapshotFormat::kSignature.size());
+				EncodeEndian::UInt32LE(&Dst[16], SnapshotFormat::kVersion);
+				EncodeEndian::UInt32LE(&Dst[20], static_cast<uint32_t>(SNDData.NumGroup()));
+				EncodeEndian::UInt32LE(&Dst[24], static_cast<uint32_t>(SNDData.NumItem()));
+				EncodeEndian::UInt32LE(&Dst[28], static_cast<uint32_t>(SNDBinaryData.DataList().size()));
+				EncodeEndian::UInt32LE(&Dst[32], SNDBinaryData.NumSound());
+				EncodeEndian::UInt32LE(&Dst[36], Layout.NumberCapacity);
+				EncodeEndian::UInt32LE(&Dst[40], Layout.GroupCapacity);
+				EncodeEndian::UInt32LE(&Dst[44], static_cast<uint32_t>(SNDData.FileName().size()));
+				EncodeEndian::UInt64LE(&Dst[48], SNDData.ContentHash());
+				EncodeEndian::UInt64LE(&Dst[56], Layout.TotalSize);
+				EncodeEndian::UInt64LE(&Dst[64], Layout.DataListOffset);
+				EncodeEndian::UInt64LE(&Dst[72], Layout.SoundListOffset);
+				EncodeEndian::UInt64LE(&Dst[80], Layout.NumberIndexOffset);
+				EncodeEndian::UInt64LE(&Dst[88], Layout.GroupIndexOffset);
+				EncodeEndian::UInt64LE(&Dst[96], Layout.FileNameOffset);
+				EncodeEndian::UInt64LE(&Dst[104], Layout.PayloadOffset);
+
+				for (size_t index = 0; index < SNDBinaryData.DataList().size(); ++index) {
+					const auto& DataList = SNDBinaryData.DataList(static_cast<ksize_t>(index));
+					unsigned char* const Record = &Dst[Layout.DataListOffset + index * SnapshotFormat::kDataListSize];
+					EncodeEndian::UInt32LE(&Record[0], static_cast<uint32_t>(DataList.GroupNo()));
+					EncodeEndian::UInt32LE(&Record[4], static_cast<uint32_t>(DataList.ItemNo()));
+					EncodeEndian::UInt32LE(&Record[8], DataList.SoundListIndex());
+				}
+
+				for (ksize_t index = 0; index < SNDBinaryData.NumSound(); ++index) {
+					const auto& SoundList = SNDBinaryData.SoundList(index);
+					const auto& WAVEBinary = SoundList.WAVEBinary();
+					const auto& SampleFormat = SoundList.SampleFormat();
+					unsigned char* const Record = &Dst[Layout.SoundListOffset + uint64_t{ index } * SnapshotFormat::kSoundListSize];
+
+					const uint64_t SampleDataOffset = (SoundList.DecodedSize() ? Layout.DecodedOffset[index]
+						: (WAVEBinary.ExistdataChunk() ? Layout.SoundOffset[index] + (WAVEBinary.dataChunk().Data() - WAVEBinary.SoundBinary()) : 0));
+					const ksize_t SampleDataSize = (SoundList.DecodedSize() ? static_cast<ksize_t>(SoundList.DecodedSize()) : WAVEBinary.dataSize());
+					const std::string_view Comment = WAVEBinary.CommentView();
+					const ksize_t CommentOffset = (WAVEBinary.SAECChunk().IsDummy() ? 0 : static_cast<ksize_t>(WAVEBinary.SAECChunk().Comment() - WAVEBinary.SoundBinary()));
+					const uint16_t FrameBits = static_cast<uint16_t>(SampleFormat.Channels() ? SampleFormat.BytesPerFrame() / SampleFormat.Channels() * 8 : 0);
+					const uint16_t KernelTag = (!SampleFormat.IsSupported() ? 0 : (SampleFormat.IsADPCM() ? WAVEFormatTag::kPCM : SampleFormat.FormatTag()));
+					uint64_t SAESecond = 0;
+					const double Second = SampleFormat.SAESecond();
+					std::memcpy(&SAESecond, &Second, sizeof(SAESecond));
+
+					EncodeEndian::UInt64LE(&Record[0], Layout.SoundOffset[index]);
+					EncodeEndian::UInt64LE(&Record[8], SampleDataOffset);
+					EncodeEndian::UInt64LE(&Record[16], SoundList.SoundHash());
+					EncodeEndian::UInt64LE(&Record[24], SAESecond);
+					EncodeEndian::UInt32LE(&Record[32], SoundList.SoundSize());
+					EncodeEndian::UInt32LE(&Record[36], SampleDataSize);
+					EncodeEndian::UInt32LE(&Record[40], WAVEBinary.dataChunk().ChunkSize());
+					EncodeEndian::UInt32LE(&Record[44], SampleFormat.SamplesPerSec());
+					EncodeEndian::UInt32LE(&Record[48], SampleFormat.NumFrame());
+					EncodeEndian::UInt32LE(&Record[52], SampleFormat.SampleLength());
+					EncodeEndian::UInt32LE(&Record[56], CommentOffset);
+					EncodeEndian::UInt32LE(&Record[60], static_cast<uint32_t>(Comment.size()));
+					EncodeEndian::UInt16LE(&Record[64], SampleFormat.FormatTag());
+					EncodeEndian::UInt16LE(&Record[66], SampleFormat.Channels());
+					EncodeEndian::UInt16LE(&Record[68], SampleFormat.BitsPerSample());
+					EncodeEndian::UInt16LE(&Record[70], FrameBits);
+					EncodeEndian::UInt16LE(&Record[72], KernelTag);
+
+					std::memcpy(&Dst[Layout.SoundOffset[index]], WAVEBinary.SoundBinary(), SoundList.SoundSize());
+					if (SoundList.DecodedSize()) {
+						std::memcpy(&Dst[Layout.DecodedOffset[index]], SoundList.SampleData(), SoundList.DecodedSize());
+					}
+				}
+
+				// 索引は読み込み時と同じ値(重複した番号は最初に登録されたデータ)を保持する
+				unsigned char* const NumberIndex = &Dst[Layout.NumberIndexOffset];
+				unsigned char* const GroupIndex = &Dst[Layout.GroupIndexOffset];
+				std::memset(NumberIndex, 0xff, size_t{ Layout.NumberCapacity } * SnapshotFormat::kIndexSlotSize);
+				std::memset(GroupIndex, 0xff, size_t{ Layout.GroupCapacity } * SnapshotFormat::kIndexSlotSize);
+				for (const auto& DataList : SNDBinaryData.DataList()) {
+					const int32_t DataListIndex = SNDData.SoundNumberUMap.find(DataList.GroupNo(), DataList.ItemNo());
+					if (DataListIndex >= 0) {
+						WriteIndexSlot(NumberIndex, Layout.NumberCapacity, static_cast<uint64_t>(Convert::EncodeSoundNumber(DataList.GroupNo(), DataList.ItemNo())), static_cast<uint32_t>(DataListIndex));
+					}
+					const int32_t GroupIndexValue = SNDData.SoundGroupNoUMap.find(DataList.GroupNo());
+					if (GroupIndexValue >= 0) {
+						WriteIndexSlot(GroupIndex, Layout.GroupCapacity, static_cast<uint32_t>(DataList.GroupNo()), static_cast<uint32_t>(GroupIndexValue));
+					}
+				}
+
+				std::memcpy(&Dst[Layout.FileNameOffset], SNDData.FileName().data(), SNDData.FileName().size());
+			}
+
+			[[nodiscard]] uint32_t Header32(size_t Offset) const noexcept { return DecodeEndian::UInt32LE(&Data_[Offset]); }
+			[[nodiscard]] uint64_t Header64(size_t Offset) const noexcept { return DecodeEndian::UInt64LE(&Data_[Offset]); }
+			[[nodiscard]] ksize_t NumData() const noexcept { return (empty() ? 0 : Header32(28)); }
+			[[nodiscard]] ksize_t NumSoundList() const noexcept { return (empty() ? 0 : Header32(32)); }
+			[[nodiscard]] const unsigned char* DataRecord(ksize_t index) const noexcept { return &Data_[Header64(64) + uint64_t{ index } * SnapshotFormat::kDataListSize]; }
+			[[nodiscard]] const unsigned char* SoundRecord(ksize_t index) const noexcept { return &Data_[Header64(72) + uint64_t{ index } * SnapshotFormat::kSoundListSize]; }
+
+			[[nodiscard]] ksize_t FindIndexSlot(uint64_t IndexOffset, uint32_t Capacity, uint64_t Key) const noexcept {
+				const uint64_t Mask = Capacity - 1;
+				for (uint64_t index = SlotHash(Key) & Mask;; index = (index + 1) & Mask) {
+					const unsigned char* const Slot = &Data_[IndexOffset + index * SnapshotFormat::kIndexSlotSize];
+					const ksize_t Value = DecodeEndian::UInt32LE(&Slot[8]);
+					if (Value == KSIZE_MAX || DecodeEndian::UInt64LE(&Slot[0]) == Key) { return Value; }
+				}
+			}
+
+			[[nodiscard]] static bool InRange(uint64_t Offset, uint64_t Size, uint64_t Limit) noexcept {
+				return Offset <= Limit && Size <= Limit - Offset;
+			}
+
+			// 索引は空きを含み、値がDataList(もしくはグループ数)の範囲内であること
+			[[nodiscard]] static bool CheckIndex(const unsigned char* const IndexData, uint32_t Capacity, uint32_t Limit) noexcept {
+				bool HasEmpty = false;
+				for (uint32_t index = 0; index < Capacity; ++index) {
+					const uint32_t Value = DecodeEndian::UInt32LE(&IndexData[size_t{ index } * SnapshotFormat::kIndexSlotSize + 8]);
+					if (Value == KSIZE_MAX) { HasEmpty = true; }
+					else if (Value >= Limit) { return false; }
+				}
+				return HasEmpty;
+			}
+
+			// 別プロセスが作成したデータを参照するため、各セクションとサウンドデータが範囲内に収まるかだけを確認する
+			[[nodiscard]] static bool CheckSnapshot(const unsigned char* const Data, size_t Size) noexcept {
+				if (!Data || Size < SnapshotFormat::kHeaderSize) { return false; }
+				if (std::memcmp(Data, SnapshotFormat::kSignature.data(), SnapshotFormat::kSignature.size()) != 0) { return false; }
+				if (DecodeEndian::UInt32LE(&Data[16]) != SnapshotFormat::kVersion) { return false; }
+				const uint64_t TotalSize = DecodeEndian::UInt64LE(&Data[56]);
+				if (TotalSize > Size) { return false; }
+
+				const uint32_t NumGroup = DecodeEndian::UInt32LE(&Data[20]);
+				const uint32_t NumData = DecodeEndian::UInt32LE(&Data[28]);
+				const uint32_t NumSound = DecodeEndian::UInt32LE(&Data[32]);
+				const uint32_t NumberCapacity = DecodeEndian::UInt32LE(&Data[36]);
+				const uint32_t GroupCapacity = DecodeEndian::UInt32LE(&Data[40]);
+				const auto IsPow2 = [](uint32_t value) { return value && !(value & (value - 1)); };
+				if (!IsPow2(NumberCapacity) || !IsPow2(GroupCapacity)) { return false; }
+				if (!InRange(DecodeEndian::UInt64LE(&Data[64]), uint64_t{ NumData } * SnapshotFormat::kDataListSize, TotalSize)
+					|| !InRange(DecodeEndian::UInt64LE(&Data[72]), uint64_t{ NumSound } * SnapshotFormat::kSoundListSize, TotalSize)
+					|| !InRange(DecodeEndian::UInt64LE(&Data[80]), uint64_t{ NumberCapacity } * SnapshotFormat::kIndexSlotSize, TotalSize)
+					|| !InRange(DecodeEndian::UInt64LE(&Data[88]), uint64_t{ GroupCapacity } * SnapshotFormat::kIndexSlotSize, TotalSize)
+					|| !InRange(DecodeEndian::UInt64LE(&Data[96]), DecodeEndian::UInt32LE(&Data[44]), TotalSize)) {
+					return false;
+				}
+
+				for (uint32_t index = 0; index < NumData; ++index) {
+					if (DecodeEndian::UInt32LE(&Data[DecodeEndian::UInt64LE(&Data[64]) + uint64_t{ index } * SnapshotFormat::kDataListSize + 8]) >= NumSound) { return false; }
+				}
+				for (uint32_t index = 0; index < NumSound; ++index) {
+					const unsigned char* const Record = &Data[DecodeEndian::UInt64LE(&Data[72]) + uint64_t{ index } * SnapshotFormat::kSoundListSize];
+					const uint32_t PayloadSize = DecodeEndian::UInt32LE(&Record[32]);
+					if (!InRange(DecodeEndian::UInt64LE(&Record[0]), PayloadSize, TotalSize)
+						|| !InRange(DecodeEndian::UInt64LE(&Record[8]), DecodeEndian::UInt32LE(&Record[36]), TotalSize)
+						|| uint64_t{ DecodeEndian::UInt32LE(&Record[56]) } + DecodeEndian::UInt32LE(&Record[60]) > PayloadSize) {
+						return false;
+					}
+					// 変換処理が読み取る範囲がサンプルデータに収まること
+					const uint64_t BytesPerFrame = uint64_t{ DecodeEndian::UInt16LE(&Record[66]) } * (DecodeEndian::UInt16LE(&Record[70]) / 8);
+					if (DecodeEndian::UInt16LE(&Record[72]) && uint64_t{ DecodeEndian::UInt32LE(&Record[48]) } * BytesPerFrame > DecodeEndian::UInt32LE(&Record[36])) { return false; }
+				}
+				return CheckIndex(&Data[DecodeEndian::UInt64LE(&Data[80])], NumberCapacity, NumData)
+					&& CheckIndex(&Data[DecodeEndian::UInt64LE(&Data[88])], GroupCapacity, NumGroup);
+			}
+
+		public:
+			using SoundData = T_SnapshotData;
+			using SharedMemory = T_SharedMemory;
+
+			T_SNDSnapshot() = default;
+
+			/**
+			* @brief スナップショットの作成
+			*
+			* 　読み込み済みSNDのDataList、SoundList、サウンド番号とグループ番号の索引、サウンドデータを1つのバイナリにまとめます
+			*
+			* 　ADPCMを展開済みの場合は展開後のPCMも含めるため、参照側で変換は行いません
+			*
+			* @param const SND& SNDData 読み込み済みのSND
+			* @return std::vector<unsigned char> スナップショット
+			*/
+			[[nodiscard]] static std::vector<unsigned char> Serialize(const T_SNDData& SNDData) {
+				const T_Layout Layout = BuildLayout(SNDData);
+				std::vector<unsigned char> Snapshot(static_cast<size_t>(Layout.TotalSize));
+				Write(SNDData, Layout, Snapshot.data());
+				return Snapshot;
+			}
+
+			/**
+			* @brief スナップショットを共有メモリへ作成
+			*
+			* 　名前付き共有メモリを作成し、スナップショットを直接書き込みます
+			*
+			* 　戻り値のSharedMemoryを破棄すると他のプロセスから新しく開くことはできなくなります(開いているプロセスは引き続き参照できます)
+			*
+			* @param const SND& SNDData 読み込み済みのSND
+			* @param const std::string& Name 共有メモリ名
+			* @return SharedMemory 共有メモリ (失敗した場合は空)
+			*/
+			[[nodiscard]] static T_SharedMemory Share(const T_SNDData& SNDData, const std::string& Name) {
+				const T_Layout Layout = BuildLayout(SNDData);
+				T_SharedMemory SharedMemory;
+				if (!SharedMemory.Create(Name, static_cast<size_t>(Layout.TotalSize))) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateSharedMemory);
+					return SharedMemory;
+				}
+				Write(SNDData, Layout, SharedMemory.WritableData());
+				return SharedMemory;
+			}
+
+			/**
+			* @brief スナップショットの参照
+			*
+			* 　指定したアドレスのスナップショットを複製せずに参照します(参照中はデータを解放しないでください)
+			*
+			* @param const void* Data スナップショットの先頭
+			* @param size_t Size データサイズ
+			* @return bool 参照結果 (false = 形式が正しくない：true = 成功)
+			*/
+			bool Attach(const void* Data, size_t Size) {
+				clear();
+				if (!CheckSnapshot(static_cast<const unsigned char*>(Data), Size)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSnapshot);
+					return false;
+				}
+				Data_ = static_cast<const unsigned char*>(Data);
+				Size_ = static_cast<size_t>(DecodeEndian::UInt64LE(&Data_[56]));
+				return true;
+			}
+
+			/**
+			* @brief 共有メモリのスナップショットを参照
+			*
+			* 　Share関数で作成された共有メモリを読み取り専用で開いて参照します
+			*
+			* @param const std::string& Name 共有メモリ名
+			* @return bool 参照結果 (false = 失敗：true = 成功)
+			*/
+			bool OpenShared(const std::string& Name) {
+				clear();
+				auto SharedMemory = std::make_shared<T_SharedMemory>();
+				if (!SharedMemory->Open(Name)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_OpenSharedMemory);
+					return false;
+				}
+				if (!Attach(SharedMemory->Data(), SharedMemory->size())) { return false; }
+				SharedMemory_ = std::move(SharedMemory);
+				return true;
+			}
+
+			void clear() noexcept {
+				Data_ = nullptr;
+				Size_ = 0;
+				SharedMemory_.reset();
+			}
+
+			[[nodiscard]] bool empty() const noexcept { return Data_ == nullptr; }
+			[[nodiscard]] size_t size() const noexcept { return Size_; }
+			[[nodiscard]] const unsigned char* data() const noexcept { return Data_; }
+
+			[[nodiscard]] int32_t NumGroup() const noexcept { return (empty() ? 0 : static_cast<int32_t>(Header32(20))); }
+			[[nodiscard]] int32_t NumItem() const noexcept { return (empty() ? 0 : static_cast<int32_t>(Header32(24))); }
+			[[nodiscard]] uint64_t ContentHash() const noexcept { return (empty() ? 0 : Header64(48)); }
+			[[nodiscard]] std::string_view FileName() const noexcept {
+				return (empty() ? ReadSndFileFormat::kDummyStringView : std::string_view(reinterpret_cast<const char*>(&Data_[Header64(96)]), Header32(44)));
+			}
+
+			[[nodiscard]] bool ExistSoundNumber(int32_t GroupNo, int32_t ItemNo) const noexcept {
+				return !empty() && FindIndexSlot(Header64(80), Header32(36), static_cast<uint64_t>(Convert::EncodeSoundNumber(GroupNo, ItemNo))) != KSIZE_MAX;
+			}
+
+			[[nodiscard]] bool ExistGroupNo(int32_t GroupNo) const noexcept {
+				return !empty() && FindIndexSlot(Header64(88), Header32(40), static_cast<uint32_t>(GroupNo)) != KSIZE_MAX;
+			}
+
+			[[nodiscard]] bool ExistSoundDataIndex(int32_t index) const noexcept {
+				return index >= 0 && static_cast<ksize_t>(index) < NumData();
+			}
+
+			[[nodiscard]] SoundData FindSoundData(int64_t SoundNumber) const {
+				const ksize_t DataListIndex = (empty() ? KSIZE_MAX : FindIndexSlot(Header64(80), Header32(36), static_cast<uint64_t>(SoundNumber)));
+				if (DataListIndex != KSIZE_MAX) { return GetSoundDataIndex(static_cast<int32_t>(DataListIndex)); }
+				if (!T_Config::Instance().ThrowError()) {
+					return SoundData(Data_, nullptr, nullptr);
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundNumber, Convert::DecodeSoundGroupNo(SoundNumber), Convert::DecodeSoundItemNo(SoundNumber));
+			}
+
+			[[nodiscard]] SoundData GetSoundData(int32_t GroupNo, int32_t ItemNo) const {
+				return FindSoundData(Convert::EncodeSoundNumber(GroupNo, ItemNo));
+			}
+
+			[[nodiscard]] SoundData GetSoundDataIndex(int32_t index) const {
+				if (ExistSoundDataIndex(index)) {
+					const unsigned char* const Record = DataRecord(static_cast<ksize_t>(index));
+					return SoundData(Data_, Record, SoundRecord(DecodeEndian::UInt32LE(&Record[8])));
+				}
+				if (!T_Config::Instance().ThrowError()) {
+					return SoundData(Data_, nullptr, nullptr);
+				}
+				T_ErrorHandle::Instance().ThrowError(ErrorMessage::NotFound_SoundIndex, index);
+			}
+		};
+
+		// SoundDataを再生するソフトウェアミキサー
+		struct T_SoundMixer {
+		public:
+			using SoundData = T_SNDData::SoundData;
+			using VoiceID = uint32_t;
+			inline static constexpr VoiceID kInvalidVoice = 0;
+			inline static constexpr ksize_t kMaxVoice = 0xffff;
+			inline static constexpr float kMinPitch = 1.0f / 16.0f;
+			inline static constexpr float kMaxPitch = 16.0f;
+
+		private:
+			// リサンプル時の変換バッファ(float数)
+			inline static constexpr uint32_t kScratchSize = 4096;
+			// 補間する2フレームとループ先頭の1フレームが変換バッファに収まるチャンネル数
+			inline static constexpr uint32_t kMaxChannel = kScratchSize / 3;
+			inline static constexpr int32_t kVoiceIndexBit = 16;
+
+			struct T_Voice {
+				std::optional<SoundData> Sound = std::nullopt;
+				int64_t SoundNumber = 0;
+				double Position = 0.0;
+				double Step = 1.0;
+				uint32_t NumFrame = 0;
+				uint32_t LoopStart = 0;	// ループ区間(smplチャンクが無い場合は全体)
+				uint32_t LoopEnd = 0;	// ループ区間の終端(このフレームを含まない)
+				uint32_t Channels = 0;
+				uint32_t Hz = 0;
+				uint64_t StartOrder = 0;
+				int32_t Priority = 0;
+				float Volume = 1.0f;
+				float Pan = 0.0f;
+				float Pitch = 1.0f;
+				uint16_t Generation = 0;
+				bool Loop = false;
+				bool Active = false;
+			};
+
+			std::vector<T_Voice> VoiceList_;
+			std::vector<float> Scratch_;
+			const uint32_t kSampleRate;
+			uint64_t StartCounter_ = 0;
+			float MasterVolume_ = 1.0f;
+
+			[[nodiscard]] T_Voice* FindVoice(VoiceID ID) noexcept {
+				const ksize_t index = ID & kMaxVoice;
+				if (index >= VoiceList_.size()) { return nullptr; }
+				T_Voice& Voice = VoiceList_[index];
+				return (Voice.Active && Voice.Generation == (ID >> kVoiceIndexBit) ? &Voice : nullptr);
+			}
+			[[nodiscard]] const T_Voice* FindVoice(VoiceID ID) const noexcept { return const_cast<T_SoundMixer*>(this)->FindVoice(ID); }
+
+			// 空きボイスが無い場合は優先度が最も低く、最も古いボイスを奪う
+			[[nodiscard]] ksize_t SelectVoice(int32_t Priority) const noexcept {
+				ksize_t Select = KSIZE_MAX;
+				for (ksize_t index = 0; index < VoiceList_.size(); ++index) {
+					const T_Voice& Voice = VoiceList_[index];
+					if (!Voice.Active) { return index; }
+					if (Voice.Priority > Priority) { continue; }
+					if (Select == KSIZE_MAX
+						|| Voice.Priority < VoiceList_[Select].Priority
+						|| (Voice.Priority == VoiceList_[Select].Priority && Voice.StartOrder < VoiceList_[Select].StartOrder)) {
+						Select = index;
+					}
+				}
+				return Select;
+			}
+
+			template<typename Func>
+			void ForEachSound(int32_t GroupNo, int32_t ItemNo, Func&& func) noexcept {
+				const int64_t SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				for (auto& Voice : VoiceList_) {
+					if (Voice.Active && Voice.SoundNumber == SoundNumber) { func(Voice); }
+				}
+			}
+
+			void UpdateStep(T_Voice& Voice) const noexcept {
+				Voice.Step = double{ Voice.Pitch } * Voice.Hz / kSampleRate;
+			}
+
+			// 左右の音量(パンは -1.0 = 左 ～ 1.0 = 右 のバランスとして扱う)
+			[[nodiscard]] float GainL(const T_Voice& Voice) const noexcept { return Voice.Volume * MasterVolume_ * std::min(1.0f, 1.0f - Voice.Pan); }
+			[[nodiscard]] float GainR(const T_Voice& Voice) const noexcept { return Voice.Volume * MasterVolume_ * std::min(1.0f, 1.0f + Voice.Pan); }
+
+			// 変換バッファの1フレームを左右のサンプルとして取得
+			[[nodiscard]] std::pair<float, float> ScratchFrame(uint32_t Frame, uint32_t Channels) const noexcept {
+				const float* const Src = &Scratch_[size_t{ Frame } * Channels];
+				if (Channels == 1) { return { Src[0], Src[0] }; }
+				if (Channels == 2) { return { Src[0], Src[1] }; }
+				float sample = 0.0f;
+				for (uint32_t Channel = 0; Channel < Channels; ++Channel) { sample += Src[Channel]; }
+				sample /= Channels;
+				return { sample, sample };
+			}
+
+			// 再生範囲の終端(ループ中はループ区間を過ぎるまでループ区間の終端)
+			[[nodiscard]] static uint32_t EndFrame(const T_Voice& Voice) noexcept {
+				return (Voice.Loop && Voice.Position < Voice.LoopEnd ? Voice.LoopEnd : Voice.NumFrame);
+			}
+
+			// 終端に達した場合はループ区間の先頭へ戻す(ループしない場合は false)
+			[[nodiscard]] static bool WrapPosition(T_Voice& Voice, uint32_t End) noexcept {
+				if (!Voice.Loop) { return false; }
+				Voice.Position = Voice.LoopStart + std::fmod(Voice.Position - End, static_cast<double>(Voice.LoopEnd - Voice.LoopStart));
+				return true;
+			}
+
+			// 変換バッファへ読み込んだ範囲で線形補間しながら加算する(ループする場合は終端の次のサンプルをループ区間の先頭として補間する)
+			[[nodiscard]] uint32_t Resample(T_Voice& Voice, float* const Dst, uint32_t NumFrame, uint32_t End, float GainL, float GainR) noexcept {
+				const uint32_t Start = static_cast<uint32_t>(Voice.Position);
+				const double NumNeed = (Voice.Position - Start) + Voice.Step * NumFrame + 2.0;
+				const uint32_t NumScratch = std::min(kScratchSize / Voice.Channels - 1, End - Start);
+				const uint32_t NumDecode = Voice.Sound->DecodeSamples(Scratch_.data(), Start, (NumNeed < NumScratch ? static_cast<uint32_t>(NumNeed) : NumScratch));
+				const bool IsTail = Start + NumDecode >= End;
+				const bool IsWrap = IsTail && Voice.Loop && Voice.Sound->DecodeSamples(&Scratch_[size_t{ NumDecode } * Voice.Channels], Voice.LoopStart, 1);
+				uint32_t Done = 0;
+				for (; Done < NumFrame; ++Done) {
+					const double Local = Voice.Position - Start;
+					const uint32_t Index = static_cast<uint32_t>(Local);
+					if (Index >= NumDecode || (Index + 1 == NumDecode && !IsTail)) { break; }
+					const auto [L0, R0] = ScratchFrame(Index, Voice.Channels);
+					const auto [L1, R1] = ScratchFrame((IsWrap ? Index + 1 : std::min(Index + 1, NumDecode - 1)), Voice.Channels);
+					const float Frac = static_cast<float>(Local - Index);
+					Dst[size_t{ Done } * 2] += (L0 + (L1 - L0) * Frac) * GainL;
+					Dst[size_t{ Done } * 2 + 1] += (R0 + (R1 - R0) * Frac) * GainR;
+					Voice.Position += Voice.Step;
+				}
+				return Done;
+			}
+
+			void RenderVoice(T_Voice& Voice, float* const Dst, uint32_t NumFrame) noexcept {
+				const float L = GainL(Voice);
+				const float R = GainR(Voice);
+				uint32_t Done = 0;
+				while (Done < NumFrame) {
+					const uint32_t End = EndFrame(Voice);
+					uint32_t NumRender = 0;
+					if (Voice.Step == 1.0 && Voice.Position == std::floor(Voice.Position)) {
+						// 等倍再生はサウンドデータから直接加算する
+						const uint32_t Position = static_cast<uint32_t>(Voice.Position);
+						NumRender = Voice.Sound->MixSamples(&Dst[size_t{ Done } * 2], Position, std::min(NumFrame - Done, End - Position), L, R);
+						Voice.Position += NumRender;
+					}
+					else {
+						NumRender = Resample(Voice, &Dst[size_t{ Done } * 2], NumFrame - Done, End, L, R);
+					}
+					Done += NumRender;
+					// 終端に達していないのに進まない場合(変換できない等)も停止してコールバック内で止まらないようにする
+					const bool IsEnd = (Voice.Position >= End ? !WrapPosition(Voice, End) : !NumRender);
+					if (IsEnd) {
+						Voice.Active = false;
+						Voice.Sound.reset();
+						return;
+					}
+				}
+			}
+
+		public:
+			/**
+			* @brief ボイス数の取得
+			*
+			* @return ksize_t NumVoice 同時発音数
+			*/
+			ksize_t NumVoice() const noexcept { return static_cast<ksize_t>(VoiceList_.size()); }
+
+			/**
+			* @brief 再生中のボイス数の取得
+			*
+			* @return ksize_t NumActiveVoice 再生中のボイス数
+			*/
+			ksize_t NumActiveVoice() const noexcept {
+				return static_cast<ksize_t>(std::count_if(VoiceList_.begin(), VoiceList_.end(), [](const T_Voice& Voice) { return Voice.Active; }));
+			}
+
+			/**
+			* @brief 出力サンプリング周波数の取得
+			*
+			* @return uint32_t SampleRate 出力サンプリング周波数
+			*/
+			uint32_t SampleRate() const noexcept { return kSampleRate; }
+
+			/**
+			* @brief 再生
+			*
+			* 　空いているボイスでサウンドを再生します
+			*
+			* 　空きボイスが無い場合は指定した優先度以下で最も優先度が低く、最も古いボイスを停止して使用します
+			*
+			* 　ダミーデータや変換できないフォーマット、1365チャンネルを超えるサウンド、奪えるボイスが無い場合は kInvalidVoice を返します
+			*
+			* 　ループ再生ではsmplチャンクの最初のループ区間を、無い場合はサウンド全体をサンプル単位で繰り返します
+			*
+			* @param const SoundData& Sound 再生するサウンド (再生中は読み込み元のSNDを破棄しないでください)
+			* @param float Volume 音量 (省略時は 1.0)
+			* @param float Pan パン (-1.0 = 左 ～ 1.0 = 右、省略時は 0.0)
+			* @param float Pitch ピッチ (1.0 = 等倍、省略時は 1.0)
+			* @param bool Loop ループ再生 (省略時は false)
+			* @param int32_t Priority 優先度 (大きいほど奪われにくい、省略時は 0)
+			* @return VoiceID 再生したボイスのID
+			*/
+			VoiceID Play(const SoundData& Sound, float Volume = 1.0f, float Pan = 0.0f, float Pitch = 1.0f, bool Loop = false, int32_t Priority = 0) noexcept {
+				if (!Sound.NumFrame() || !Sound.Hz() || static_cast<uint32_t>(Sound.Channel()) > kMaxChannel) { return kInvalidVoice; }
+				const ksize_t index = SelectVoice(Priority);
+				if (index == KSIZE_MAX) { return kInvalidVoice; }
+
+				T_Voice& Voice = VoiceList_[index];
+				Voice.Sound.emplace(Sound);
+				Voice.SoundNumber = Convert::EncodeSoundNumber(Sound.GroupNo(), Sound.ItemNo());
+				Voice.Position = 0.0;
+				Voice.NumFrame = Sound.NumFrame();
+				Voice.LoopStart = 0;
+				Voice.LoopEnd = Voice.NumFrame;
+				// smplチャンクの最初のループ区間がサウンドの範囲に収まる場合はその区間をループする
+				if (!Sound.LoopList().empty() && Sound.LoopList()[0].Start <= Sound.LoopList()[0].End && Sound.LoopList()[0].End < Voice.NumFrame) {
+					Voice.LoopStart = Sound.LoopList()[0].Start;
+					Voice.LoopEnd = Sound.LoopList()[0].End + 1;
+				}
+				Voice.Channels = static_cast<uint32_t>(Sound.Channel());
+				Voice.Hz = static_cast<uint32_t>(Sound.Hz());
+				Voice.StartOrder = StartCounter_++;
+				Voice.Priority = Priority;
+				Voice.Volume = Volume;
+				Voice.Pan = std::clamp(Pan, -1.0f, 1.0f);
+				Voice.Pitch = std::clamp(Pitch, kMinPitch, kMaxPitch);
+				Voice.Loop = Loop;
+				Voice.Active = true;
+				if (++Voice.Generation == 0) { Voice.Generation = 1; }
+				UpdateStep(Voice);
+				return (VoiceID{ Voice.Generation } << kVoiceIndexBit) | index;
+			}
+
+			/**
+			* @brief 停止
+			*
+			* @param VoiceID ID 停止するボイスのID
+			*/
+			void Stop(VoiceID ID) noexcept {
+				if (T_Voice* Voice = FindVoice(ID)) {
+					Voice->Active = false;
+					Voice->Sound.reset();
+				}
+			}
+
+			/**
+			* @brief 全ボイスの停止
+			*/
+			void StopAll() noexcept {
+				for (auto& Voice : VoiceList_) {
+					Voice.Active = false;
+					Voice.Sound.reset();
+				}
+			}
+
+			/**
+			* @brief 再生中の確認
+			*
+			* @param VoiceID ID 確認するボイスのID
+			* @return bool 確認結果 (false = 停止済み：true = 再生中)
+			*/
+			bool IsPlaying(VoiceID ID) const noexcept { return FindVoice(ID) != nullptr; }
+
+			/**
+			* @brief 音量の設定
+			*
+			* @param VoiceID ID 対象のボイスID
+			* @param float Volume 音量
+			*/
+			void SetVolume(VoiceID ID, float Volume) noexcept {
+				if (T_Voice* Voice = FindVoice(ID)) { Voice->Volume = Volume; }
+			}
+
+			/**
+			* @brief パンの設定
+			*
+			* @param VoiceID ID 対象のボイスID
+			* @param float Pan パン (-1.0 = 左 ～ 1.0 = 右)
+			*/
+			void SetPan(VoiceID ID, float Pan) noexcept {
+				if (T_Voice* Voice = FindVoice(ID)) { Voice->Pan = std::clamp(Pan, -1.0f, 1.0f); }
+			}
+
+			/**
+			* @brief ピッチの設定
+			*
+			* @param VoiceID ID 対象のボイスID
+			* @param float Pitch ピッチ (1.0 = 等倍、kMinPitch ～ kMaxPitch に丸められます)
+			*/
+			void SetPitch(VoiceID ID, float Pitch) noexcept {
+				if (T_Voice* Voice = FindVoice(ID)) {
+					Voice->Pitch = std::clamp(Pitch, kMinPitch, kMaxPitch);
+					UpdateStep(*Voice);
+				}
+			}
+
+			/**
+			* @brief ループ再生の設定
+			*
+			* 　ループを解除するとループ区間の後ろを再生して停止します
+			*
+			* @param VoiceID ID 対象のボイスID
+			* @param bool Loop ループ再生
+			*/
+			void SetLoop(VoiceID ID, bool Loop) noexcept {
+				if (T_Voice* Voice = FindVoice(ID)) { Voice->Loop = Loop; }
+			}
+
+			/**
+			* @brief サウンド番号を指定して停止
+			*
+			* 　指定したサウンド番号を再生している全ボイスを停止します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			*/
+			void StopSound(int32_t GroupNo, int32_t ItemNo) noexcept {
+				ForEachSound(GroupNo, ItemNo, [](T_Voice& Voice) { Voice.Active = false; Voice.Sound.reset(); });
+			}
+
+			/**
+			* @brief サウンド番号を指定して音量/パン/ピッチの設定
+			*
+			* 　指定したサウンド番号を再生している全ボイスへ設定します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @param float Value 設定値
+			*/
+			void SetSoundVolume(int32_t GroupNo, int32_t ItemNo, float Volume) noexcept {
+				ForEachSound(GroupNo, ItemNo, [Volume](T_Voice& Voice) { Voice.Volume = Volume; });
+			}
+			void SetSoundPan(int32_t GroupNo, int32_t ItemNo, float Pan) noexcept {
+				ForEachSound(GroupNo, ItemNo, [Pan = std::clamp(Pan, -1.0f, 1.0f)](T_Voice& Voice) { Voice.Pan = Pan; });
+			}
+			void SetSoundPitch(int32_t GroupNo, int32_t ItemNo, float Pitch) noexcept {
+				ForEachSound(GroupNo, ItemNo, [this, Pitch = std::clamp(Pitch, kMinPitch, kMaxPitch)](T_Voice& Voice) { Voice.Pitch = Pitch; UpdateStep(Voice); });
+			}
+
+			/**
+			* @brief 全体音量の設定
+			*
+			* @param float Volume 全体音量
+			*/
+			void SetMasterVolume(float Volume) noexcept { MasterVolume_ = Volume; }
+
+			/**
+			* @brief ミックス
+			*
+			* 　再生中の全ボイスをステレオのfloatバッファへ書き込みます
+			*
+			* 　メモリ確保とロックを行わないため、オーディオコールバックから呼び出せます
+			*
+			* 　Play等の操作と同じスレッドから呼び出してください
+			*
+			* @param float* Dst 書き込み先のステレオバッファ (NumFrame × 2 以上の長さ)
+			* @param uint32_t NumFrame 書き込むサンプルフレーム数
+			*/
+			void Render(float* const Dst, uint32_t NumFrame) noexcept {
+				std::fill(Dst, Dst + size_t{ NumFrame } * 2, 0.0f);
+				for (auto& Voice : VoiceList_) {
+					if (Voice.Active) { RenderVoice(Voice, Dst, NumFrame); }
+				}
+			}
+
+			T_SoundMixer(ksize_t NumVoice, uint32_t SampleRate = 48000)
+				: VoiceList_(std::clamp<ksize_t>(NumVoice, 1, kMaxVoice)), Scratch_(kScratchSize), kSampleRate(std::max<uint32_t>(SampleRate, 1)) {}
+		};
+
+		// 固定長のロックフリーキュー(複数スレッドから追加、1スレッドから取り出し)
+		template<typename T>
+		struct T_LockFreeQueue {
+		private:
+			struct T_Cell {
+				std::atomic<size_t> Sequence = 0;
+				T Value = {};
+			};
+
+			inline static constexpr size_t kCacheLine = 64;
+
+			std::unique_ptr<T_Cell[]> CellList_;
+			const size_t kMask;
+			alignas(kCacheLine) std::atomic<size_t> PushPos_ = 0;
+			alignas(kCacheLine) std::atomic<size_t> PopPos_ = 0;
+
+			[[nodiscard]] static size_t RoundCapacity(size_t Capacity) noexcept {
+				size_t Result = 2;
+				while (Result < Capacity) { Result <<= 1; }
+				return Result;
+			}
+
+		public:
+			[[nodiscard]] size_t capacity() const noexcept { return kMask + 1; }
+
+			// 満杯の場合は false を返す
+			[[nodiscard]] bool TryPush(const T& Value) noexcept {
+				size_t Pos = PushPos_.load(std::memory_order_relaxed);
+				for (;;) {
+					T_Cell& Cell = CellList_[Pos & kMask];
+					const size_t Sequence = Cell.Sequence.load(std::memory_order_acquire);
+					const intptr_t Diff = static_cast<intptr_t>(Sequence) - static_cast<intptr_t>(Pos);
+					if (Diff == 0) {
+						if (PushPos_.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed)) {
+							Cell.Value = Value;
+							Cell.Sequence.store(Pos + 1, std::memory_order_release);
+							return true;
+						}
+					}
+					else if (Diff < 0) {
+						return false;
+					}
+					else {
+						Pos = PushPos_.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			// 空の場合は false を返す
+			[[nodiscard]] bool TryPop(T& Value) noexcept {
+				const size_t Pos = PopPos_.load(std::memory_order_relaxed);
+				T_Cell& Cell = CellList_[Pos & kMask];
+				if (Cell.Sequence.load(std::memory_order_acquire) != Pos + 1) { return false; }
+				Value = Cell.Value;
+				Cell.Sequence.store(Pos + kMask + 1, std::memory_order_release);
+				PopPos_.store(Pos + 1, std::memory_order_relaxed);
+				return true;
+			}
+
+			T_LockFreeQueue(size_t Capacity)
+				: CellList_(std::make_unique<T_Cell[]>(RoundCapacity(Capacity))), kMask(RoundCapacity(Capacity) - 1) {
+				for (size_t index = 0; index <= kMask; ++index) {
+					CellList_[index].Sequence.store(index, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		// ゲームスレッドからサウンド番号で再生命令を送るキュー
+		struct T_SoundCommandQueue {
+		private:
+			enum class T_CommandType : uint8_t {
+				Play,
+				Stop,
+				StopAll,
+				Volume,
+				Pan,
+				Pitch,
+			};
+
+			struct T_Command {
+				T_CommandType Type = T_CommandType::Play;
+				bool Loop = false;
+				int32_t Priority = 0;
+				int64_t SoundNumber = 0;
+				float Volume = 1.0f;
+				float Pan = 0.0f;
+				float Pitch = 1.0f;
+			};
+
+			T_SNDData& SNDData_;
+			T_SoundMixer& Mixer_;
+			T_LockFreeQueue<T_Command> Queue_;
+			std::atomic<uint64_t> DropCount_ = 0;
+
+			bool Push(const T_Command& Command) noexcept {
+				if (Queue_.TryPush(Command)) { return true; }
+				DropCount_.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+
+			void Execute(const T_Command& Command) noexcept {
+				const int32_t GroupNo = Convert::DecodeSoundGroupNo(Command.SoundNumber);
+				const int32_t ItemNo = Convert::DecodeSoundItemNo(Command.SoundNumber);
+				switch (Command.Type) {
+				case T_CommandType::Play:
+					Mixer_.Play(SNDData_.FindSoundData(Command.SoundNumber), Command.Volume, Command.Pan, Command.Pitch, Command.Loop, Command.Priority);
+					break;
+				case T_CommandType::Stop: Mixer_.StopSound(GroupNo, ItemNo); break;
+				case T_CommandType::StopAll: Mixer_.StopAll(); break;
+				case T_CommandType::Volume: Mixer_.SetSoundVolume(GroupNo, ItemNo, Command.Volume); break;
+				case T_CommandType::Pan: Mixer_.SetSoundPan(GroupNo, ItemNo, Command.Pan); break;
+				case T_CommandType::Pitch: Mixer_.SetSoundPitch(GroupNo, ItemNo, Command.Pitch); break;
+				}
+			}
+
+		public:
+			/**
+			* @brief 再生命令
+			*
+			* 　指定したサウンド番号の再生命令を追加します
+			*
+			* 　複数のスレッドからロックせずに呼び出せます
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @param float Volume 音量 (省略時は 1.0)
+			* @param float Pan パン (-1.0 = 左 ～ 1.0 = 右、省略時は 0.0)
+			* @param float Pitch ピッチ (省略時は 1.0)
+			* @param bool Loop ループ再生 (省略時は false)
+			* @param int32_t Priority 優先度 (省略時は 0)
+			* @return bool 追加結果 (false = キューが満杯：true = 追加済み)
+			*/
+			bool Play(int32_t GroupNo, int32_t ItemNo, float Volume = 1.0f, float Pan = 0.0f, float Pitch = 1.0f, bool Loop = false, int32_t Priority = 0) noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::Play;
+				Command.Loop = Loop;
+				Command.Priority = Priority;
+				Command.SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				Command.Volume = Volume;
+				Command.Pan = Pan;
+				Command.Pitch = Pitch;
+				return Push(Command);
+			}
+
+			/**
+			* @brief 停止命令
+			*
+			* 　指定したサウンド番号を再生している全ボイス、もしくは全ボイスの停止命令を追加します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @return bool 追加結果 (false = キューが満杯：true = 追加済み)
+			*/
+			bool Stop(int32_t GroupNo, int32_t ItemNo) noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::Stop;
+				Command.SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				return Push(Command);
+			}
+			bool StopAll() noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::StopAll;
+				return Push(Command);
+			}
+
+			/**
+			* @brief 音量/パン/ピッチの変更命令
+			*
+			* 　指定したサウンド番号を再生している全ボイスへの変更命令を追加します
+			*
+			* @param int32_t GroupNo グループ番号
+			* @param int32_t ItemNo アイテム番号
+			* @param float Value 設定値
+			* @return bool 追加結果 (false = キューが満杯：true = 追加済み)
+			*/
+			bool SetVolume(int32_t GroupNo, int32_t ItemNo, float Volume) noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::Volume;
+				Command.SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				Command.Volume = Volume;
+				return Push(Command);
+			}
+			bool SetPan(int32_t GroupNo, int32_t ItemNo, float Pan) noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::Pan;
+				Command.SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				Command.Pan = Pan;
+				return Push(Command);
+			}
+			bool SetPitch(int32_t GroupNo, int32_t ItemNo, float Pitch) noexcept {
+				T_Command Command;
+				Command.Type = T_CommandType::Pitch;
+				Command.SoundNumber = Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				Command.Pitch = Pitch;
+				return Push(Command);
+			}
+
+			/**
+			* @brief 命令の実行
+			*
+			* 　溜まっている命令を追加順にミキサーへ反映します
+			*
+			* 　サウンド番号はここでSNDデータのインデックスから検索されます
+			*
+			* 　オーディオスレッドからRender関数の前に呼び出してください
+			*
+			* @return ksize_t 実行した命令数
+			*/
+			ksize_t Dispatch() noexcept {
+				ksize_t Count = 0;
+				T_Command Command;
+				while (Queue_.TryPop(Command)) {
+					Execute(Command);
+					++Count;
+				}
+				return Count;
+			}
+
+			/**
+			* @brief キューが満杯で破棄された命令数の取得
+			*
+			* @return uint64_t DropCount 破棄された命令数
+			*/
+			uint64_t DropCount() const noexcept { return DropCount_.load(std::memory_order_relaxed); }
+
+			/**
+			* @brief キューの容量の取得
+			*
+			* @return size_t capacity 容量 (指定値以上の2の累乗)
+			*/
+			size_t capacity() const noexcept { return Queue_.capacity(); }
+
+			T_SoundCommandQueue(T_SNDData& SNDData, T_SoundMixer& Mixer, size_t Capacity = 1024)
+				: SNDData_(SNDData), Mixer_(Mixer), Queue_(Capacity) {}
+		};
+
+		// 検索用のサウンド情報(ヘッダー、サブヘッダー、fmtチャンクのみ)
+		struct T_CatalogEntry {
+		private:
+			ksize_t FileIndex_ = 0;
+			int32_t GroupNo_ = 0;
+			int32_t ItemNo_ = 0;
+			uint16_t FormatTag_ = 0;
+			uint16_t Channels_ = 0;
+			uint16_t BlockAlign_ = 0;
+			uint16_t BitsPerSample_ = 0;
+			uint32_t SamplesPerSec_ = 0;
+			uint32_t DataSize_ = 0;
+			uint32_t NumFrame_ = 0;
+			std::string Comment_ = {}; // UTF-8
+
+		public:
+			[[nodiscard]] ksize_t FileIndex() const noexcept { return FileIndex_; }
+			[[nodiscard]] int32_t GroupNo() const noexcept { return GroupNo_; }
+			[[nodiscard]] int32_t ItemNo() const noexcept { return ItemNo_; }
+			[[nodiscard]] uint16_t FormatTag() const noexcept { return FormatTag_; }
+			[[nodiscard]] uint16_t Channels() const noexcept { return Channels_; }
+			[[nodiscard]] uint16_t BlockAlign() const noexcept { return BlockAlign_; }
+			[[nodiscard]] uint16_t BitsPerSample() const noexcept { return BitsPerSample_; }
+			[[nodiscard]] uint32_t SamplesPerSec() const noexcept { return SamplesPerSec_; }
+			[[nodiscard]] uint32_t DataSize() const noexcept { return DataSize_; }
+			[[nodiscard]] uint32_t NumFrame() const noexcept { return NumFrame_; }
+			[[nodiscard]] double Duration() const noexcept { return (SamplesPerSec_ ? double(NumFrame_) / SamplesPerSec_ : 0.0); }
+			[[nodiscard]] const std::string& Comment() const noexcept { return Comment_; }
+
+			T_CatalogEntry() = default;
+
+			T_CatalogEntry(ksize_t FileIndex, int32_t GroupNo, int32_t ItemNo, uint16_t FormatTag, uint16_t Channels, uint16_t BlockAlign, uint16_t BitsPerSample, uint32_t SamplesPerSec, uint32_t DataSize, uint32_t NumFrame, std::string Comment = {}) noexcept
+				: FileIndex_(FileIndex), GroupNo_(GroupNo), ItemNo_(ItemNo), FormatTag_(FormatTag), Channels_(Channels), BlockAlign_(BlockAlign)
+				, BitsPerSample_(BitsPerSample), SamplesPerSec_(SamplesPerSec), DataSize_(DataSize), NumFrame_(NumFrame), Comment_(std::move(Comment)) {
+			}
+
+			void FileIndex(ksize_t value) noexcept { FileIndex_ = value; }
+		};
+
+		// カタログ検索の条件(指定しなかった条件は判定しない)
+		struct T_CatalogQuery {
+		private:
+			std::optional<int32_t> GroupNo_ = std::nullopt;
+			std::optional<int32_t> ItemNo_ = std::nullopt;
+			std::optional<uint16_t> FormatTag_ = std::nullopt;
+			std::optional<uint16_t> Channels_ = std::nullopt;
+			std::optional<uint16_t> BitsPerSample_ = std::nullopt;
+			std::optional<uint32_t> SamplesPerSec_ = std::nullopt;
+			double MinDuration_ = 0.0;
+			double MaxDuration_ = std::numeric_limits<double>::infinity();
+
+		public:
+			T_CatalogQuery& Group(int32_t GroupNo) noexcept { GroupNo_ = GroupNo; return *this; }
+			T_CatalogQuery& Item(int32_t ItemNo) noexcept { ItemNo_ = ItemNo; return *this; }
+			T_CatalogQuery& Format(uint16_t FormatTag) noexcept { FormatTag_ = FormatTag; return *this; }
+			T_CatalogQuery& Channel(uint16_t Channels) noexcept { Channels_ = Channels; return *this; }
+			T_CatalogQuery& Bit(uint16_t BitsPerSample) noexcept { BitsPerSample_ = BitsPerSample; return *this; }
+			T_CatalogQuery& Hz(uint32_t SamplesPerSec) noexcept { SamplesPerSec_ = SamplesPerSec; return *this; }
+			T_CatalogQuery& MinDuration(double Second) noexcept { MinDuration_ = Second; return *this; }
+			T_CatalogQuery& MaxDuration(double Second) noexcept { MaxDuration_ = Second; return *this; }
+
+			[[nodiscard]] bool Match(const T_CatalogEntry& Entry) const noexcept {
+				if (GroupNo_ && *GroupNo_ != Entry.GroupNo()) { return false; }
+				if (ItemNo_ && *ItemNo_ != Entry.ItemNo()) { return false; }
+				if (FormatTag_ && *FormatTag_ != Entry.FormatTag()) { return false; }
+				if (Channels_ && *Channels_ != Entry.Channels()) { return false; }
+				if (BitsPerSample_ && *BitsPerSample_ != Entry.BitsPerSample()) { return false; }
+				if (SamplesPerSec_ && *SamplesPerSec_ != Entry.SamplesPerSec()) { return false; }
+				const double Duration = Entry.Duration();
+				return MinDuration_ <= Duration && Duration <= MaxDuration_;
+			}
+		};
+
+		// フォルダ以下の全SNDファイルのサウンド情報をまとめた検索用カタログ
+		struct T_SNDCatalog {
+		public:
+			using Entry = T_CatalogEntry;
+			using Query = T_CatalogQuery;
+
+		private:
+			struct T_CatalogFile {
+				std::filesystem::path Path = {};
+				uint64_t FileSize = 0;
+				int64_t WriteTime = 0;
+				bool IsValid = false;
+				std::vector<T_CatalogEntry> EntryList = {};
+			};
+
+			inline static constexpr std::string_view kSignature = "SAELibSndCatalog";
+			inline static constexpr uint32_t kVersion = 2;
+			inline static constexpr ksize_t kSubHeaderSize = 16;
+			inline static constexpr ksize_t kEntrySize = 32;
+			inline static constexpr ksize_t kRIFFHeaderSize = 12;
+			inline static constexpr ksize_t kfmtReadSize = 40;
+			inline static constexpr ksize_t kCommentReadSize = 4096; // これを超えるコメントは切り詰める
+
+			std::filesystem::path RootPath_ = {};
+			std::vector<T_CatalogFile> FileList_ = {}; // パス順
+			std::vector<T_CatalogEntry> EntryList_ = {}; // FileList_ の順に連結
+			std::shared_ptr<const T_CommentIndex> CommentIndex_ = nullptr; // EntryList_ の順番をIDとするコメント索引
+
+			// C++20 では u8string の戻り値が std::u8string になるため std::string へ揃える
+			[[nodiscard]] static std::string PathToUTF8(const std::filesystem::path& Path) {
+				const auto UTF8 = Path.generic_u8string();
+				return std::string(UTF8.begin(), UTF8.end());
+			}
+
+			[[nodiscard]] static std::filesystem::path UTF8ToPath(const std::string& UTF8) {
+#if defined(__cpp_char8_t)
+				return std::filesystem::path(std::u8string(UTF8.begin(), UTF8.end()));
+#else
+				return std::filesystem::u8path(UTF8);
+#endif
+			}
+
+			[[nodiscard]] static bool IsSNDFile(const std::filesystem::path& Path) {
+				std::string Extension = Path.extension().string();
+				for (char& c : Extension) {
+					if ('A' <= c && c <= 'Z') { c = static_cast<char>(c - 'A' + 'a'); }
+				}
+				return Extension == SNDFormat::kExtension;
+			}
+
+			// WAVEデータのチャンクを順に読み取り、fmt/fact/dataチャンクからサウンド情報を求める
+			// Read(Offset, Dst, Size) は WAVEデータ先頭からの位置を読み取る関数
+			template<typename ReadFunc>
+			[[nodiscard]] static bool ReadWAVEInfo(ReadFunc&& Read, uint32_t SoundSize, int32_t GroupNo, int32_t ItemNo, T_CatalogEntry& Entry) {
+				unsigned char buffer[kfmtReadSize] = {};
+				if (SoundSize < kRIFFHeaderSize || !Read(0, buffer, kRIFFHeaderSize)) { return false; }
+				if (std::memcmp(&buffer[0], "RIFF", 4) || std::memcmp(&buffer[8], "WAVE", 4)) { return false; }
+
+				bool Existfmt = false;
+				bool Existfact = false;
+				uint16_t FormatTag = 0, Channels = 0, BlockAlign = 0, BitsPerSample = 0;
+				uint32_t SamplesPerSec = 0, SampleLength = 0, DataSize = 0;
+				std::string Comment;
+				uint64_t Offset = kRIFFHeaderSize;
+				while (Offset + 8 <= SoundSize) {
+					if (!Read(static_cast<uint32_t>(Offset), buffer, 8)) { return false; }
+					const std::string_view Signature(reinterpret_cast<const char*>(buffer), 4);
+					const uint32_t ChunkSize = DecodeEndian::UInt32LE(&buffer[4]);
+					const uint32_t Remain = static_cast<uint32_t>(SoundSize - Offset - 8);
+
+					if (Signature == "fmt " && ChunkSize >= 16) {
+						const uint32_t ReadSize = std::min<uint32_t>({ ChunkSize, kfmtReadSize, Remain });
+						if (ReadSize < 16 || !Read(static_cast<uint32_t>(Offset + 8), buffer, ReadSize)) { return false; }
+						FormatTag = DecodeEndian::UInt16LE(&buffer[0]);
+						Channels = DecodeEndian::UInt16LE(&buffer[2]);
+						SamplesPerSec = DecodeEndian::UInt32LE(&buffer[4]);
+						BlockAlign = DecodeEndian::UInt16LE(&buffer[12]);
+						BitsPerSample = DecodeEndian::UInt16LE(&buffer[14]);
+						if (FormatTag == WAVEFormatTag::kExtensible && ReadSize >= kfmtReadSize) {
+							FormatTag = DecodeEndian::UInt16LE(&buffer[24]);
+						}
+						Existfmt = true;
+					}
+					else if (Signature == "fact" && ChunkSize >= 4 && Remain >= 4) {
+						if (!Read(static_cast<uint32_t>(Offset + 8), buffer, 4)) { return false; }
+						SampleLength = DecodeEndian::UInt32LE(buffer);
+						Existfact = true;
+					}
+					else if (Signature == "data") {
+						DataSize = std::min(ChunkSize, Remain);
+					}
+					else if (Signature == "SAEC") {
+						Comment.resize(std::min<uint32_t>({ ChunkSize, kCommentReadSize, Remain }));
+						if (!Read(static_cast<uint32_t>(Offset + 8), reinterpret_cast<unsigned char*>(Comment.data()), static_cast<uint32_t>(Comment.size()))) { return false; }
+						Comment = TextEncoding::CP932ToUTF8(std::string_view(Comment.c_str()));
+					}
+					Offset += uint64_t{ ChunkSize } + 8 + (ChunkSize & 1);
+				}
+				if (!Existfmt) { return false; }
+
+				// サンプル数は fact チャンクを優先し、無い場合は dataチャンクのサイズ(ADPCMはブロック構成)から求める
+				const uint32_t FrameSize = (BlockAlign ? BlockAlign : uint32_t{ Channels } * (BitsPerSample / 8));
+				const uint32_t DataFrame = (ADPCM::IsADPCM(FormatTag) ? ADPCM::NumFrame(FormatTag, Channels, BlockAlign, DataSize) : (FrameSize ? DataSize / FrameSize : 0));
+				const uint32_t NumFrame = (Existfact ? SampleLength : DataFrame);
+				Entry = T_CatalogEntry(0, GroupNo, ItemNo, FormatTag, Channels, BlockAlign, BitsPerSample, SamplesPerSec, DataSize, NumFrame, std::move(Comment));
+				return true;
+			}
+
+			// サブヘッダーを辿り、各サウンドのWAVEデータは必要な部分だけ読み取る
+			[[nodiscard]] static bool ReadSNDInfo(std::ifstream& File, uint64_t FileSize, uint32_t NumSound, std::vector<T_CatalogEntry>& EntryList) {
+				T_UnorderedMap<int64_t> SoundNumberUMap;
+				uint64_t Offset = SNDFormat::kSubHeaderStart;
+				for (uint32_t LoadNo = 0; LoadNo < NumSound && Offset + kSubHeaderSize <= FileSize; ++LoadNo) {
+					unsigned char SubHeader[kSubHeaderSize] = {};
+					File.seekg(static_cast<std::streamoff>(Offset));
+					if (!File.read(reinterpret_cast<char*>(SubHeader), sizeof(SubHeader))) { return false; }
+					const uint32_t NextAddress = DecodeEndian::UInt32LE(&SubHeader[0]);
+					const uint32_t DataSize = DecodeEndian::UInt32LE(&SubHeader[4]);
+					const int32_t GroupNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&SubHeader[8]));
+					const int32_t ItemNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&SubHeader[12]));
+					if (!NextAddress || NextAddress < Offset + kSubHeaderSize) { break; }
+
+					// 読み込み時と同じく重複したサウンド番号は最初のサウンドのみ登録する
+					if (!SoundNumberUMap.exist(GroupNo, ItemNo)) {
+						SoundNumberUMap.Register(GroupNo, ItemNo);
+						const uint64_t SoundStart = Offset + kSubHeaderSize;
+						const uint32_t SoundSize = static_cast<uint32_t>(std::min<uint64_t>(DataSize, FileSize - SoundStart));
+						auto Read = [&File, SoundStart](uint32_t ReadOffset, unsigned char* Dst, uint32_t Size) -> bool {
+							File.seekg(static_cast<std::streamoff>(SoundStart + ReadOffset));
+							return static_cast<bool>(File.read(reinterpret_cast<char*>(Dst), Size));
+						};
+						T_CatalogEntry Entry;
+						if (!ReadWAVEInfo(Read, SoundSize, GroupNo, ItemNo, Entry)) { return false; }
+						EntryList.push_back(Entry);
+					}
+					Offset = NextAddress;
+				}
+				return true;
+			}
+
+			// 圧縮SNDファイルは索引を読み取り、fmtチャンクを得るために各圧縮データを展開する
+			[[nodiscard]] static bool ReadCompressedInfo(std::ifstream& File, uint64_t FileSize, uint32_t NumSound, uint32_t NumPayload, std::vector<T_CatalogEntry>& EntryList) {
+				const uint64_t IndexEnd = SNDFormat::kCompressedHeaderSize + (uint64_t{ NumSound } + NumPayload) * SNDFormat::kCompressedIndexSize;
+				if (IndexEnd > FileSize) { return false; }
+				std::vector<unsigned char> Index(static_cast<size_t>(IndexEnd - SNDFormat::kCompressedHeaderSize));
+				File.seekg(SNDFormat::kCompressedHeaderSize);
+				if (!File.read(reinterpret_cast<char*>(Index.data()), Index.size())) { return false; }
+
+				std::vector<std::optional<T_CatalogEntry>> PayloadInfo(NumPayload);
+				std::vector<unsigned char> Compressed, Raw;
+				T_UnorderedMap<int64_t> SoundNumberUMap;
+				for (uint32_t SoundNo = 0; SoundNo < NumSound; ++SoundNo) {
+					const unsigned char* const Sound = &Index[size_t{ SoundNo } * SNDFormat::kCompressedIndexSize];
+					const int32_t GroupNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&Sound[0]));
+					const int32_t ItemNo = static_cast<int32_t>(DecodeEndian::UInt32LE(&Sound[4]));
+					const uint32_t PayloadIndex = DecodeEndian::UInt32LE(&Sound[8]);
+					if (PayloadIndex >= NumPayload) { return false; }
+					if (SoundNumberUMap.exist(GroupNo, ItemNo)) { continue; }
+					SoundNumberUMap.Register(GroupNo, ItemNo);
+
+					// 同じ圧縮データを参照するサウンドは展開結果を使い回す
+					if (!PayloadInfo[PayloadIndex]) {
+						const unsigned char* const Payload = &Index[(size_t{ NumSound } + PayloadIndex) * SNDFormat::kCompressedIndexSize];
+						const uint32_t PayloadOffset = DecodeEndian::UInt32LE(&Payload[0]);
+						const uint32_t CompressedSize = DecodeEndian::UInt32LE(&Payload[4]);
+						const uint32_t RawSize = DecodeEndian::UInt32LE(&Payload[8]);
+						if (PayloadOffset < IndexEnd || uint64_t{ PayloadOffset } + CompressedSize > FileSize) { return false; }
+						if (RawSize > LZ4Block::MaxDecompressedSize(CompressedSize)) { return false; } // 展開先を確保する前に確認する
+
+						Compressed.resize(CompressedSize);
+						File.seekg(PayloadOffset);
+						if (!File.read(reinterpret_cast<char*>(Compressed.data()), Compressed.size())) { return false; }
+						if (CompressedSize == RawSize) {
+							Raw.swap(Compressed);
+						}
+						else {
+							Raw.resize(RawSize);
+							if (!LZ4Block::Decompress(Compressed.data(), Compressed.size(), Raw.data(), Raw.size())) { return false; }
+						}
+						auto Read = [&Raw](uint32_t ReadOffset, unsigned char* Dst, uint32_t Size) -> bool {
+							if (uint64_t{ ReadOffset } + Size > Raw.size()) { return false; }
+							std::memcpy(Dst, &Raw[ReadOffset], Size);
+							return true;
+						};
+						T_CatalogEntry Entry;
+						if (!ReadWAVEInfo(Read, RawSize, 0, 0, Entry)) { return false; }
+						PayloadInfo[PayloadIndex] = Entry;
+					}
+					const T_CatalogEntry& Info = *PayloadInfo[PayloadIndex];
+					EntryList.emplace_back(0, GroupNo, ItemNo, Info.FormatTag(), Info.Channels(), Info.BlockAlign(), Info.BitsPerSample(), Info.SamplesPerSec(), Info.DataSize(), Info.NumFrame(), Info.Comment());
+				}
+				return true;
+			}
+
+			// ワーカーから呼ばれるためエラーは記録せず IsValid で返す
+			static void ReadFileInfo(T_CatalogFile& CatalogFile) {
+				CatalogFile.IsValid = false;
+				CatalogFile.EntryList.clear();
+				std::ifstream File(CatalogFile.Path, std::ios::binary);
+				unsigned char Header[SNDFormat::kCompressedHeaderSize] = {};
+				if (!File.is_open() || CatalogFile.FileSize > SNDFormat::kFileSizeLimit || !File.read(reinterpret_cast<char*>(Header), sizeof(Header))) { return; }
+
+				const uint32_t NumSound = DecodeEndian::UInt32LE(&Header[16]);
+				if (std::string_view(reinterpret_cast<const char*>(Header), SNDFormat::kCompressedSignature.size()) == SNDFormat::kCompressedSignature) {
+					if (DecodeEndian::UInt32LE(&Header[12]) != SNDFormat::kCompressedVersion) { return; }
+					CatalogFile.IsValid = ReadCompressedInfo(File, CatalogFile.FileSize, NumSound, DecodeEndian::UInt32LE(&Header[20]), CatalogFile.EntryList);
+				}
+				else if (std::string_view(reinterpret_cast<const char*>(Header), SNDFormat::kSignature.size()) == SNDFormat::kSignature
+					&& DecodeEndian::UInt32LE(&Header[20]) == SNDFormat::kSubHeaderStart) {
+					CatalogFile.IsValid = ReadSNDInfo(File, CatalogFile.FileSize, NumSound, CatalogFile.EntryList);
+				}
+				if (!CatalogFile.IsValid) { CatalogFile.EntryList.clear(); }
+			}
+
+			const T_CommentIndex& CommentIndex() {
+				if (!CommentIndex_) {
+					std::vector<std::string> CommentList;
+					CommentList.reserve(EntryList_.size());
+					for (const auto& CatalogEntry : EntryList_) { CommentList.push_back(CatalogEntry.Comment()); }
+					CommentIndex_ = std::make_shared<const T_CommentIndex>(CommentList);
+				}
+				return *CommentIndex_;
+			}
+
+			std::vector<T_CatalogEntry> CommentResult(const std::vector<ksize_t>& EntryIndex) const {
+				std::vector<T_CatalogEntry> Result;
+				Result.reserve(EntryIndex.size());
+				for (ksize_t index : EntryIndex) { Result.push_back(EntryList_[index]); }
+				return Result;
+			}
+
+			void BuildEntryList() {
+				size_t NumEntry = 0;
+				for (const auto& CatalogFile : FileList_) { NumEntry += CatalogFile.EntryList.size(); }
+				EntryList_.clear();
+				EntryList_.reserve(NumEntry);
+				CommentIndex_.reset();
+				for (ksize_t FileIndex = 0; FileIndex < FileList_.size(); ++FileIndex) {
+					for (auto Entry : FileList_[FileIndex].EntryList) {
+						Entry.FileIndex(FileIndex);
+						EntryList_.push_back(Entry);
+					}
+				}
+			}
+
+		public:
+			/**
+			* @brief フォルダ以下のSNDファイルを走査
+			*
+			* 　指定フォルダ以下の全ての .snd ファイルを複数のスレッドで並列に走査し、サウンド情報をカタログへ登録します
+			*
+			* 　サウンドデータは読み込まず、ヘッダー、サブヘッダー、WAVEデータのチャンク情報のみ読み取ります
+			*
+			* 　前回の走査結果または Load 関数で読み込んだカタログから、サイズと更新日時が変わっていないファイルは再利用します
+			*
+			* @param const std::string& RootPath 走査するフォルダ (省略時は前回の走査フォルダ、未走査の場合はSNDファイルの検索パス)
+			* @return size_t 新たに読み取ったファイル数
+			*/
+			size_t Scan(const std::string& RootPath = "") {
+				T_FilePathSystem RootFolder(!RootPath.empty() ? std::filesystem::path(RootPath) : (!RootPath_.empty() ? RootPath_ : T_Config::Instance().SNDSearchPath()));
+				if (RootFolder.ErrorCode() || !std::filesystem::is_directory(RootFolder.Path())) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_SNDSearchPath);
+					return 0;
+				}
+
+				std::vector<T_CatalogFile> FileList;
+				std::error_code ErrorCode;
+				for (std::filesystem::recursive_directory_iterator it(RootFolder.Path(), std::filesystem::directory_options::skip_permission_denied, ErrorCode), end; !ErrorCode && it != end; it.increment(ErrorCode)) {
+					if (!it->is_regular_file(ErrorCode) || !IsSNDFile(it->path())) { continue; }
+					T_CatalogFile CatalogFile;
+					CatalogFile.Path = it->path();
+					CatalogFile.FileSize = it->file_size(ErrorCode);
+					CatalogFile.WriteTime = static_cast<int64_t>(it->last_write_time(ErrorCode).time_since_epoch().count());
+					ErrorCode.clear();
+					FileList.push_back(std::move(CatalogFile));
+				}
+				std::sort(FileList.begin(), FileList.end(), [](const T_CatalogFile& Left, const T_CatalogFile& Right) { return Left.Path < Right.Path; });
+
+				// 変更されていないファイルは前回の結果を引き継ぐ
+				std::vector<size_t> ScanList;
+				auto Previous = FileList_.begin();
+				for (size_t index = 0; index < FileList.size(); ++index) {
+					T_CatalogFile& CatalogFile = FileList[index];
+					while (Previous != FileList_.end() && Previous->Path < CatalogFile.Path) { ++Previous; }
+					if (Previous != FileList_.end() && Previous->Path == CatalogFile.Path
+						&& Previous->FileSize == CatalogFile.FileSize && Previous->WriteTime == CatalogFile.WriteTime) {
+						CatalogFile.IsValid = Previous->IsValid;
+						CatalogFile.EntryList = std::move(Previous->EntryList);
+						continue;
+					}
+					ScanList.push_back(index);
+				}
+				Parallel::For(ScanList.size(), [&FileList, &ScanList](size_t index) { ReadFileInfo(FileList[ScanList[index]]); });
+
+				RootPath_ = RootFolder.Path();
+				FileList_ = std::move(FileList);
+				BuildEntryList();
+				return ScanList.size();
+			}
+
+			/**
+			* @brief カタログの保存
+			*
+			* 　走査結果をファイルへ保存します (次回は Load 関数で読み込んでから Scan 関数を実行すると変更されたファイルだけ読み取ります)
+			*
+			* @param const std::string& FilePath 保存先のファイルパス
+			* @return bool 保存結果 (false = 失敗：true = 成功)
+			*/
+			bool Save(const std::string& FilePath) const {
+				// 0～15 識別子("SAELibSndCatalog")
+				// 16～  バージョン、ファイル数、サウンド数
+				// 28～  走査したフォルダ(パス長、パス(UTF-8))
+				// 以降  ファイル情報(パス長、パス(UTF-8)、サイズ、更新日時、有効判定、サウンド数)、サウンド情報(末尾にコメント長、コメント(UTF-8))
+				std::vector<unsigned char> buffer(kSignature.size() + 12);
+				std::memcpy(buffer.data(), kSignature.data(), kSignature.size());
+				EncodeEndian::UInt32LE(&buffer[16], kVersion);
+				EncodeEndian::UInt32LE(&buffer[20], static_cast<uint32_t>(FileList_.size()));
+				EncodeEndian::UInt32LE(&buffer[24], static_cast<uint32_t>(EntryList_.size()));
+
+				auto Append32 = [&buffer](uint32_t value) {
+					buffer.resize(buffer.size() + 4);
+					EncodeEndian::UInt32LE(&buffer[buffer.size() - 4], value);
+				};
+				const std::string RootPath = PathToUTF8(RootPath_);
+				Append32(static_cast<uint32_t>(RootPath.size()));
+				buffer.insert(buffer.end(), RootPath.begin(), RootPath.end());
+				for (const auto& CatalogFile : FileList_) {
+					const std::string Path = PathToUTF8(CatalogFile.Path);
+					Append32(static_cast<uint32_t>(Path.size()));
+					buffer.insert(buffer.end(), Path.begin(), Path.end());
+					Append32(static_cast<uint32_t>(CatalogFile.FileSize));
+					Append32(static_cast<uint32_t>(CatalogFile.FileSize >> 32));
+					Append32(static_cast<uint32_t>(CatalogFile.WriteTime));
+					Append32(static_cast<uint32_t>(static_cast<uint64_t>(CatalogFile.WriteTime) >> 32));
+					Append32(CatalogFile.IsValid ? 1 : 0);
+					Append32(static_cast<uint32_t>(CatalogFile.EntryList.size()));
+					for (const auto& Entry : CatalogFile.EntryList) {
+						Append32(static_cast<uint32_t>(Entry.GroupNo()));
+						Append32(static_cast<uint32_t>(Entry.ItemNo()));
+						Append32(Entry.FormatTag() | (uint32_t{ Entry.Channels() } << 16));
+						Append32(Entry.BlockAlign() | (uint32_t{ Entry.BitsPerSample() } << 16));
+						Append32(Entry.SamplesPerSec());
+						Append32(Entry.DataSize());
+						Append32(Entry.NumFrame());
+						Append32(static_cast<uint32_t>(Entry.Comment().size()));
+						buffer.insert(buffer.end(), Entry.Comment().begin(), Entry.Comment().end());
+					}
+				}
+
+				std::ofstream File(std::filesystem::path(FilePath), std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CreateCatalogFile);
+					return false;
+				}
+				File.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+				File.flush();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_WriteCatalogFile);
+					return false;
+				}
+				File.close();
+				if (File.fail() || File.bad()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Failed_CloseCatalogFile);
+					return false;
+				}
+				return true;
+			}
+
+			/**
+			* @brief カタログの読み込み
+			*
+			* 　Save 関数で保存したカタログを読み込みます (ファイルの変更は確認しないため Scan 関数で更新してください)
+			*
+			* @param const std::string& FilePath 読み込むファイルパス
+			* @return bool 読み込み結果 (false = 失敗：true = 成功)
+			*/
+			bool Load(const std::string& FilePath) {
+				std::ifstream File(std::filesystem::path(FilePath), std::ios::binary);
+				if (!File.is_open()) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_CatalogFile);
+					return false;
+				}
+				std::vector<unsigned char> buffer((std::istreambuf_iterator<char>(File)), std::istreambuf_iterator<char>());
+
+				size_t Offset = 0;
+				auto Read32 = [&buffer, &Offset](uint32_t& value) -> bool {
+					if (buffer.size() - Offset < 4) { return false; }
+					value = DecodeEndian::UInt32LE(&buffer[Offset]);
+					Offset += 4;
+					return true;
+				};
+				auto ReadPath = [&buffer, &Offset, &Read32](std::filesystem::path& Path) -> bool {
+					uint32_t PathSize = 0;
+					if (!Read32(PathSize) || buffer.size() - Offset < PathSize) { return false; }
+					Path = UTF8ToPath(std::string(reinterpret_cast<const char*>(buffer.data() + Offset), PathSize));
+					Offset += PathSize;
+					return true;
+				};
+				std::filesystem::path RootPath;
+				auto Parse = [&](std::vector<T_CatalogFile>& FileList) -> bool {
+					if (buffer.size() < kSignature.size() + 12 || std::memcmp(buffer.data(), kSignature.data(), kSignature.size())) { return false; }
+					Offset = kSignature.size();
+					uint32_t Version = 0, NumFile = 0, NumEntry = 0;
+					if (!Read32(Version) || Version != kVersion || !Read32(NumFile) || !Read32(NumEntry) || !ReadPath(RootPath)) { return false; }
+					for (uint32_t FileNo = 0; FileNo < NumFile; ++FileNo) {
+						T_CatalogFile CatalogFile;
+						uint32_t SizeLow = 0, SizeHigh = 0, TimeLow = 0, TimeHigh = 0, IsValid = 0, NumFileEntry = 0;
+						if (!ReadPath(CatalogFile.Path)) { return false; }
+						if (!Read32(SizeLow) || !Read32(SizeHigh) || !Read32(TimeLow) || !Read32(TimeHigh) || !Read32(IsValid) || !Read32(NumFileEntry)) { return false; }
+						if ((buffer.size() - Offset) / kEntrySize < NumFileEntry) { return false; }
+						CatalogFile.FileSize = SizeLow | (uint64_t{ SizeHigh } << 32);
+						CatalogFile.WriteTime = static_cast<int64_t>(TimeLow | (uint64_t{ TimeHigh } << 32));
+						CatalogFile.IsValid = (IsValid != 0);
+						CatalogFile.EntryList.reserve(NumFileEntry);
+						for (uint32_t EntryNo = 0; EntryNo < NumFileEntry; ++EntryNo) {
+							if (buffer.size() - Offset < kEntrySize) { return false; }
+							const unsigned char* const Data = &buffer[Offset];
+							const uint32_t CommentSize = DecodeEndian::UInt32LE(&Data[28]);
+							if (buffer.size() - Offset - kEntrySize < CommentSize) { return false; }
+							CatalogFile.EntryList.emplace_back(0, static_cast<int32_t>(DecodeEndian::UInt32LE(&Data[0])), static_cast<int32_t>(DecodeEndian::UInt32LE(&Data[4])),
+								DecodeEndian::UInt16LE(&Data[8]), DecodeEndian::UInt16LE(&Data[10]), DecodeEndian::UInt16LE(&Data[12]), DecodeEndian::UInt16LE(&Data[14]),
+								DecodeEndian::UInt32LE(&Data[16]), DecodeEndian::UInt32LE(&Data[20]), DecodeEndian::UInt32LE(&Data[24]),
+								std::string(reinterpret_cast<const char*>(&Data[kEntrySize]), CommentSize));
+							Offset += kEntrySize + CommentSize;
+						}
+						FileList.push_back(std::move(CatalogFile));
+					}
+					return std::is_sorted(FileList.begin(), FileList.end(), [](const T_CatalogFile& Left, const T_CatalogFile& Right) { return Left.Path < Right.Path; });
+				};
+
+				std::vector<T_CatalogFile> FileList;
+				if (!Parse(FileList)) {
+					T_ErrorHandle::Instance().SetError(ErrorMessage::Invalid_CatalogFile);
+					return false;
+				}
+				RootPath_ = std::move(RootPath);
+				FileList_ = std::move(FileList);
+				BuildEntryList();
+				return true;
+			}
+
+			/**
+			* @brief 条件に一致するサウンドの検索
+			*
+			* 　カタログから条件に一致するサウンドをファイルのパス順、ファイル内の読み込み順で取得します
+			*
+			* @param const Query& Condition 検索条件
+			* @return std::vector<Entry> 一致したサウンド情報
+			*/
+			[[nodiscard]] std::vector<Entry> Find(const Query& Condition) const {
+				std::vector<Entry> Result;
+				for (const auto& CatalogEntry : EntryList_) {
+					if (Condition.Match(CatalogEntry)) { Result.push_back(CatalogEntry); }
+				}
+				return Result;
+			}
+
+			/**
+			* @brief 条件に一致するサウンドを含むファイルの検索
+			*
+			* @param const Query& Condition 検索条件
+			* @return std::vector<std::filesystem::path> 一致したサウンドを含むファイルのパス
+			*/
+			[[nodiscard]] std::vector<std::filesystem::path> FindFile(const Query& Condition) const {
+				std::vector<std::filesystem::path> Result;
+				for (ksize_t FileIndex = 0; FileIndex < FileList_.size(); ++FileIndex) {
+					const auto& EntryList = FileList_[FileIndex].EntryList;
+					if (std::any_of(EntryList.begin(), EntryList.end(), [&Condition](const T_CatalogEntry& CatalogEntry) { return Condition.Match(CatalogEntry); })) {
+						Result.push_back(FileList_[FileIndex].Path);
+					}
+				}
+				return Result;
+			}
+
+			/**
+			* @brief コメントの部分一致検索
+			*
+			* 　カタログの全サウンドからコメントに指定文字列を含むサウンドを取得します(英字の大文字小文字は区別しません)
+			*
+			* 　初回の検索時に全コメントの索引を作成し、Scan 関数もしくは Load 関数を実行するまで使い回します
+			*
+			* @param std::string_view Text 検索文字列 (UTF-8)
+			* @return std::vector<Entry> 一致したサウンド情報
+			*/
+			[[nodiscard]] std::vector<Entry> FindComment(std::string_view Text) {
+				return CommentResult(CommentIndex().Find(Text));
+			}
+
+			/**
+			* @brief コメントの前方一致検索
+			*
+			* 　カタログの全サウンドからコメントが指定文字列から始まるサウンドを取得します(英字の大文字小文字は区別しません)
+			*
+			* @param std::string_view Text 検索文字列 (UTF-8)
+			* @return std::vector<Entry> 一致したサウンド情報
+			*/
+			[[nodiscard]] std::vector<Entry> FindCommentPrefix(std::string_view Text) {
+				return CommentResult(CommentIndex().FindPrefix(Text));
+			}
+
+			/**
+			* @brief サウンドを含むファイルのパスを取得
+			*
+			* @param const Entry& CatalogEntry Find 関数で取得したサウンド情報
+			* @return const std::filesystem::path& ファイルのパス
+			*/
+			[[nodiscard]] const std::filesystem::path& FilePath(const Entry& CatalogEntry) const { return FileList_.at(CatalogEntry.FileIndex()).Path; }
+
+			/**
+			* @brief 読み取れなかったファイルの取得
+			*
+			* 　SNDファイルの形式として読み取れなかったファイルのパスを取得します
+			*
+			* @return std::vector<std::filesystem::path> ファイルのパス
+			*/
+			[[nodiscard]] std::vector<std::filesystem::path> InvalidFile() const {
+				std::vector<std::filesystem::path> Result;
+				for (const auto& CatalogFile : FileList_) {
+					if (!CatalogFile.IsValid) { Result.push_back(CatalogFile.Path); }
+				}
+				return Result;
+			}
+
+			[[nodiscard]] const std::filesystem::path& RootPath() const noexcept { return RootPath_; }
+			[[nodiscard]] size_t NumFile() const noexcept { return FileList_.size(); }
+			[[nodiscard]] size_t size() const noexcept { return EntryList_.size(); }
+			[[nodiscard]] bool empty() const noexcept { return FileList_.empty(); }
+			[[nodiscard]] const std::vector<Entry>& EntryList() const noexcept { return EntryList_; }
+
+			void clear() {
+				RootPath_.clear();
+				FileList_.clear();
+				EntryList_.clear();
+				CommentIndex_.reset();
+			}
+		};
+	} // ReadSndFile_detail
+
+	// 使用ユーザー向けの名前設定
+
+	/**
+	* @brief SNDファイルを扱うクラス
+	*
+	* 　- コンストラクタの引数を指定した場合、指定した引数でLoadSND関数を実行します
+	*
+	* 　- 引数を指定しない場合、ファイル読み込みは行いません
+	*
+	* @param const std::string& FileName ファイル名 (拡張子 .snd は省略可)
+	* @param const std::string& FilePath 対象のパス (省略時は実行ファイルの子階層を探索)
+	*/
+	using SND = ReadSndFile_detail::T_SNDData;
+
+	/**
+	* @brief SNDファイルを書き出すクラス
+	*
+	* 　- 読み込み済みのSNDを指定して生成します
+	*
+	* 　- Repack関数でサウンド番号順の並び替えとページ境界への整列を行います
+	*
+	* @param const SND& SNDData 書き出すSNDデータ
+	*/
+	using SNDWriter = ReadSndFile_detail::T_SNDWriter;
+
+	/**
+	* @brief SoundDataを再生するソフトウェアミキサー
+	*
+	* 　- 同時発音数と出力サンプリング周波数を指定して生成します
+	*
+	* 　- Render関数はメモリ確保とロックを行わずにステレオのfloatバッファへ書き込みます
+	*
+	* @param ksize_t NumVoice 同時発音数
+	* @param uint32_t SampleRate 出力サンプリング周波数 (省略時は 48000)
+	*/
+	using SNDMixer = ReadSndFile_detail::T_SoundMixer;
+
+	/**
+	* @brief サウンド番号で再生命令を送るロックフリーキュー
+	*
+	* 　- 命令を実行するSNDとミキサー、キューの容量を指定して生成します
+	*
+	* 　- 再生命令等は複数のスレッドからロックせずに追加でき、Dispatch関数でオーディオスレッドから実行します
+	*
+	* @param SND& SNDData サウンド番号を検索するSNDデータ
+	* @param SNDMixer& Mixer 命令を実行するミキサー
+	* @param size_t Capacity キューの容量 (省略時は 1024)
+	*/
+	using SNDCommandQueue = ReadSndFile_detail::T_SoundCommandQueue;
+
+	/**
+	* @brief フォルダ以下のSNDファイルを検索するカタログ
+	*
+	* 　- Scan関数で指定フォルダ以下の全SNDファイルを並列に走査し、サウンド情報だけを登録します
+	*
+	* 　- Find関数でグループ番号、アイテム番号、フォーマット、長さ等を条件に検索できます
+	*
+	* 　- Save/Load関数で走査結果を保存でき、次回の走査では変更されたファイルだけを読み取ります
+	*/
+	using SNDCatalog = ReadSndFile_detail::T_SNDCatalog;
+
+	/**
+	* @brief 読み込み済みSNDのスナップショット
+	*
+	* 　- Serialize/Share関数で読み込み済みSNDの状態を位置に依存しない1つのバイナリ(もしくは名前付き共有メモリ)にまとめます
+	*
+	* 　- Attach/OpenShared関数でスナップショットを複製、解析せずに読み取り専用で参照し、SoundDataと同じ値を取得できます
+	*/
+	using SNDSnapshot = ReadSndFile_detail::T_SNDSnapshot;
+
+	/**
+	* @brief ReadSndFileのエラー情報空間
+	*/
+	namespace SNDError = ReadSndFile_detail::ErrorMessage;
+
+	/**
+	* @brief ReadSndFileのコンフィグ設定空間
+	*/
+	namespace SNDConfig {
+
+		///////////////////////////////////////////////////////////////////////////////////////////////////
+		// Setter /////////////////////////////////////////////////////////////////////////////////////////
+		///////////////////////////////////////////////////////////////////////////////////////////////////
+		/**
+		* @brief エラー出力の切り替え設定
+		*
+		* 　このライブラリ関数で発生したエラーを例外として投げるかログとして記録するかを指定できます
+		*
+		* @param bool flag (false = ログとして記録する：true = 例外を投げる)
+		*/
+		inline void SetThrowError(bool flag) { ReadSndFile_detail::T_Config::Instance().ThrowError(flag); }
+
+		/**
+		* @brief エラーログファイルを作成設定
+		*
+		* 　このライブラリ関数で発生したエラーのログファイルを出力するかどうか指定できます
+		*
+		* @param bool flag (false = ログファイルを出力しない：true = ログファイルを出力する)
+		*/
+		inline void SetCreateLogFile(bool flag) { ReadSndFile_detail::T_Config::Instance().CreateLogFile(flag); }
+
+		/**
+		* @brief SAELibフォルダを作成設定
+		*
+		* 　ファイルの出力先としてSAELibファイルを使用するかを指定できます
+		*
+		* @param bool flag (false = SAELibファイルを使用しない：true = SAELibファイルを使用する)
+		* @param const std::string& Path SAELibフォルダ作成先 (省略時はパスの設定なし)
+		*/
+		inline void SetCreateSAELibFile(bool flag, const std::string& Path = "") {
+			ReadSndFile_detail::T_Config::Instance().CreateSAELibFile(flag);
+			if (!Path.empty()) {
+				ReadSndFile_detail::T_Config::Instance().SAELibFilePath(Path);
+			}
+		}
+
+		/**
+		* @brief SAELibフォルダのパス設定
+		*
+		* 　SAELibファイルの作成パスを指定できます
+		*
+		* @param const std::string& Path SAELibフォルダ作成先
+		*/
+		inline void SetSAELibFilePath(const std::string& Path = "") { ReadSndFile_detail::T_Config::Instance().SAELibFilePath(Path); }
+
+		/**
+		* @brief SNDファイルの検索パス設定
+		*
+		* 　SNDファイルの検索先のパスを指定できます
+		*
+		* 　SNDコンストラクタもしくはLoadSND関数で検索先のパスを指定しない場合、この設定のパスで検索します
+		*
+		* @param const std::string& Path SNDファイルの検索先のパス
+		*/
+		inline void SetSNDSearchPath(const std::string& Path = "") { ReadSndFile_detail::T_Config::Instance().SNDSearchPath(Path); }
+
+		/**
+		* @brief サウンドデータの共有設定
+		*
+		* 　内容が同一のサウンドデータを複数のSNDで共有するかを指定できます
+		*
+		* 　設定はLoadSND関数の実行時に適用されます
+		*
+		* @param bool flag (false = SNDごとに保持する：true = サウンドプールで共有する)
+		*/
+		inline void SetShareSoundPool(bool flag) { ReadSndFile_detail::T_Config::Instance().ShareSoundPool(flag); }
+
+		/**
+		* @brief コメントのUTF-8変換設定
+		*
+		* 　読み込み時に全サウンドのコメントをUTF-8へ変換して保持し、コメント検索用の索引を作成するかを指定できます
+		*
+		* 　設定はLoadSND関数の実行時に適用されます
+		*
+		* @param bool flag (false = 取得時に変換する：true = 読み込み時に変換する)
+		*/
+		inline void SetCommentUTF8(bool flag) { ReadSndFile_detail::T_Config::Instance().CommentUTF8(flag); }
+
+		/**
+		* @brief ADPCMの展開設定
+		*
+		* 　IMA ADPCM / Microsoft ADPCM のサウンドを読み込み時に16bit PCMへ展開して保持するかを指定できます(初期値は ON)
+		*
+		* 　OFF の場合はファイルサイズのまま保持しますが、変換、ミックス、解析は行えません
+		*
+		* 　設定はLoadSND関数の実行時に適用されます
+		*
+		* @param bool flag (false = 展開しない：true = 読み込み時に展開する)
+		*/
+		inline void SetDecodeOnLoad(bool flag) { ReadSndFile_detail::T_Config::Instance().DecodeOnLoad(flag); }
+
+		/**
+		* @brief 波形概要のキャッシュ設定
+		*
+		* 　SND::BuildWaveformAll 関数で作成した波形概要をSAELibフォルダ(エラーログと同じフォルダ)へ保存し、次回は保存した結果を使用するかを指定できます
+		*
+		* 　キャッシュは内容ハッシュ、フレーム数、チャンネル数が一致するサウンドにだけ使用されます
+		*
+		* @param bool flag (false = 毎回作成する：true = キャッシュする)
+		*/
+		inline void SetWaveformCache(bool flag) { ReadSndFile_detail::T_Config::Instance().WaveformCache(flag); }
+
+		/**
+		* @brief SNDファイルの修復設定
+		*
+		* 　サブヘッダーの次のアドレスが不正な場合やサウンドデータが壊れている場合に、次の正しいサウンドから読み取りを再開するかを指定できます(初期値は OFF)
+		*
+		* 　読み取れなかった範囲は SND::GetRecoveryReport 関数で取得できます
+		*
+		* 　設定はLoadSND関数の実行時に適用されます
+		*
+		* @param bool flag (false = 壊れた位置で読み込みを終了する：true = 読み取れるサウンドを全て読み込む)
+		*/
+		inline void SetRecoverSND(bool flag) { ReadSndFile_detail::T_Config::Instance().RecoverSND(flag); }
+
+		/**
+		* @brief サウンドデータのCRC-32の計算設定
+		*
+		* 　読み込み時にサウンドごとのWAVEデータ全体のCRC-32を求めて保持するかを指定できます(初期値は OFF)
+		*
+		* 　設定はLoadSND関数の実行時に適用されます
+		*
+		* @param bool flag (false = 求めない：true = 読み込み時に求める)
+		*/
+		inline void SetPayloadCRC(bool flag) { ReadSndFile_detail::T_Config::Instance().PayloadCRC(flag); }
+
+		/**
+		* @brief 1秒あたりのフレーム数設定
+		*
+		* 　SoundData の NumTick, SampleToTick, TickToSample 関数で引数を省略した時に使用するフレーム数を指定できます
+		*
+		* @param uint32_t TicksPerSecond 1秒あたりのフレーム数 (0 の場合は既定値の 60)
+		*/
+		inline void SetTicksPerSecond(uint32_t TicksPerSecond) { ReadSndFile_detail::T_Config::Instance().TicksPerSecond(TicksPerSecond); }
+
+		///////////////////////////////////////////////////////////////////////////////////////////////////
+		// Getter /////////////////////////////////////////////////////////////////////////////////////////
+		///////////////////////////////////////////////////////////////////////////////////////////////////
+		/**
+		* @brief エラー出力切り替え設定取得
+		*
+		* 　Config設定のエラー出力切り替え設定を取得します
+		*
+		* @return bool エラー設定出力切り替え設定(false = OFF：true = ON)
+		*/
+		inline bool GetThrowError() { return ReadSndFile_detail::T_Config::Instance().ThrowError(); }
+
+		/**
+		* @brief エラーログファイルを作成設定取得
+		*
+		* 　Config設定のエラーログファイルを作成設定を取得します
+		*
+		* @return bool エラーログファイルを作成設定(false = OFF：true = ON)
+		*/
+		inline bool GetCreateLogFile() { return ReadSndFile_detail::T_Config::Instance().CreateLogFile(); }
+
+		/**
+		* @brief SAELibフォルダを作成設定取得
+		*
+		* 　Config設定のSAELibフォルダを作成設定を取得します
+		*
+		* @return bool SAELibフォルダを作成設定(false = OFF：true = ON)
+		*/
+		inline bool GetCreateSAELibFile() { return ReadSndFile_detail::T_Config::Instance().CreateSAELibFile(); }
+
+		/**
+		* @brief サウンドデータの共有設定取得
+		*
+		* 　Config設定のサウンドデータの共有設定を取得します
+		*
+		* @return bool サウンドデータの共有設定(false = OFF：true = ON)
+		*/
+		inline bool GetShareSoundPool() { return ReadSndFile_detail::T_Config::Instance().ShareSoundPool(); }
+
+		/**
+		* @brief コメントのUTF-8変換設定取得
+		*
+		* 　Config設定のコメントのUTF-8変換設定を取得します
+		*
+		* @return bool コメントのUTF-8変換設定(false = OFF：true = ON)
+		*/
+		inline bool GetCommentUTF8() { return ReadSndFile_detail::T_Config::Instance().CommentUTF8(); }
+
+		/**
+		* @brief ADPCMの展開設定取得
+		*
+		* 　Config設定のADPCMの展開設定を取得します
+		*
+		* @return bool ADPCMの展開設定(false = OFF：true = ON)
+		*/
+		inline bool GetDecodeOnLoad() { return ReadSndFile_detail::T_Config::Instance().DecodeOnLoad(); }
+
+		/**
+		* @brief 波形概要のキャッシュ設定取得
+		*
+		* 　Config設定の波形概要のキャッシュ設定を取得します
+		*
+		* @return bool 波形概要のキャッシュ設定(false = OFF：true = ON)
+		*/
+		inline bool GetWaveformCache() { return ReadSndFile_detail::T_Config::Instance().WaveformCache(); }
+
+		/**
+		* @brief SNDファイルの修復設定取得
+		*
+		* 　Config設定のSNDファイルの修復設定を取得します
+		*
+		* @return bool SNDファイルの修復設定(false = OFF：true = ON)
+		*/
+		inline bool GetRecoverSND() { return ReadSndFile_detail::T_Config::Instance().RecoverSND(); }
+
+		/**
+		* @brief サウンドデータのCRC-32の計算設定取得
+		*
+		* 　Config設定のサウンドデータのCRC-32の計算設定を取得します
+		*
+		* @return bool サウンドデータのCRC-32の計算設定(false = OFF：true = ON)
+		*/
+		inline bool GetPayloadCRC() { return ReadSndFile_detail::T_Config::Instance().PayloadCRC(); }
+
+		/**
+		* @brief 1秒あたりのフレーム数設定取得
+		*
+		* 　Config設定の1秒あたりのフレーム数を取得します
+		*
+		* @return uint32_t TicksPerSecond 1秒あたりのフレーム数
+		*/
+		inline uint32_t GetTicksPerSecond() { return ReadSndFile_detail::T_Config::Instance().TicksPerSecond(); }
+
+		/**
+		* @brief Config設定取得
+		*
+		* 　Config設定のフラグをまとめて取得します
+		*
+		* @return int32_t Config設定
+		*/
+		inline int32_t GetConfigFlag() { return ReadSndFile_detail::T_Config::Instance().BitFlag(); }
+
+		/**
+		* @brief SAELibフォルダを作成パス取得
+		*
+		* 　Config設定のSAELibフォルダを作成パスを取得します
+		*
+		* @return const std::filesystem::path& SAELibフォルダを作成パス
+		*/
+		inline const std::filesystem::path& GetSAELibFilePath() { return ReadSndFile_detail::T_Config::Instance().SAELibFilePath(); }
+
+		/**
+		* @brief SNDファイルの検索パス取得
+		*
+		* 　Config設定のSNDファイルの検索パスを取得します
+		*
+		* @return const std::filesystem::path& SNDファイルの検索パス
+		*/
+		inline const std::filesystem::path& GetSNDSearchPath() { return ReadSndFile_detail::T_Config::Instance().SNDSearchPath(); }
+	}
+
+	/**
+	* @brief ReadSndFileのサウンドプール空間
+	*
+	* 　SNDConfig::SetShareSoundPool が ON の場合に複数のSNDで共有されるサウンドデータを扱います
+	*/
+	namespace SNDSoundPool {
+		/**
+		* @brief 共有サウンド数を取得
+		*
+		* 　サウンドプールが保持している共有サウンドの数を返します
+		*
+		* @return size_t NumSound 共有サウンド数
+		*/
+		inline size_t NumSound() { return ReadSndFile_detail::T_SoundPool::Instance().NumSound(); }
+
+		/**
+		* @brief 共有サウンドのデータサイズを取得
+		*
+		* 　サウンドプールが保持している共有サウンドの合計データサイズを返します
+		*
+		* @return size_t SoundPoolSize 共有サウンドのデータサイズ
+		*/
+		inline size_t size() { return ReadSndFile_detail::T_SoundPool::Instance().size(); }
+
+		/**
+		* @brief サウンドプールの整理
+		*
+		* 　どのSNDからも参照されなくなったサウンドをサウンドプールから取り除きます
+		*/
+		inline void shrink_to_fit() { ReadSndFile_detail::T_SoundPool::Instance().shrink_to_fit(); }
+	}
+
+	/**
+	* @brief ReadSndFileのメモリ使用量管理空間
+	*
+	* 　全SNDのサウンドデータ使用量と、Prefetch関数で物理メモリへ固定したサイズを扱います
+	*/
+	namespace SNDResidency {
+		/**
+		* @brief 固定サイズの上限を設定/取得
+		*
+		* 　全SNDで固定するサウンドデータの合計サイズの上限を設定します(初期値は 0 = 無制限)
+		*
+		* 　上限を超えた場合は全SNDの中で最も古く先読みしたグループから固定を解除します
+		*
+		* @param size_t Size 上限サイズ
+		* @return size_t Size 上限サイズ
+		*/
+		inline void SetBudget(size_t Size) { ReadSndFile_detail::T_Residency::Instance().Budget(Size); }
+		inline size_t GetBudget() { return ReadSndFile_detail::T_Residency::Instance().Budget(); }
+
+		/**
+		* @brief サウンドデータ使用量を取得
+		*
+		* 　全SNDが保持しているサウンドデータの合計サイズ(共有サウンドは1回だけ数える)と、その最大値を返します
+		*
+		* @return size_t Size 使用量
+		*/
+		inline size_t size() { return ReadSndFile_detail::T_Residency::Instance().size(); }
+		inline size_t peak() { return ReadSndFile_detail::T_Residency::Instance().peak(); }
+
+		/**
+		* @brief 固定サイズを取得
+		*
+		* 　物理メモリへ固定しているページの合計サイズと、その最大値を返します
+		*
+		* @return size_t Size 固定サイズ
+		*/
+		inline size_t LockSize() { return ReadSndFile_detail::T_Residency::Instance().LockSize(); }
+		inline size_t LockPeak() { return ReadSndFile_detail::T_Residency::Instance().LockPeak(); }
+
+		/**
+		* @brief 管理しているSND数を取得
+		*
+		* @return size_t NumSND SND数
+		*/
+		inline size_t NumSND() { return ReadSndFile_detail::T_Residency::Instance().NumSND(); }
+
+		/**
+		* @brief 最大値の初期化
+		*
+		* 　使用量と固定サイズの最大値を現在の値に戻します
+		*/
+		inline void ResetPeak() { ReadSndFile_detail::T_Residency::Instance().ResetPeak(); }
+	}
+} // namespace SAELib
 #endif
\ No newline at end of file
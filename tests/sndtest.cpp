@@ -0,0 +1,874 @@
+// sndtest - h_ReadSndFile.h ̉AeXg
+//
+// ꎞtH_ɃeXgpSNDt@C𐶐āACu̓؂
+// s؂\A1łsꍇ͏IR[h 1 Ԃ
+//
+// g:
+//   sndtest [TestName]...   eXgw肵ꍇ͂̃eXĝݎs
+//
+// rh:
+//   g++ -std=c++17 -O2 -pthread tests/sndtest.cpp -o sndtest
+//   cl /std:c++17 /O2 /EHsc tests\sndtest.cpp
+
+#include "../h_ReadSndFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// mۗʂ̌v ///////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+// SNDResidency ̓TEhf[^݂̂𐔂邽߁AƗp̗̈܂߂SĂ̊mۗʂ operator new Ő
+namespace AllocCounter {
+	constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+	std::atomic<size_t> Current{ 0 };
+	std::atomic<size_t> Peak{ 0 };
+
+	void* Allocate(size_t Size) noexcept {
+		unsigned char* const Ptr = static_cast<unsigned char*>(std::malloc(Size + kHeaderSize));
+		if (!Ptr) { return nullptr; }
+		*reinterpret_cast<size_t*>(Ptr) = Size;
+		const size_t Used = Current.fetch_add(Size) + Size;
+		size_t Max = Peak.load();
+		while (Used > Max && !Peak.compare_exchange_weak(Max, Used)) {}
+		return Ptr + kHeaderSize;
+	}
+
+	void Deallocate(void* Ptr) noexcept {
+		if (!Ptr) { return; }
+		unsigned char* const Head = static_cast<unsigned char*>(Ptr) - kHeaderSize;
+		Current.fetch_sub(*reinterpret_cast<size_t*>(Head));
+		std::free(Head);
+	}
+
+	// ݂̊mۗʂɂčől𐔂
+	size_t ResetPeak() noexcept {
+		const size_t Base = Current.load();
+		Peak.store(Base);
+		return Base;
+	}
+}
+
+void* operator new(std::size_t Size) {
+	if (void* Ptr = AllocCounter::Allocate(Size)) { return Ptr; }
+	throw std::bad_alloc();
+}
+void* operator new[](std::size_t Size) {
+	if (void* Ptr = AllocCounter::Allocate(Size)) { return Ptr; }
+	throw std::bad_alloc();
+}
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept { return AllocCounter::Allocate(Size); }
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept { return AllocCounter::Allocate(Size); }
+void operator delete(void* Ptr) noexcept { AllocCounter::Deallocate(Ptr); }
+void operator delete[](void* Ptr) noexcept { AllocCounter::Deallocate(Ptr); }
+void operator delete(void* Ptr, std::size_t) noexcept { AllocCounter::Deallocate(Ptr); }
+void operator delete[](void* Ptr, std::size_t) noexcept { AllocCounter::Deallocate(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { AllocCounter::Deallocate(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { AllocCounter::Deallocate(Ptr); }
+
+namespace {
+	using namespace SAELib;
+	namespace detail = SAELib::ReadSndFile_detail;
+	namespace fs = std::filesystem;
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	//  ///////////////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	int NumFailure = 0;
+
+	void Check(bool Result, const char* Expression, int Line) {
+		if (!Result) {
+			++NumFailure;
+			std::cerr << "  FAILED (line " << Line << "): " << Expression << "\n";
+		}
+	}
+
+#define SNDTEST_CHECK(expr) Check(static_cast<bool>(expr), #expr, __LINE__)
+
+	// L^ꂽG[ɑΏۂID܂܂鐔
+	size_t CountError(int32_t ID) {
+		size_t Count = 0;
+		for (size_t index = 0; index < SNDError::NumError(); ++index) {
+			if (SNDError::GetErrorID(index) == ID) { ++Count; }
+		}
+		return Count;
+	}
+
+	// dǂݍݍς݂̃TEh
+	int32_t NumSound(const SND& SNDData) {
+		int32_t Count = 0;
+		while (SNDData.ExistSoundDataIndex(Count)) { ++Count; }
+		return Count;
+	}
+
+	std::string CommentText(const SND::SoundData& Data) {
+		return reinterpret_cast<const char*>(Data.Comment());
+	}
+
+	std::vector<float> Decode(const SND::SoundData& Data) {
+		std::vector<float> Samples(size_t{ Data.NumFrame() } * std::max(1, Data.Channel()));
+		Samples.resize(size_t{ Data.DecodeSamples(Samples.data(), 0, Data.NumFrame()) } * std::max(1, Data.Channel()));
+		return Samples;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	// eXgpSNDt@C̐ ////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	struct T_WaveSpec {
+		uint16_t Channel = 1;
+		uint32_t Hz = 11025;
+		uint16_t Bit = 16;
+		uint32_t NumFrame = 100;
+		uint32_t Seed = 0;
+		bool Silent = false;                    // (k₷f[^)
+		bool Fact = false;                      // fact`N
+		bool OddData = false;                   // data`NTCYɂ
+		bool OddChunk = false;                  // fmťɊTCY̕sȃ`Nu
+		std::optional<std::string> Comment;     // SAEC`N(ȗ̓`NȂ)
+	};
+
+	struct T_Entry {
+		int32_t GroupNo = 0;
+		int32_t ItemNo = 0;
+		std::vector<unsigned char> WAVE;
+	};
+
+	void AppendChunk(std::vector<unsigned char>& Dst, const char* ID, const std::vector<unsigned char>& Data) {
+		const size_t Pos = Dst.size();
+		Dst.resize(Pos + 8);
+		std::memcpy(&Dst[Pos], ID, 4);
+		detail::EncodeEndian::UInt32LE(&Dst[Pos + 4], static_cast<uint32_t>(Data.size()));
+		Dst.insert(Dst.end(), Data.begin(), Data.end());
+		// `N2oCgEɑ
+		if (Data.size() & 1) { Dst.push_back(0); }
+	}
+
+	std::vector<unsigned char> MakeWAVE(const T_WaveSpec& Spec) {
+		const uint16_t BlockAlign = static_cast<uint16_t>(Spec.Channel * Spec.Bit / 8);
+
+		std::vector<unsigned char> fmt(16);
+		detail::EncodeEndian::UInt16LE(&fmt[0], 1);
+		detail::EncodeEndian::UInt16LE(&fmt[2], Spec.Channel);
+		detail::EncodeEndian::UInt32LE(&fmt[4], Spec.Hz);
+		detail::EncodeEndian::UInt32LE(&fmt[8], Spec.Hz * BlockAlign);
+		detail::EncodeEndian::UInt16LE(&fmt[12], BlockAlign);
+		detail::EncodeEndian::UInt16LE(&fmt[14], Spec.Bit);
+
+		std::vector<unsigned char> data(size_t{ Spec.NumFrame } * BlockAlign);
+		if (!Spec.Silent) {
+			for (size_t index = 0; index < data.size(); ++index) {
+				data[index] = static_cast<unsigned char>(index * 7 + Spec.Seed * 13 + (Spec.Seed >> 8) * 3);
+			}
+		}
+		if (Spec.OddData) { data.push_back(1); }
+
+		std::vector<unsigned char> WAVE(12);
+		std::memcpy(&WAVE[0], "RIFF", 4);
+		std::memcpy(&WAVE[8], "WAVE", 4);
+		AppendChunk(WAVE, "fmt ", fmt);
+		if (Spec.Fact) {
+			std::vector<unsigned char> fact(4);
+			detail::EncodeEndian::UInt32LE(&fact[0], Spec.NumFrame);
+			AppendChunk(WAVE, "fact", fact);
+		}
+		if (Spec.OddChunk) {
+			AppendChunk(WAVE, "junk", { 'o', 'd', 'd' });
+		}
+		AppendChunk(WAVE, "data", data);
+		if (Spec.Comment) {
+			std::vector<unsigned char> SAEC(Spec.Comment->begin(), Spec.Comment->end());
+			SAEC.push_back(0);
+			AppendChunk(WAVE, "SAEC", SAEC);
+		}
+		detail::EncodeEndian::UInt32LE(&WAVE[4], static_cast<uint32_t>(WAVE.size() - 8));
+		return WAVE;
+	}
+
+	std::vector<unsigned char> MakeSND(const std::vector<T_Entry>& EntryList, uint32_t Version = detail::SNDFormat::kSNDVersion) {
+		std::vector<unsigned char> SNDFile(detail::SNDFormat::kSubHeaderStart);
+		std::memcpy(&SNDFile[0], "ElecbyteSnd", 12);
+		detail::EncodeEndian::UInt32BE(&SNDFile[12], Version);
+		detail::EncodeEndian::UInt32LE(&SNDFile[16], static_cast<uint32_t>(EntryList.size()));
+		detail::EncodeEndian::UInt32LE(&SNDFile[20], detail::SNDFormat::kSubHeaderStart);
+
+		for (const auto& Entry : EntryList) {
+			const size_t Pos = SNDFile.size();
+			SNDFile.resize(Pos + 16);
+			detail::EncodeEndian::UInt32LE(&SNDFile[Pos], static_cast<uint32_t>(Pos + 16 + Entry.WAVE.size()));
+			detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 4], static_cast<uint32_t>(Entry.WAVE.size()));
+			detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 8], static_cast<uint32_t>(Entry.GroupNo));
+			detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 12], static_cast<uint32_t>(Entry.ItemNo));
+			SNDFile.insert(SNDFile.end(), Entry.WAVE.begin(), Entry.WAVE.end());
+		}
+		return SNDFile;
+	}
+
+	// Tuwb_[HăTEhԍƃTEhf[^o
+	std::vector<T_Entry> ParseSND(const std::vector<unsigned char>& Binary) {
+		std::vector<T_Entry> EntryList;
+		if (Binary.size() < detail::SNDFormat::kSubHeaderStart) { return EntryList; }
+
+		const uint32_t NumEntry = detail::DecodeEndian::UInt32LE(&Binary[16]);
+		size_t Pos = detail::DecodeEndian::UInt32LE(&Binary[20]);
+		for (uint32_t index = 0; index < NumEntry && Pos + 16 <= Binary.size(); ++index) {
+			const size_t Size = detail::DecodeEndian::UInt32LE(&Binary[Pos + 4]);
+			if (Pos + 16 + Size > Binary.size()) { break; }
+
+			T_Entry Entry;
+			Entry.GroupNo = static_cast<int32_t>(detail::DecodeEndian::UInt32LE(&Binary[Pos + 8]));
+			Entry.ItemNo = static_cast<int32_t>(detail::DecodeEndian::UInt32LE(&Binary[Pos + 12]));
+			Entry.WAVE.assign(Binary.begin() + Pos + 16, Binary.begin() + Pos + 16 + Size);
+			EntryList.push_back(std::move(Entry));
+			Pos = detail::DecodeEndian::UInt32LE(&Binary[Pos]);
+		}
+		return EntryList;
+	}
+
+	fs::path TestFolder;
+
+	std::string WriteFixture(const std::string& FileName, const std::vector<unsigned char>& Binary) {
+		std::ofstream File(TestFolder / FileName, std::ios::binary | std::ios::trunc);
+		File.write(reinterpret_cast<const char*>(Binary.data()), static_cast<std::streamsize>(Binary.size()));
+		return FileName;
+	}
+
+	std::vector<unsigned char> ReadFixture(const std::string& FileName) {
+		std::ifstream File(TestFolder / FileName, std::ios::binary);
+		return std::vector<unsigned char>(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>());
+	}
+
+	// dԍ/dTEhf[^/̔ԍ/TCỸ`N/SAECfact̂ȂTEh܂SND
+	std::vector<T_Entry> BasicEntryList() {
+		T_WaveSpec Hello;
+		Hello.Comment = "hello";
+
+		T_WaveSpec Stereo;
+		Stereo.Channel = 2;
+		Stereo.Seed = 1;
+		Stereo.Fact = true;
+		Stereo.Comment = "stereo";
+
+		T_WaveSpec Other;
+		Other.Seed = 3;
+		Other.Comment = "skipped";
+
+		T_WaveSpec Negative;
+		Negative.Bit = 8;
+		Negative.Seed = 4;
+		Negative.OddData = true;
+		Negative.Comment = "negative";
+
+		T_WaveSpec Odd;
+		Odd.Seed = 5;
+		Odd.OddChunk = true;
+		Odd.Comment = "odd";
+
+		T_WaveSpec Plain;
+		Plain.Seed = 6;
+		Plain.NumFrame = 77;
+
+		return {
+			{ 0, 0, MakeWAVE(Hello) },
+			{ 0, 1, MakeWAVE(Stereo) },
+			{ 5, 0, MakeWAVE(Hello) },      // (0,0)ƓTEhf[^
+			{ 5, 0, MakeWAVE(Other) },      // ԍ̏d(ǂݔ΂)
+			{ -1, -2, MakeWAVE(Negative) },
+			{ 9000, 0, MakeWAVE(Odd) },
+			{ 1, 0, MakeWAVE(Plain) },
+		};
+	}
+
+	// ԍ̏dTEh
+	constexpr int32_t kBasicNumSound = 6;
+
+	// 8oCg̃yC[h̓WJ̃TCY 0xF0000000 ƂkSNDt@C
+	std::vector<unsigned char> MakeRawSizeSND() {
+		std::vector<unsigned char> Binary(detail::SNDFormat::kCompressedHeaderSize + 12 + 12 + 8, 0x11);
+		std::memcpy(&Binary[0], detail::SNDFormat::kCompressedSignature.data(), detail::SNDFormat::kCompressedSignature.size());
+		detail::EncodeEndian::UInt32LE(&Binary[12], detail::SNDFormat::kCompressedVersion);
+		detail::EncodeEndian::UInt32LE(&Binary[16], 1);
+		detail::EncodeEndian::UInt32LE(&Binary[20], 1);
+		detail::EncodeEndian::UInt32LE(&Binary[24], 0);
+		detail::EncodeEndian::UInt32LE(&Binary[28], 0);
+		detail::EncodeEndian::UInt32LE(&Binary[32], 0);
+		detail::EncodeEndian::UInt32LE(&Binary[36], 48);
+		detail::EncodeEndian::UInt32LE(&Binary[40], 8);
+		detail::EncodeEndian::UInt32LE(&Binary[44], 0xF0000000);
+		return Binary;
+	}
+
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	// eXg /////////////////////////////////////////////////////////////////////////////////////////
+	///////////////////////////////////////////////////////////////////////////////////////////////////
+	// 2SNDTEhԍɓTEh
+	void CheckSameSND(const SND& Expected, SND& SNDData) {
+		SNDTEST_CHECK(NumSound(SNDData) == NumSound(Expected));
+		for (int32_t index = 0; Expected.ExistSoundDataIndex(index); ++index) {
+			const auto Data = Expected.GetSoundDataIndex(index);
+			const auto Loaded = SNDData.GetSoundData(Data.GroupNo(), Data.ItemNo());
+			SNDTEST_CHECK(!Loaded.IsDummy());
+			SNDTEST_CHECK(Loaded.Channel() == Data.Channel() && Loaded.Hz() == Data.Hz() && Loaded.Bit() == Data.Bit());
+			SNDTEST_CHECK(Loaded.ByteSize() == Data.ByteSize() && CommentText(Loaded) == CommentText(Data));
+			SNDTEST_CHECK(Loaded.ContentHash() == Data.ContentHash());
+			SNDTEST_CHECK(Decode(Loaded) == Decode(Data));
+		}
+	}
+
+	void CheckBasicSND(SND& SNDData) {
+		SNDTEST_CHECK(NumSound(SNDData) == kBasicNumSound);
+
+		const auto Hello = SNDData.GetSoundData(0, 0);
+		SNDTEST_CHECK(Hello.CommentView() == "hello");
+		SNDTEST_CHECK(Hello.Channel() == 1 && Hello.Hz() == 11025 && Hello.Bit() == 16 && Hello.NumFrame() == 100);
+
+		// TEhf[^͋LAdԍ͐ɓo^TEhc
+		const auto Shared = SNDData.GetSoundData(5, 0);
+		SNDTEST_CHECK(Shared.CommentView() == "hello");
+		SNDTEST_CHECK(Shared.ContentHash() == Hello.ContentHash());
+		SNDTEST_CHECK(Shared.Comment() == Hello.Comment());
+
+		const auto Stereo = SNDData.GetSoundData(0, 1);
+		SNDTEST_CHECK(Stereo.Channel() == 2 && Stereo.NumFrame() == 100 && Stereo.CommentView() == "stereo");
+
+		// ̔ԍ
+		const auto Negative = SNDData.GetSoundData(-1, -2);
+		SNDTEST_CHECK(!Negative.IsDummy());
+		SNDTEST_CHECK(Negative.GroupNo() == -1 && Negative.ItemNo() == -2);
+		SNDTEST_CHECK(Negative.Bit() == 8 && Negative.ByteSize() == 101 && Negative.CommentView() == "negative");
+		SNDTEST_CHECK(SNDData.FindSoundData(detail::Convert::EncodeSoundNumber(-1, -2)).ContentHash() == Negative.ContentHash());
+
+		// TCỸ`Ň̃`N
+		const auto Odd = SNDData.GetSoundData(9000, 0);
+		SNDTEST_CHECK(Odd.CommentView() == "odd" && Odd.NumFrame() == 100);
+
+		// SAECfact̂ȂTEh
+		const auto Plain = SNDData.GetSoundData(1, 0);
+		SNDTEST_CHECK(!Plain.IsDummy() && Plain.CommentView().empty() && Plain.NumFrame() == 77);
+		SNDTEST_CHECK(Decode(Plain).size() == 77);
+
+		SNDTEST_CHECK(SNDData.GetSoundData(7, 7).IsDummy());
+	}
+
+	void TestLoad() {
+		const std::string FileName = WriteFixture("basic.snd", MakeSND(BasicEntryList()));
+
+		SND SNDData;
+		SNDTEST_CHECK(SNDData.LoadSND(FileName, TestFolder.string()));
+		SNDTEST_CHECK(CountError(SNDError::Warning_DuplicateSoundNumber) == 1);
+		SNDTEST_CHECK(SNDError::NumError() == 1);
+		CheckBasicSND(SNDData);
+	}
+
+	// sWAVEf[^̓TEhƂ1񂾂G[L^
+	void TestInvalidWAVE() {
+		T_WaveSpec Spec;
+		std::vector<unsigned char> RIFX = MakeWAVE(Spec);
+		RIFX[3] = 'X';
+		Spec.Seed = 1;
+		std::vector<unsigned char> WAVX = MakeWAVE(Spec);
+		WAVX[11] = 'X';
+
+		for (bool Share : { false, true }) {
+			SNDConfig::SetShareSoundPool(Share);
+			SNDError::ClearError();
+			SND SNDData;
+			SNDTEST_CHECK(SNDData.LoadSND(WriteFixture("invalid.snd", MakeSND({ { 0, 0, RIFX }, { 0, 1, WAVX } })), TestFolder.string()));
+			SNDTEST_CHECK(CountError(SNDError::Invalid_RIFFSignature) == 1);
+			SNDTEST_CHECK(CountError(SNDError::Invalid_WAVEFormat) == 1);
+			SNDTEST_CHECK(SNDError::NumError() == 2);
+		}
+		SNDConfig::SetShareSoundPool(false);
+	}
+
+	// sȃ`ÑTCY傫ꍇ`N̑IA܂ł̃`N͓ǂݍ܂
+	void TestChunkSize() {
+		for (uint32_t ChunkSize : { 0xFFFFFFF7u, 0xFFFFFFF8u, 0xFFFFFF00u, 0x7FFFFFF8u }) {
+			T_WaveSpec Spec;
+			Spec.Comment = "chunk";
+			std::vector<unsigned char> WAVE = MakeWAVE(Spec);
+			const size_t Pos = WAVE.size();
+			WAVE.resize(Pos + 8);
+			std::memcpy(&WAVE[Pos], "junk", 4);
+			detail::EncodeEndian::UInt32LE(&WAVE[Pos + 4], ChunkSize);
+			detail::EncodeEndian::UInt32LE(&WAVE[4], static_cast<uint32_t>(WAVE.size() - 8));
+
+			SND SNDData;
+			SNDTEST_CHECK(SNDData.LoadSND(WriteFixture("chunksize.snd", MakeSND({ { 0, 0, WAVE } })), TestFolder.string()));
+			const auto Data = SNDData.GetSoundData(0, 0);
+			SNDTEST_CHECK(Data.NumFrame() == 100 && Data.CommentView() == "chunk");
+		}
+	}
+
+	void TestVersion2() {
+		const std::string FileName = WriteFixture("version2.snd", MakeSND(BasicEntryList(), detail::SNDFormat::kSNDVersion2));
+
+		SND SNDData;
+		SNDTEST_CHECK(SNDData.LoadSND(FileName, TestFolder.string()));
+		CheckBasicSND(SNDData);
+
+		SND Basic;
+		SNDTEST_CHECK(Basic.LoadSND(WriteFixture("basic.snd", MakeSND(BasicEntryList())), TestFolder.string()));
+		SNDTEST_CHECK(SNDData.ContentHash() == Basic.ContentHash());
+	}
+
+	void TestSoundNumber() {
+		const int32_t NumberList[] = { 0, 1, -1, -2, INT32_MAX, INT32_MIN, 9000 };
+		for (int32_t GroupNo : NumberList) {
+			for (int32_t ItemNo : NumberList) {
+				const int64_t SoundNumber = detail::Convert::EncodeSoundNumber(GroupNo, ItemNo);
+				SNDTEST_CHECK(detail::Convert::DecodeSoundGroupNo(SoundNumber) == GroupNo);
+				SNDTEST_CHECK(detail::Convert::DecodeSoundItemNo(SoundNumber) == ItemNo);
+			}
+		}
+		SNDTEST_CHECK(detail::Convert::EncodeSoundNumber(-1, 0) != detail::Convert::EncodeSoundNumber(0, -1));
+	}
+
+	// ǉG[ID͖ɕсÃG[ID̒l͕ςȂ
+	void TestErrorID() {
+		const char* const BaseNameList[] = {
+			"NotFound_SNDFile", "NotFound_SoundNumber", "NotFound_SoundIndex", "Invalid_SNDExtension", "Invalid_LoadSNDPath",
+			"Invalid_SNDSearchPath", "Invalid_EmptySNDFilePath", "Invalid_SNDFileSize", "Invalid_SNDSignature", "Invalid_RIFFSignature",
+			"Invalid_WAVEFormat", "Invalid_SAELibFolderPath", "Failed_OpenSNDFile", "Failed_CreateSAELibFolder", "Failed_CreateErrorLogFile",
+			"Failed_WriteErrorLogFile", "Failed_CloseErrorLogFile", "Failed_CreateExportWAVFolder", "Failed_CreateWAVFile", "Failed_WriteWAVFile",
+			"Failed_CloseWAVFile", "Corrupted_SNDFile", "Warning_DuplicateSoundNumber",
+		};
+		SNDTEST_CHECK(SNDError::ErrorInfoSize >= std::size(BaseNameList));
+		for (size_t index = 0; index < std::size(BaseNameList) && index < SNDError::ErrorInfoSize; ++index) {
+			SNDTEST_CHECK(std::strcmp(SNDError::ErrorName(static_cast<int32_t>(index)), BaseNameList[index]) == 0);
+		}
+		for (size_t index = 0; index < SNDError::ErrorInfoSize; ++index) {
+			SNDTEST_CHECK(SNDError::ErrorInfo[index].ID == static_cast<int32_t>(index));
+		}
+		SNDTEST_CHECK(SNDError::Failed_OpenSNDFile == 12 && SNDError::Corrupted_SNDFile == 21 && SNDError::Warning_DuplicateSoundNumber == 22);
+	}
+
+	// rŐ؂ꂽt@C͉ꂽt@CƂĕ񍐂Aǂݍ߂TEh͌̃t@Cƈv
+	// (Cݒ肪 OFF ̏ꍇ̓t@CŐ؂ꂽTEhǂݍ܂邽߁AǂݎȂ͈͂̃TEĥ݈vȂĂ悢)
+	void TestTruncated() {
+		const std::vector<unsigned char> Binary = MakeSND(BasicEntryList());
+		SND Basic;
+		SNDTEST_CHECK(Basic.LoadSND(WriteFixture("basic.snd", Binary), TestFolder.string()));
+
+		const size_t FirstEntry = detail::SNDFormat::kSubHeaderStart;
+		const size_t CutList[] = { 0, 16, FirstEntry - 1, FirstEntry, FirstEntry + 8, FirstEntry + 16 + 20, Binary.size() / 2, Binary.size() - 1 };
+		for (bool Recover : { false, true }) {
+			SNDConfig::SetRecoverSND(Recover);
+			for (size_t Cut : CutList) {
+				const std::string FileName = WriteFixture("truncated.snd", std::vector<unsigned char>(Binary.begin(), Binary.begin() + Cut));
+				SNDError::ClearError();
+
+				SND SNDData;
+				if (!SNDData.LoadSND(FileName, TestFolder.string())) {
+					SNDTEST_CHECK(SNDError::NumError() > 0);
+					continue;
+				}
+
+				// Tuwb_[̋EŐ؂ꂽꍇ͓ǂݎȂ͈͂ȂATEĥ݂Ȃ
+				const auto& Report = SNDData.GetRecoveryReport();
+				const std::optional<SND::RecoveryReport::LostRange> Lost = (Report.LostRangeList.empty() ? std::nullopt : std::make_optional(Report.LostRangeList.back()));
+				SNDTEST_CHECK(Report.IsCorrupted());
+				SNDTEST_CHECK(!Lost || Lost->End == Cut);
+				SNDTEST_CHECK(!Recover || CountError(SNDError::Warning_RecoveredSNDFile) == 1);
+
+				for (int32_t index = 0; SNDData.ExistSoundDataIndex(index); ++index) {
+					const auto Data = SNDData.GetSoundDataIndex(index);
+					if (!Recover && Lost && Lost->HasSoundNumber && Lost->GroupNo == Data.GroupNo() && Lost->ItemNo == Data.ItemNo()) { continue; }
+
+					const auto Original = Basic.GetSoundData(Data.GroupNo(), Data.ItemNo());
+					SNDTEST_CHECK(Data.ContentHash() == Original.ContentHash());
+					SNDTEST_CHECK(Decode(Data) == Decode(Original));
+				}
+			}
+		}
+		SNDConfig::SetRecoverSND(false);
+	}
+
+	// ǂݍݒƓǂݍ݌̑SĂ̊mۗʂt@CTCŸ{Ɏ܂
+	void TestMemory() {
+		constexpr double kPeakFactor = 3.0;
+		constexpr double kResidentFactor = 1.5;
+
+		std::vector<T_Entry> EntryList;
+		for (int32_t index = 0; index < 4000; ++index) {
+			T_WaveSpec Spec;
+			Spec.NumFrame = 1000 + static_cast<uint32_t>(index % 100);
+			Spec.Seed = static_cast<uint32_t>(index % 3000);
+			Spec.Comment = "memory";
+			EntryList.push_back({ index / 100, index % 100, MakeWAVE(Spec) });
+		}
+		const std::vector<unsigned char> Binary = MakeSND(EntryList);
+		const std::string FileName = WriteFixture("memory.snd", Binary);
+		EntryList.clear();
+		EntryList.shrink_to_fit();
+
+		const size_t FileSize = Binary.size();
+		const size_t Base = AllocCounter::ResetPeak();
+		{
+			SND SNDData;
+			SNDTEST_CHECK(SNDData.LoadSND(FileName, TestFolder.string()));
+			SNDTEST_CHECK(NumSound(SNDData) == 4000);
+
+			const size_t Peak = AllocCounter::Peak.load() - Base;
+			const size_t Resident = AllocCounter::Current.load() - Base;
+			std::cout << "  file " << FileSize << " bytes, peak " << Peak << " bytes (x" << double(Peak) / FileSize
+				<< "), resident " << Resident << " bytes (x" << double(Resident) / FileSize << ")\n";
+			SNDTEST_CHECK(Peak <= FileSize * kPeakFactor);
+			SNDTEST_CHECK(Resident <= FileSize * kResidentFactor);
+		}
+		SNDSoundPool::shrink_to_fit();
+	}
+
+	// TEhԍ̌(o^ς/o^)TEhɔႵȂ
+	void TestLookup() {
+		constexpr int32_t kSmallSound = 256;
+		constexpr int32_t kLargeSound = 65536;
+		constexpr size_t kNumLookup = size_t{ 1 } << 20;
+		constexpr double kMaxRatio = 8.0;
+
+		// 1񂠂̌(ns)̍ŏl
+		auto Measure = [](int32_t NumSound) {
+			std::vector<T_Entry> EntryList;
+			for (int32_t index = 0; index < NumSound; ++index) {
+				T_WaveSpec Spec;
+				Spec.NumFrame = 4;
+				Spec.Seed = static_cast<uint32_t>(index);
+				EntryList.push_back({ index / 64 * 1000 - 5000, index % 64, MakeWAVE(Spec) });
+			}
+			SND SNDData;
+			SNDTEST_CHECK(SNDData.LoadSND(WriteFixture("lookup.snd", MakeSND(EntryList)), TestFolder.string()));
+
+			std::vector<std::pair<int32_t, int32_t>> KeyList(kNumLookup);
+			std::mt19937 Random(12345);
+			for (size_t index = 0; index < KeyList.size(); ++index) {
+				const auto& Entry = EntryList[Random() % EntryList.size()];
+				KeyList[index] = { Entry.GroupNo, Entry.ItemNo + (index & 1 ? 64 : 0) };
+			}
+
+			double Best = 0;
+			for (int Repeat = 0; Repeat < 5; ++Repeat) {
+				size_t NumFound = 0;
+				const auto Start = std::chrono::steady_clock::now();
+				for (const auto& Key : KeyList) {
+					NumFound += SNDData.ExistSoundNumber(Key.first, Key.second);
+				}
+				const double Time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - Start).count() / kNumLookup;
+				SNDTEST_CHECK(NumFound == kNumLookup / 2);
+				Best = (Repeat ? std::min(Best, Time) : Time);
+			}
+			return Best;
+		};
+
+		const double Small = Measure(kSmallSound);
+		const double Large = Measure(kLargeSound);
+		std::cout << "  " << kSmallSound << " sounds " << Small << " ns, " << kLargeSound << " sounds " << Large << " ns\n";
+		SNDTEST_CHECK(Large <= std::max(Small, 1.0) * kMaxRatio);
+	}
+
+	// SNDWriter ŏot@C͓ǂݍ񂾃TEhf[^̂܂܎AǂݍݒƓeɂȂ
+	void TestWriter() {
+		const std::vector<T_Entry> EntryList = BasicEntryList();
+		SND Basic;
+		SNDTEST_CHECK(Basic.LoadSND(WriteFixture("basic.snd", MakeSND(EntryList)), TestFolder.string()));
+		SNDTEST_CHECK(NumSound(Basic) == kBasicNumSound);
+
+		for (bool Repack : { false, true }) {
+			SNDWriter Writer(Basic);
+			if (Repack) { Writer.Repack(); }
+			SNDError::ClearError();
+			SNDTEST_CHECK(Writer.WriteSND("written.snd", TestFolder.string()));
+
+			// dԍ͐ɓo^TEĥ݂o
+			const std::vector<T_Entry> WrittenList = ParseSND(ReadFixture("written.snd"));
+			SNDTEST_CHECK(WrittenList.size() == kBasicNumSound);
+			for (const auto& Written : WrittenList) {
+				const auto Source = std::find_if(EntryList.begin(), EntryList.end(), [&Written](const T_Entry& Entry) {
+					return Entry.GroupNo == Written.GroupNo && Entry.ItemNo == Written.ItemNo;
+				});
+				SNDTEST_CHECK(Source != EntryList.end() && Source->WAVE == Written.WAVE);
+			}
+
+			SND SNDData;
+			SNDTEST_CHECK(SNDData.LoadSND("written.snd", TestFolder.string()));
+			CheckSameSND(Basic, SNDData);
+			SNDTEST_CHECK(SNDError::NumError() == 0);
+			SNDTEST_CHECK(SNDData.ContentHash() == Basic.ContentHash());
+			CheckBasicSND(SNDData);
+
+			// Repack ̓TEhԍɕׂ2ڈȍ~̃TEhf[^y[WEɑ
+			if (Repack) {
+				const std::vector<unsigned char> Binary = ReadFixture("written.snd");
+				size_t Pos = detail::SNDFormat::kSubHeaderStart;
+				std::pair<int32_t, int32_t> Prev(INT32_MIN, INT32_MIN);
+				for (int32_t index = 0; index < kBasicNumSound && Pos + 16 <= Binary.size(); ++index) {
+					const std::pair<int32_t, int32_t> Number(static_cast<int32_t>(detail::DecodeEndian::UInt32LE(&Binary[Pos + 8])), static_cast<int32_t>(detail::DecodeEndian::UInt32LE(&Binary[Pos + 12])));
+					SNDTEST_CHECK(Prev < Number);
+					SNDTEST_CHECK(index == 0 || (Pos + 16) % 4096 == 0);
+					Prev = Number;
+					Pos = detail::DecodeEndian::UInt32LE(&Binary[Pos]);
+				}
+			}
+		}
+	}
+
+	// kSNDt@C͌SNDƓeœǂݍ܂AʏSND֖߂Ɠt@CɂȂ
+	void TestCompressed() {
+		std::vector<T_Entry> EntryList = BasicEntryList();
+		for (int32_t index = 0; index < 8; ++index) {
+			T_WaveSpec Spec;
+			Spec.NumFrame = 20000;
+			Spec.Silent = (index % 2 == 0);
+			Spec.Seed = static_cast<uint32_t>(index);
+			EntryList.push_back({ 100, index, MakeWAVE(Spec) });
+		}
+
+		SND Original;
+		SNDTEST_CHECK(Original.LoadSND(WriteFixture("source.snd", MakeSND(EntryList)), TestFolder.string()));
+
+		SNDWriter PlainWriter(Original);
+		SNDTEST_CHECK(PlainWriter.WriteSND("plain.snd", TestFolder.string()));
+
+		SNDWriter Writer(Original);
+		Writer.Compress(true);
+		SNDError::ClearError();
+		SNDTEST_CHECK(Writer.WriteSND("compressed.snd", TestFolder.string()));
+		SNDTEST_CHECK(fs::file_size(TestFolder / "compressed.snd") < fs::file_size(TestFolder / "plain.snd"));
+
+		SND SNDData;
+		SNDTEST_CHECK(SNDData.LoadSND("compressed.snd", TestFolder.string()));
+		CheckSameSND(Original, SNDData);
+		SNDTEST_CHECK(SNDError::NumError() == 0);
+		SNDTEST_CHECK(SNDData.ContentHash() == Original.ContentHash());
+
+		SNDWriter Restore(SNDData);
+		SNDTEST_CHECK(Restore.WriteSND("restored.snd", TestFolder.string()));
+		SNDTEST_CHECK(ReadFixture("restored.snd") == ReadFixture("plain.snd"));
+
+		// rŐ؂ꂽkSNDt@C
+		const std::vector<unsigned char> Binary = ReadFixture("compressed.snd");
+		for (size_t Cut : { size_t{ 0 }, size_t{ 20 }, size_t{ 40 }, Binary.size() / 2, Binary.size() - 1 }) {
+			SNDError::ClearError();
+			SND Truncated;
+			SNDTEST_CHECK(!Truncated.LoadSND(WriteFixture("truncated.snd", std::vector<unsigned char>(Binary.begin(), Binary.begin() + Cut)), TestFolder.string()));
+			SNDTEST_CHECK(SNDError::NumError() > 0);
+		}
+	}
+
+	// WJ̃TCYk̃TCY蓾Ȃl̏ꍇ͊mۂOɎs
+	void TestCompressedRawSize() {
+		const std::vector<unsigned char> Binary = MakeRawSizeSND();
+
+		const size_t Base = AllocCounter::ResetPeak();
+		SND SNDData;
+		SNDTEST_CHECK(!SNDData.LoadSND(WriteFixture("rawsize.snd", Binary), TestFolder.string()));
+		SNDTEST_CHECK(CountError(SNDError::Corrupted_SNDFile) == 1);
+		SNDTEST_CHECK(AllocCounter::Peak.load() - Base < (size_t{ 1 } << 20));
+	}
+
+	void CheckSnapshot(SND& SNDData, const SNDSnapshot& Snapshot) {
+		SNDTEST_CHECK(Snapshot.NumGroup() == SNDData.NumGroup() && Snapshot.NumItem() == SNDData.NumItem());
+		SNDTEST_CHECK(Snapshot.ContentHash() == SNDData.ContentHash());
+		SNDTEST_CHECK(Snapshot.FileName() == SNDData.FileName());
+		for (int32_t index = 0; SNDData.ExistSoundDataIndex(index); ++index) {
+			const auto Data = SNDData.GetSoundDataIndex(index);
+			const auto Shared = Snapshot.GetSoundData(Data.GroupNo(), Data.ItemNo());
+			SNDTEST_CHECK(Snapshot.ExistSoundNumber(Data.GroupNo(), Data.ItemNo()) && Snapshot.ExistGroupNo(Data.GroupNo()));
+			SNDTEST_CHECK(Shared.Channel() == Data.Channel() && Shared.Hz() == Data.Hz() && Shared.Bit() == Data.Bit());
+			SNDTEST_CHECK(Shared.NumFrame() == Data.NumFrame() && Shared.ByteSize() == Data.ByteSize());
+			SNDTEST_CHECK(Shared.ContentHash() == Data.ContentHash() && Shared.CommentView() == Data.CommentView());
+
+			std::vector<float> Samples(size_t{ Data.NumFrame() } * std::max(1, Data.Channel()));
+			Samples.resize(size_t{ Shared.DecodeSamples(Samples.data(), 0, Data.NumFrame()) } * std::max(1, Data.Channel()));
+			SNDTEST_CHECK(Samples == Decode(Data));
+		}
+		SNDTEST_CHECK(!Snapshot.ExistSoundNumber(7, 7) && Snapshot.GetSoundData(7, 7).IsDummy());
+	}
+
+	// XibvVbg͕ʂ̃AhX֕ĂALoRĂlԂ
+	void TestSnapshot() {
+		SND SNDData;
+		SNDTEST_CHECK(SNDData.LoadSND(WriteFixture("basic.snd", MakeSND(BasicEntryList())), TestFolder.string()));
+
+		const std::vector<unsigned char> Blob = SNDSnapshot::Serialize(SNDData);
+		std::vector<unsigned char> Moved(Blob.size() + 3);
+		std::memcpy(Moved.data() + 3, Blob.data(), Blob.size());
+
+		SNDSnapshot Snapshot;
+		SNDTEST_CHECK(Snapshot.Attach(Moved.data() + 3, Blob.size()));
+		CheckSnapshot(SNDData, Snapshot);
+
+		SNDError::ClearError();
+		SNDSnapshot Truncated;
+		SNDTEST_CHECK(!Truncated.Attach(Blob.data(), Blob.size() - 1));
+		SNDTEST_CHECK(CountError(SNDError::Invalid_SNDSnapshot) == 1);
+
+		const std::string Name = "saelib_sndtest_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+		auto SharedMemory = SNDSnapshot::Share(SNDData, Name);
+		SNDTEST_CHECK(!SharedMemory.empty());
+
+		SNDSnapshot Shared;
+		SNDTEST_CHECK(Shared.OpenShared(Name));
+		CheckSnapshot(SNDData, Shared);
+	}
+
+	// 1̕ϊŕԂ2t[ϊobt@ɒuȂ`l̃TEh͍ĐA`悪~܂Ȃ
+	void TestMixerChannel() {
+		constexpr uint16_t kMaxChannel = 4096 / 3;
+
+		std::vector<T_Entry> EntryList;
+		for (uint16_t Channel : { uint16_t{ 2 }, kMaxChannel, uint16_t{ kMaxChannel + 1 }, uint16_t{ 2048 } }) {
+			T_WaveSpec Spec;
+			Spec.Channel = Channel;
+			Spec.Bit = 8;
+			Spec.NumFrame = 64;
+			EntryList.push_back({ 0, Channel, MakeWAVE(Spec) });
+		}
+		SND SNDData;
+		SNDTEST_CHECK(SNDData.LoadSND(WriteFixture("channel.snd", MakeSND(EntryList)), TestFolder.string()));
+
+		std::vector<float> Buffer(256 * 2);
+		for (const auto& Entry : EntryList) {
+			const auto Data = SNDData.GetSoundData(Entry.GroupNo, Entry.ItemNo);
+			SNDMixer Mixer(4, 48000);
+			const bool Playable = (Entry.ItemNo <= kMaxChannel);
+			SNDTEST_CHECK((Mixer.Play(Data) != SNDMixer::kInvalidVoice) == Playable);
+			SNDTEST_CHECK((Mixer.Play(Data, 1.0f, 0.0f, 1.3f, true) != SNDMixer::kInvalidVoice) == Playable);
+			for (int index = 0; index < 20; ++index) {
+				Mixer.Render(Buffer.data(), 256);
+			}
+			// [vȂ̃{CX͍ĐIĂ
+			SNDTEST_CHECK(Mixer.NumActiveVoice() == (Playable ? 1u : 0u));
+		}
+	}
+
+	// WJ̃TCYsȈkSNDt@C̓J^O̍쐬ɊmۂOɖȃt@CƂ
+	void TestCatalogRawSize() {
+		const fs::path Folder = TestFolder / "catalog";
+		fs::create_directories(Folder);
+		{
+			std::ofstream File(Folder / "basic.snd", std::ios::binary);
+			const std::vector<unsigned char> Binary = MakeSND(BasicEntryList());
+			File.write(reinterpret_cast<const char*>(Binary.data()), static_cast<std::streamsize>(Binary.size()));
+		}
+		{
+			std::ofstream File(Folder / "rawsize.snd", std::ios::binary);
+			const std::vector<unsigned char> Binary = MakeRawSizeSND();
+			File.write(reinterpret_cast<const char*>(Binary.data()), static_cast<std::streamsize>(Binary.size()));
+		}
+
+		const size_t Base = AllocCounter::ResetPeak();
+		SNDCatalog Catalog;
+		Catalog.Scan(Folder.string());
+		SNDTEST_CHECK(AllocCounter::Peak.load() - Base < (size_t{ 64 } << 20));
+
+		const auto InvalidList = Catalog.InvalidFile();
+		SNDTEST_CHECK(InvalidList.size() == 1 && InvalidList.front().filename() == "rawsize.snd");
+		SNDTEST_CHECK(Catalog.size() == static_cast<size_t>(kBasicNumSound));
+	}
+
+	// s̕2oCgڂ 0x5C('\') ̏ꍇAShift_JIS ƂēǂރRpCł͍sRg̍s܂ő
+	void TestEncoding() {
+		const fs::path Root = fs::absolute(fs::path(__FILE__)).parent_path().parent_path();
+		if (!fs::exists(Root / "h_ReadSndFile.h")) {
+			std::cout << "  source files not found under " << Root.string() << ", skipped\n";
+			return;
+		}
+
+		std::vector<fs::path> FileList = { Root / "h_ReadSndFile.h" };
+		for (const char* Folder : { "tools", "tests" }) {
+			std::error_code ErrorCode;
+			for (const auto& Entry : fs::directory_iterator(Root / Folder, ErrorCode)) {
+				if (Entry.path().extension() == ".cpp") { FileList.push_back(Entry.path()); }
+			}
+		}
+
+		for (const auto& Path : FileList) {
+			std::ifstream File(Path, std::ios::binary);
+			SNDTEST_CHECK(File.is_open());
+			std::string Line;
+			for (int32_t LineNo = 1; std::getline(File, Line); ++LineNo) {
+				if (!Line.empty() && Line.back() == '\r') { Line.pop_back(); }
+
+				// 擪2oCg؂AŌ̕ 0x5C ŏI邩𒲂ׂ
+				bool EndsWith5C = false;
+				for (size_t index = 0; index < Line.size(); ++index) {
+					const unsigned char Byte = static_cast<unsigned char>(Line[index]);
+					const bool IsLeadByte = (0x81 <= Byte && Byte <= 0x9F) || (0xE0 <= Byte && Byte <= 0xFC);
+					EndsWith5C = (IsLeadByte && index + 2 == Line.size() && Line[index + 1] == '\\');
+					if (IsLeadByte) { ++index; }
+				}
+				if (EndsWith5C) {
+					++NumFailure;
+					std::cerr << "  FAILED: " << Path.string() << ":" << LineNo << " ends with a Shift_JIS character whose trail byte is 0x5C\n";
+				}
+			}
+		}
+	}
+
+	struct T_Test {
+		const char* Name;
+		void (*Function)();
+	};
+
+	constexpr T_Test TestList[] = {
+		{ "load", TestLoad },
+		{ "invalid", TestInvalidWAVE },
+		{ "chunksize", TestChunkSize },
+		{ "version2", TestVersion2 },
+		{ "soundnumber", TestSoundNumber },
+		{ "errorid", TestErrorID },
+		{ "truncated", TestTruncated },
+		{ "memory", TestMemory },
+		{ "lookup", TestLookup },
+		{ "writer", TestWriter },
+		{ "compressed", TestCompressed },
+		{ "rawsize", TestCompressedRawSize },
+		{ "snapshot", TestSnapshot },
+		{ "mixer", TestMixerChannel },
+		{ "catalog", TestCatalogRawSize },
+		{ "encoding", TestEncoding },
+	};
+}
+
+int main(int argc, char* argv[]) {
+	const std::vector<std::string> Args(argv + 1, argv + argc);
+
+	TestFolder = fs::temp_directory_path() / ("saelib_sndtest_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+	fs::create_directories(TestFolder);
+	SNDConfig::SetThrowError(false);
+
+	int NumFailedTest = 0;
+	for (const auto& Test : TestList) {
+		if (!Args.empty() && std::find(Args.begin(), Args.end(), Test.Name) == Args.end()) { continue; }
+
+		std::cout << Test.Name << "\n";
+		SNDError::ClearError();
+		const int PrevFailure = NumFailure;
+		Test.Function();
+		if (NumFailure != PrevFailure) { ++NumFailedTest; }
+	}
+
+	std::error_code ErrorCode;
+	fs::remove_all(TestFolder, ErrorCode);
+
+	if (NumFailedTest) {
+		std::cout << NumFailedTest << " test(s) failed\n";
+		return 1;
+	}
+	std::cout << "all tests passed\n";
+	return 0;
+}
@@ -0,0 +1,195 @@
+// sndindexbench - TEhԍ̍̎Ƃ̏Ԃrx`}[N
+//
+// g:
+//   sndindexbench [file.snd]...   SNDt@Cw肵ꍇ͂̃TEhԍ̕тłv
+//
+// vԍ̕:
+//   dense    O[v 0`199AACe 0`19 ɕ
+//   typical  ʓIȃLN^[SNDɋ߂ԍ(O[vԍ + ̃O[vԍ)
+//   sparse   O[vԍAACeԍƂ32bit͈̔͂őaɕ
+//
+// rh:
+//   g++ -std=c++17 -O2 -pthread tools/sndindexbench.cpp -o sndindexbench
+//   cl /std:c++17 /O2 /EHsc tools\sndindexbench.cpp
+//
+// I񂾎 h_ReadSndFile.h Oɒ`Ďgp
+//   #define SAELIB_SND_INDEX_BACKEND T_RobinHoodIndex
+
+#include "../h_ReadSndFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+	using namespace SAELib;
+	namespace detail = SAELib::ReadSndFile_detail;
+	namespace backend = SAELib::ReadSndFile_detail::IndexBackend;
+
+	struct T_KeySet {
+		std::string Name = {};
+		std::vector<int64_t> Hit = {};	// o^
+		std::vector<int64_t> Miss = {};	// o^ĂȂԍ
+	};
+
+	// o^ĂԍƓ͈͂o^ĂȂԍI
+	void AddMiss(T_KeySet& KeySet, std::mt19937& Random) {
+		detail::T_UnorderedMap<int64_t, backend::T_StdIndex> Registered;
+		for (int64_t Key : KeySet.Hit) { Registered.Register(Key); }
+		std::vector<int64_t> Candidate;
+		for (int64_t Key : KeySet.Hit) {
+			const int32_t GroupNo = detail::Convert::DecodeSoundGroupNo(Key);
+			const int32_t ItemNo = detail::Convert::DecodeSoundItemNo(Key);
+			Candidate.push_back(detail::Convert::EncodeSoundNumber(GroupNo, ItemNo + 1));
+			Candidate.push_back(detail::Convert::EncodeSoundNumber(GroupNo + 1, ItemNo));
+			Candidate.push_back(detail::Convert::EncodeSoundNumber(static_cast<int32_t>(Random()), ItemNo));
+		}
+		for (int64_t Key : Candidate) {
+			if (!Registered.exist(Key)) { KeySet.Miss.push_back(Key); }
+		}
+		std::shuffle(KeySet.Miss.begin(), KeySet.Miss.end(), Random);
+	}
+
+	T_KeySet DenseKeySet(std::mt19937& Random) {
+		T_KeySet KeySet{ "dense" };
+		for (int32_t GroupNo = 0; GroupNo < 200; ++GroupNo) {
+			for (int32_t ItemNo = 0; ItemNo < 20; ++ItemNo) { KeySet.Hit.push_back(detail::Convert::EncodeSoundNumber(GroupNo, ItemNo)); }
+		}
+		AddMiss(KeySet, Random);
+		return KeySet;
+	}
+
+	T_KeySet TypicalKeySet(std::mt19937& Random) {
+		T_KeySet KeySet{ "typical" };
+		auto AddRange = [&KeySet, &Random](int32_t FirstGroup, int32_t NumGroup, int32_t MaxItem) {
+			for (int32_t GroupNo = FirstGroup; GroupNo < FirstGroup + NumGroup; ++GroupNo) {
+				const int32_t NumItem = 1 + static_cast<int32_t>(Random() % static_cast<uint32_t>(MaxItem));
+				for (int32_t ItemNo = 0; ItemNo < NumItem; ++ItemNo) { KeySet.Hit.push_back(detail::Convert::EncodeSoundNumber(GroupNo, ItemNo)); }
+			}
+		};
+		AddRange(0, 40, 10);
+		AddRange(100, 100, 4);
+		AddRange(800, 60, 3);
+		AddRange(5000, 100, 3);
+		AddRange(9000, 5, 2);
+		AddMiss(KeySet, Random);
+		return KeySet;
+	}
+
+	T_KeySet SparseKeySet(std::mt19937& Random) {
+		T_KeySet KeySet{ "sparse" };
+		detail::T_UnorderedMap<int64_t, backend::T_StdIndex> Registered;
+		while (KeySet.Hit.size() < 4000) {
+			const int64_t Key = detail::Convert::EncodeSoundNumber(static_cast<int32_t>(Random()), static_cast<int32_t>(Random()));
+			if (Registered.exist(Key)) { continue; }
+			Registered.Register(Key);
+			KeySet.Hit.push_back(Key);
+		}
+		AddMiss(KeySet, Random);
+		return KeySet;
+	}
+
+	bool FileKeySet(const std::string& Path, std::mt19937& Random, T_KeySet& KeySet) {
+		const std::filesystem::path FilePath(Path);
+		const std::filesystem::path Folder = FilePath.has_parent_path() ? FilePath.parent_path() : std::filesystem::current_path();
+		SND SNDData;
+		if (!SNDData.LoadSND(FilePath.filename().string(), Folder.string())) { return false; }
+		KeySet.Name = FilePath.filename().string();
+		for (int32_t index = 0; SNDData.ExistSoundDataIndex(index); ++index) {
+			const auto Data = SNDData.GetSoundDataIndex(index);
+			KeySet.Hit.push_back(detail::Convert::EncodeSoundNumber(Data.GroupNo(), Data.ItemNo()));
+		}
+		AddMiss(KeySet, Random);
+		return !KeySet.Hit.empty();
+	}
+
+	struct T_Result {
+		double Build = 0.0;	// 1̓o^(ns)
+		double Hit = 0.0;	// 1̌(ns)
+		double Miss = 0.0;	// 1̖o^莞(ns)
+	};
+
+	template<typename Func>
+	double MeasureNs(size_t NumOperation, Func&& Function) {
+		const auto Start = std::chrono::steady_clock::now();
+		Function();
+		const auto End = std::chrono::steady_clock::now();
+		return std::chrono::duration<double, std::nano>(End - Start).count() / static_cast<double>(NumOperation);
+	}
+
+	// ǂݍݎƓ݊mFĂo^A͓o^ƈقȂ鏇Ԃōs
+	template<template<typename> typename Backend>
+	T_Result Measure(const T_KeySet& KeySet, std::mt19937& Random, int64_t& Sink) {
+		constexpr size_t kTargetOperation = 2000000;
+		const size_t NumRepeat = std::max<size_t>(1, kTargetOperation / KeySet.Hit.size());
+		std::vector<int64_t> HitOrder = KeySet.Hit;
+		std::shuffle(HitOrder.begin(), HitOrder.end(), Random);
+
+		T_Result Result;
+		Result.Build = MeasureNs(KeySet.Hit.size() * NumRepeat, [&]() {
+			for (size_t Repeat = 0; Repeat < NumRepeat; ++Repeat) {
+				detail::T_UnorderedMap<int64_t, Backend> Index;
+				Index.reserve(static_cast<detail::ksize_t>(KeySet.Hit.size()));
+				for (int64_t Key : KeySet.Hit) {
+					if (!Index.exist(Key)) { Index.Register(Key); }
+				}
+				Index.shrink_to_fit();
+				Sink += Index.size();
+			}
+		});
+
+		detail::T_UnorderedMap<int64_t, Backend> Index;
+		for (int64_t Key : KeySet.Hit) { Index.Register(Key); }
+		Index.shrink_to_fit();
+		Result.Hit = MeasureNs(HitOrder.size() * NumRepeat, [&]() {
+			for (size_t Repeat = 0; Repeat < NumRepeat; ++Repeat) {
+				for (int64_t Key : HitOrder) { Sink += Index.find(Key); }
+			}
+		});
+		const size_t NumMissRepeat = std::max<size_t>(1, kTargetOperation / std::max<size_t>(1, KeySet.Miss.size()));
+		Result.Miss = MeasureNs(std::max<size_t>(1, KeySet.Miss.size()) * NumMissRepeat, [&]() {
+			for (size_t Repeat = 0; Repeat < NumMissRepeat; ++Repeat) {
+				for (int64_t Key : KeySet.Miss) { Sink += Index.find(Key); }
+			}
+		});
+		return Result;
+	}
+
+	void PrintResult(const char* Name, const T_Result& Result) {
+		std::printf("  %-18s build %8.2f ns  hit %8.2f ns  miss %8.2f ns\n", Name, Result.Build, Result.Hit, Result.Miss);
+	}
+
+	void Run(const T_KeySet& KeySet, std::mt19937& Random, int64_t& Sink) {
+		std::printf("%s (%zu keys)\n", KeySet.Name.c_str(), KeySet.Hit.size());
+		PrintResult("T_StdIndex", Measure<backend::T_StdIndex>(KeySet, Random, Sink));
+		PrintResult("T_RobinHoodIndex", Measure<backend::T_RobinHoodIndex>(KeySet, Random, Sink));
+		PrintResult("T_SortedIndex", Measure<backend::T_SortedIndex>(KeySet, Random, Sink));
+		PrintResult("T_TwoLevelIndex", Measure<backend::T_TwoLevelIndex>(KeySet, Random, Sink));
+	}
+}
+
+int main(int argc, char* argv[]) {
+	std::mt19937 Random(20240229);
+	int64_t Sink = 0;
+
+	std::vector<T_KeySet> KeySetList;
+	KeySetList.push_back(DenseKeySet(Random));
+	KeySetList.push_back(TypicalKeySet(Random));
+	KeySetList.push_back(SparseKeySet(Random));
+	for (int index = 1; index < argc; ++index) {
+		T_KeySet KeySet;
+		if (!FileKeySet(argv[index], Random, KeySet)) {
+			std::cerr << argv[index] << ": cannot load\n";
+			continue;
+		}
+		KeySetList.push_back(std::move(KeySet));
+	}
+
+	for (const auto& KeySet : KeySetList) { Run(KeySet, Random, Sink); }
+	std::printf("(checksum %lld)\n", static_cast<long long>(Sink));
+	return 0;
+}
@@ -0,0 +1,199 @@
+// sndmixbench - SNDMixer 1RA̓vx`}[N
+//
+// g:
+//   sndmixbench [NumVoice] [file.snd]   {CX(ȗ 256)ƍĐSNDt@C(ȗ͐TEh)w
+//
+// vĐ(S{CX[vĐA256t[ 48000Hz ̃XeI֕`悷):
+//   unity     48000Hz ̃TEh𓙔{ōĐ(TEhf[^璼ڃ~bNX)
+//   pitch     48000Hz ̃TEhsb` 1.1 ōĐ(`)
+//   resample  22050Hz ̃TEh𓙔{ōĐ(`)
+//   SNDt@Cw肵ꍇ͑STEh𓙔{ƃsb` 1.1 ōĐ
+//
+// 1ubN̕`掞Ԃ(256 / 48000 b)ɐ߂銄1RAœɖ点{CX߂
+//
+// rh:
+//   g++ -std=c++17 -O2 -pthread tools/sndmixbench.cpp -o sndmixbench
+//   cl /std:c++17 /O2 /EHsc tools\sndmixbench.cpp
+
+#include "../h_ReadSndFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+	using namespace SAELib;
+	namespace detail = SAELib::ReadSndFile_detail;
+
+	constexpr uint32_t kSampleRate = 48000;
+	constexpr uint32_t kBlockFrame = 256;
+	constexpr double kMeasureSeconds = 0.5;
+
+	// 16bitXeI1bԂWAVEf[^(TEhƂɎgς)
+	std::vector<unsigned char> MakeWAVE(uint32_t Hz, uint32_t Seed) {
+		constexpr uint16_t kChannel = 2;
+		constexpr uint16_t kBit = 16;
+		constexpr uint16_t kBlockAlign = kChannel * kBit / 8;
+		const uint32_t DataSize = Hz * kBlockAlign;
+
+		std::vector<unsigned char> WAVE(44 + DataSize);
+		std::memcpy(&WAVE[0], "RIFF", 4);
+		detail::EncodeEndian::UInt32LE(&WAVE[4], static_cast<uint32_t>(WAVE.size() - 8));
+		std::memcpy(&WAVE[8], "WAVEfmt ", 8);
+		detail::EncodeEndian::UInt32LE(&WAVE[16], 16);
+		detail::EncodeEndian::UInt16LE(&WAVE[20], 1);
+		detail::EncodeEndian::UInt16LE(&WAVE[22], kChannel);
+		detail::EncodeEndian::UInt32LE(&WAVE[24], Hz);
+		detail::EncodeEndian::UInt32LE(&WAVE[28], Hz * kBlockAlign);
+		detail::EncodeEndian::UInt16LE(&WAVE[32], kBlockAlign);
+		detail::EncodeEndian::UInt16LE(&WAVE[34], kBit);
+		std::memcpy(&WAVE[36], "data", 4);
+		detail::EncodeEndian::UInt32LE(&WAVE[40], DataSize);
+
+		const double Step = 2.0 * 3.14159265358979 * (220.0 + 55.0 * Seed) / Hz;
+		for (uint32_t Frame = 0; Frame < Hz; ++Frame) {
+			const auto Value = static_cast<uint16_t>(static_cast<int16_t>(std::sin(Step * Frame) * 12000.0));
+			detail::EncodeEndian::UInt16LE(&WAVE[44 + Frame * kBlockAlign], Value);
+			detail::EncodeEndian::UInt16LE(&WAVE[46 + Frame * kBlockAlign], Value);
+		}
+		return WAVE;
+	}
+
+	// O[v 0  48000HzAO[v 1  22050Hz ̃TEh4SNDt@Co
+	bool WriteBenchSND(const std::filesystem::path& FilePath) {
+		std::vector<unsigned char> SNDFile(detail::SNDFormat::kSubHeaderStart);
+		std::memcpy(&SNDFile[0], detail::SNDFormat::kSignature.data(), detail::SNDFormat::kSignature.size());
+		detail::EncodeEndian::UInt32BE(&SNDFile[12], detail::SNDFormat::kSNDVersion);
+		detail::EncodeEndian::UInt32LE(&SNDFile[16], 8);
+		detail::EncodeEndian::UInt32LE(&SNDFile[20], detail::SNDFormat::kSubHeaderStart);
+
+		for (int32_t GroupNo = 0; GroupNo < 2; ++GroupNo) {
+			for (int32_t ItemNo = 0; ItemNo < 4; ++ItemNo) {
+				const std::vector<unsigned char> WAVE = MakeWAVE(GroupNo ? 22050 : kSampleRate, static_cast<uint32_t>(ItemNo));
+				const size_t Pos = SNDFile.size();
+				SNDFile.resize(Pos + 16);
+				detail::EncodeEndian::UInt32LE(&SNDFile[Pos], static_cast<uint32_t>(Pos + 16 + WAVE.size()));
+				detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 4], static_cast<uint32_t>(WAVE.size()));
+				detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 8], static_cast<uint32_t>(GroupNo));
+				detail::EncodeEndian::UInt32LE(&SNDFile[Pos + 12], static_cast<uint32_t>(ItemNo));
+				SNDFile.insert(SNDFile.end(), WAVE.begin(), WAVE.end());
+			}
+		}
+
+		std::ofstream File(FilePath, std::ios::binary | std::ios::trunc);
+		File.write(reinterpret_cast<const char*>(SNDFile.data()), static_cast<std::streamsize>(SNDFile.size()));
+		return static_cast<bool>(File);
+	}
+
+	struct T_Case {
+		std::string Name = {};
+		std::vector<SND::SoundData> SoundList = {};
+		float Pitch = 1.0f;
+	};
+
+	// S{CX[vĐAvԂ̊Ԃɕ`悵ubN̕ώ(ms)Ԃ
+	double Measure(const T_Case& Case, detail::ksize_t NumVoice, detail::ksize_t& NumPlaying, double& Sink) {
+		SNDMixer Mixer(NumVoice, kSampleRate);
+		Mixer.SetMasterVolume(1.0f / static_cast<float>(NumVoice));
+		NumPlaying = 0;
+		for (detail::ksize_t index = 0; index < NumVoice; ++index) {
+			const auto& Sound = Case.SoundList[index % Case.SoundList.size()];
+			NumPlaying += (Mixer.Play(Sound, 1.0f, 0.0f, Case.Pitch, true) != SNDMixer::kInvalidVoice);
+		}
+
+		std::vector<float> Buffer(size_t{ kBlockFrame } * 2);
+		for (int Warmup = 0; Warmup < 16; ++Warmup) { Mixer.Render(Buffer.data(), kBlockFrame); }
+
+		size_t NumBlock = 0;
+		const auto Start = std::chrono::steady_clock::now();
+		double Elapsed = 0.0;
+		while (Elapsed < kMeasureSeconds) {
+			for (int index = 0; index < 16; ++index) { Mixer.Render(Buffer.data(), kBlockFrame); }
+			NumBlock += 16;
+			Sink += Buffer[0];
+			Elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - Start).count();
+		}
+		return Elapsed * 1000.0 / static_cast<double>(NumBlock);
+	}
+
+	void Run(const T_Case& Case, detail::ksize_t NumVoice, double& Sink) {
+		if (Case.SoundList.empty()) { return; }
+
+		detail::ksize_t NumPlaying = 0;
+		const double BlockMs = Measure(Case, NumVoice, NumPlaying, Sink);
+		const double BudgetMs = 1000.0 * kBlockFrame / kSampleRate;
+		const double VoicePerCore = (NumPlaying ? NumPlaying * BudgetMs / BlockMs : 0.0);
+		std::printf("  %-10s %6u voices  %8.4f ms/block  (%5.1f%% of %.2f ms)  %9.0f voices per core\n",
+			Case.Name.c_str(), NumPlaying, BlockMs, 100.0 * BlockMs / BudgetMs, BudgetMs, VoicePerCore);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	SNDConfig::SetThrowError(false);
+
+	detail::ksize_t NumVoice = 256;
+	int ArgIndex = 1;
+	if (ArgIndex < argc && std::strtoul(argv[ArgIndex], nullptr, 10) > 0) {
+		NumVoice = static_cast<detail::ksize_t>(std::min<unsigned long>(std::strtoul(argv[ArgIndex], nullptr, 10), SNDMixer::kMaxVoice));
+		++ArgIndex;
+	}
+
+	SND SNDData;
+	std::vector<T_Case> CaseList;
+	if (ArgIndex < argc) {
+		const std::filesystem::path FilePath(argv[ArgIndex]);
+		const std::filesystem::path Folder = FilePath.has_parent_path() ? FilePath.parent_path() : std::filesystem::current_path();
+		if (!SNDData.LoadSND(FilePath.filename().string(), Folder.string())) {
+			std::cerr << argv[ArgIndex] << ": cannot load\n";
+			return 1;
+		}
+		T_Case Unity{ "unity" };
+		for (int32_t index = 0; SNDData.ExistSoundDataIndex(index); ++index) {
+			const auto Data = SNDData.GetSoundDataIndex(index);
+			if (Data.NumFrame()) { Unity.SoundList.push_back(Data); }
+		}
+		T_Case Pitch = Unity;
+		Pitch.Name = "pitch";
+		Pitch.Pitch = 1.1f;
+		CaseList.push_back(Unity);
+		CaseList.push_back(Pitch);
+		std::printf("%s (%zu sounds)\n", FilePath.filename().string().c_str(), Unity.SoundList.size());
+	}
+	else {
+		const std::filesystem::path Folder = std::filesystem::temp_directory_path();
+		const std::string FileName = "sndmixbench_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".snd";
+		const bool Loaded = WriteBenchSND(Folder / FileName) && SNDData.LoadSND(FileName, Folder.string());
+		std::error_code ErrorCode;
+		std::filesystem::remove(Folder / FileName, ErrorCode);
+		if (!Loaded) {
+			std::cerr << "cannot create the benchmark sounds\n";
+			return 1;
+		}
+		T_Case Unity{ "unity" };
+		T_Case Resample{ "resample" };
+		for (int32_t ItemNo = 0; ItemNo < 4; ++ItemNo) {
+			Unity.SoundList.push_back(SNDData.GetSoundData(0, ItemNo));
+			Resample.SoundList.push_back(SNDData.GetSoundData(1, ItemNo));
+		}
+		T_Case Pitch = Unity;
+		Pitch.Name = "pitch";
+		Pitch.Pitch = 1.1f;
+		CaseList.push_back(Unity);
+		CaseList.push_back(Pitch);
+		CaseList.push_back(Resample);
+		std::printf("generated 16bit stereo sounds (1 second each)\n");
+	}
+
+	double Sink = 0.0;
+	for (const auto& Case : CaseList) { Run(Case, NumVoice, Sink); }
+	std::printf("(checksum %g)\n", Sink);
+	return 0;
+}
@@ -0,0 +1,286 @@
+// sndtool - h_ReadSndFile.h gpSNDt@C̃R}hCc[
+//
+// g:
+//   sndtool info     <file.snd>...               wb_[ƃTEh\
+//   sndtool list     <file.snd>                  TEhƂ̏\
+//   sndtool validate <file.snd>...               ǂݍݎ̃G[ƕsȃTEh\
+//   sndtool extract  <file.snd> [OutFolder]      TEh "O[vԍ-ACeԍ.wav" Ƃĕɏo
+//   sndtool bench    <file.snd> [Count]          ǂݍ݂ƌ̏ԁATEhf[^gpʂv
+//
+// rh:
+//   g++ -std=c++17 -O2 -pthread tools/sndtool.cpp -o sndtool
+//   cl /std:c++17 /O2 /EHsc tools\sndtool.cpp
+
+#include "../h_ReadSndFile.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+	using namespace SAELib;
+	namespace detail = SAELib::ReadSndFile_detail;
+
+	// IR[h
+	constexpr int kExitSuccess = 0;
+	constexpr int kExitFailure = 1;
+	constexpr int kExitUsage = 2;
+
+	void PrintUsage() {
+		std::cerr
+			<< "usage:\n"
+			<< "  sndtool info     <file.snd>...\n"
+			<< "  sndtool list     <file.snd>\n"
+			<< "  sndtool validate <file.snd>...\n"
+			<< "  sndtool extract  <file.snd> [OutFolder]\n"
+			<< "  sndtool bench    <file.snd> [Count]\n";
+	}
+
+	// LoadSND ̓t@CƌpX𕪂Ď󂯎邽߁Aw肳ꂽpX𕪉
+	bool LoadSNDPath(SND& SNDData, const std::string& Path) {
+		const std::filesystem::path FilePath(Path);
+		const std::filesystem::path Folder = FilePath.has_parent_path() ? FilePath.parent_path() : std::filesystem::current_path();
+		return SNDData.LoadSND(FilePath.filename().string(), Folder.string());
+	}
+
+	// dǂݍݍς݂̃TEh
+	int32_t NumSound(const SND& SNDData) {
+		int32_t Count = 0;
+		while (SNDData.ExistSoundDataIndex(Count)) { ++Count; }
+		return Count;
+	}
+
+	// L^ꂽG[\ăG[Ԃ
+	size_t PrintError(const std::string& Path) {
+		const size_t NumError = SNDError::NumError();
+		for (size_t index = 0; index < NumError; ++index) {
+			const int32_t ID = SNDError::GetErrorID(index);
+			if (ID < 0 || static_cast<size_t>(ID) >= SNDError::ErrorInfoSize) { continue; }
+			std::cout << Path << ": " << SNDError::ErrorName(ID);
+			if (ID == SNDError::Warning_DuplicateSoundNumber || ID == SNDError::NotFound_SoundNumber
+				|| ID == SNDError::Failed_CreateWAVFile || ID == SNDError::Failed_WriteWAVFile || ID == SNDError::Failed_CloseWAVFile) {
+				std::cout << " (" << SNDError::GetErrorValue(index) << "-" << SNDError::GetErrorValue2(index) << ")";
+			}
+			std::cout << "\n";
+		}
+		SNDError::ClearError();
+		return NumError;
+	}
+
+	// Rg͏I[܂ł̕(s͋󔒂ɒu)
+	std::string CommentString(const SND::SoundData& Data) {
+		std::string Comment(reinterpret_cast<const char*>(Data.Comment()));
+		for (char& c : Comment) {
+			if (static_cast<unsigned char>(c) < 0x20) { c = ' '; }
+		}
+		return Comment;
+	}
+
+	int CommandInfo(const std::vector<std::string>& Args) {
+		int Result = kExitSuccess;
+		for (const auto& Path : Args) {
+			// wb_[͓ǂݍ݌ɕێȂߒړǂݎ
+			unsigned char Header[detail::SNDFormat::kCompressedHeaderSize] = {};
+			std::ifstream File(Path, std::ios::binary);
+			if (!File.read(reinterpret_cast<char*>(Header), sizeof(Header))) {
+				std::cerr << Path << ": cannot read header\n";
+				Result = kExitFailure;
+				continue;
+			}
+			File.close();
+
+			SND SNDData;
+			const bool Loaded = LoadSNDPath(SNDData, Path);
+			PrintError(Path);
+			if (!Loaded) {
+				Result = kExitFailure;
+				continue;
+			}
+
+			const bool Compressed = std::memcmp(Header, detail::SNDFormat::kCompressedSignature.data(), detail::SNDFormat::kCompressedSignature.size()) == 0;
+			const int32_t NumData = NumSound(SNDData);
+			size_t PayloadSize = 0;
+			for (int32_t index = 0; index < NumData; ++index) {
+				PayloadSize += SNDData.GetSoundDataIndex(index).PayloadSize();
+			}
+
+			char Hash[17] = {};
+			std::snprintf(Hash, sizeof(Hash), "%016llx", static_cast<unsigned long long>(SNDData.ContentHash()));
+
+			std::cout << "file:        " << Path << "\n";
+			std::cout << "format:      " << (Compressed ? "compressed" : "snd") << "\n";
+			if (Compressed) {
+				std::cout << "version:     " << detail::DecodeEndian::UInt32LE(&Header[12]) << "\n";
+			}
+			else {
+				std::cout << "version:     0x" << std::hex << detail::DecodeEndian::UInt32BE(&Header[12]) << std::dec << "\n";
+				std::cout << "subheader:   " << detail::DecodeEndian::UInt32LE(&Header[20]) << "\n";
+			}
+			std::cout << "header num:  " << detail::DecodeEndian::UInt32LE(&Header[16]) << "\n";
+			std::cout << "sounds:      " << NumData << "\n";
+			std::cout << "groups:      " << SNDData.NumGroup() << "\n";
+			std::cout << "payload:     " << PayloadSize << " bytes\n";
+			std::cout << "hash:        " << Hash << "\n";
+		}
+		return Result;
+	}
+
+	int CommandList(const std::vector<std::string>& Args) {
+		if (Args.size() != 1) {
+			PrintUsage();
+			return kExitUsage;
+		}
+		SND SNDData;
+		const bool Loaded = LoadSNDPath(SNDData, Args[0]);
+		PrintError(Args[0]);
+		if (!Loaded) { return kExitFailure; }
+
+		const int32_t NumData = NumSound(SNDData);
+		std::cout << "group\titem\thz\tch\tbit\tframes\tseconds\tbytes\tcomment\n";
+		for (int32_t index = 0; index < NumData; ++index) {
+			const auto Data = SNDData.GetSoundDataIndex(index);
+			char Seconds[32] = {};
+			std::snprintf(Seconds, sizeof(Seconds), "%.3f", Data.Duration());
+			std::cout << Data.GroupNo() << "\t" << Data.ItemNo() << "\t" << Data.Hz() << "\t" << Data.Channel() << "\t" << Data.Bit()
+				<< "\t" << Data.NumFrame() << "\t" << Seconds << "\t" << Data.ByteSize() << "\t" << CommentString(Data) << "\n";
+		}
+		return kExitSuccess;
+	}
+
+	int CommandValidate(const std::vector<std::string>& Args) {
+		int Result = kExitSuccess;
+		for (const auto& Path : Args) {
+			SND SNDData;
+			const bool Loaded = LoadSNDPath(SNDData, Path);
+			size_t NumProblem = PrintError(Path);
+			const int32_t NumData = NumSound(SNDData);
+
+			// ǂݍ߂ĂĐłȂTEh(Ή`Adata`N)񍐂
+			for (int32_t index = 0; Loaded && index < NumData; ++index) {
+				const auto Data = SNDData.GetSoundDataIndex(index);
+				if (Data.NumFrame() == 0) {
+					std::cout << Path << ": NoPlayableSample (" << Data.GroupNo() << "-" << Data.ItemNo() << ")\n";
+					++NumProblem;
+				}
+			}
+			if (!Loaded) { ++NumProblem; }
+
+			std::cout << Path << ": " << (NumProblem ? "NG" : "OK") << " (" << NumData << " sounds, " << NumProblem << " problems)\n";
+			if (NumProblem) { Result = kExitFailure; }
+		}
+		return Result;
+	}
+
+	int CommandExtract(const std::vector<std::string>& Args) {
+		if (Args.empty() || Args.size() > 2) {
+			PrintUsage();
+			return kExitUsage;
+		}
+		SND SNDData;
+		const bool Loaded = LoadSNDPath(SNDData, Args[0]);
+		PrintError(Args[0]);
+		if (!Loaded) { return kExitFailure; }
+
+		const std::string OutFolder = (Args.size() == 2 ? Args[1] : std::filesystem::path(Args[0]).stem().string());
+		const auto Start = std::chrono::steady_clock::now();
+		const bool Exported = SNDWriter(SNDData).ExportWAV(OutFolder);
+		const auto Elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - Start).count();
+		const size_t NumError = PrintError(Args[0]);
+
+		const int32_t NumData = NumSound(SNDData);
+		std::cout << "extracted " << (NumData - static_cast<int32_t>(NumError)) << "/" << NumData << " sounds to " << OutFolder << " (" << Elapsed << " ms)\n";
+		return (Exported ? kExitSuccess : kExitFailure);
+	}
+
+	int CommandBench(const std::vector<std::string>& Args) {
+		if (Args.empty() || Args.size() > 2) {
+			PrintUsage();
+			return kExitUsage;
+		}
+		const int Count = (Args.size() == 2 ? std::max(1, std::atoi(Args[1].c_str())) : 10);
+		using Clock = std::chrono::steady_clock;
+
+		// ǂݍ
+		SND SNDData;
+		double LoadMin = std::numeric_limits<double>::max(), LoadTotal = 0;
+		for (int Loop = 0; Loop < Count; ++Loop) {
+			const auto Start = Clock::now();
+			const bool Loaded = LoadSNDPath(SNDData, Args[0]);
+			const double Elapsed = std::chrono::duration<double, std::milli>(Clock::now() - Start).count();
+			if (!Loaded) {
+				PrintError(Args[0]);
+				return kExitFailure;
+			}
+			LoadMin = std::min(LoadMin, Elapsed);
+			LoadTotal += Elapsed;
+		}
+		PrintError(Args[0]);
+
+		// SND֓ǂݍݒ߁Aől1񕪂̓ǂݍ݂ł̃TEhf[^gpʂɂȂ
+		std::error_code Error;
+		const uintmax_t FileSize = std::filesystem::file_size(Args[0], Error);
+		const size_t PeakSize = SNDResidency::peak();
+
+		// TEhԍł̌(o^ĂȂԍ͓o^ς݂̔ԍׂ̗I)
+		const int32_t NumData = NumSound(SNDData);
+		std::vector<std::pair<int32_t, int32_t>> SoundNumber, MissNumber;
+		for (int32_t index = 0; index < NumData; ++index) {
+			const auto Data = SNDData.GetSoundDataIndex(index);
+			SoundNumber.emplace_back(Data.GroupNo(), Data.ItemNo());
+			if (!SNDData.ExistSoundNumber(Data.GroupNo(), Data.ItemNo() + 1)) { MissNumber.emplace_back(Data.GroupNo(), Data.ItemNo() + 1); }
+		}
+		auto MeasureLookup = [&SNDData, Count](const std::vector<std::pair<int32_t, int32_t>>& NumberList, size_t& NumFound) {
+			size_t NumLookup = 0;
+			const auto Start = Clock::now();
+			for (int Loop = 0; Loop < Count * 100; ++Loop) {
+				for (const auto& Number : NumberList) {
+					NumFound += SNDData.ExistSoundNumber(Number.first, Number.second);
+					++NumLookup;
+				}
+			}
+			const double Elapsed = std::chrono::duration<double, std::nano>(Clock::now() - Start).count();
+			return (NumLookup ? Elapsed / NumLookup : 0.0);
+		};
+		size_t NumFound = 0, NumMissFound = 0;
+		const double LookupHit = MeasureLookup(SoundNumber, NumFound);
+		const double LookupMiss = MeasureLookup(MissNumber, NumMissFound);
+
+		std::cout << "file:        " << Args[0] << " (" << NumData << " sounds)\n";
+		std::cout << "load:        min " << LoadMin << " ms, avg " << LoadTotal / Count << " ms (" << Count << " runs)\n";
+		std::cout << "memory:      peak " << PeakSize << " bytes";
+		if (!Error && FileSize) { std::cout << " (" << static_cast<double>(PeakSize) / static_cast<double>(FileSize) << " x file size)"; }
+		std::cout << "\n";
+		std::cout << "lookup:      hit " << LookupHit << " ns/op, miss " << LookupMiss << " ns/op (" << SoundNumber.size() << " hit / " << MissNumber.size() << " miss keys)\n";
+		return kExitSuccess;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	if (argc < 3) {
+		PrintUsage();
+		return kExitUsage;
+	}
+
+	// G[͗OɂL^ĕ\
+	SNDConfig::SetThrowError(false);
+	SNDConfig::SetCreateLogFile(false);
+
+	const std::string Command = argv[1];
+	const std::vector<std::string> Args(argv + 2, argv + argc);
+	try {
+		if (Command == "info") { return CommandInfo(Args); }
+		if (Command == "list") { return CommandList(Args); }
+		if (Command == "validate") { return CommandValidate(Args); }
+		if (Command == "extract") { return CommandExtract(Args); }
+		if (Command == "bench") { return CommandBench(Args); }
+	}
+	catch (const std::exception& e) {
+		std::cerr << "error: " << e.what() << "\n";
+		return kExitFailure;
+	}
+	PrintUsage();
+	return kExitUsage;
+}